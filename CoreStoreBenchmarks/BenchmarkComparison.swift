@@ -0,0 +1,252 @@
+//
+//  BenchmarkComparison.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+
+
+// MARK: - BenchmarkComparison
+
+/**
+ Compares a benchmark report against a stored baseline, one verdict per scenario.
+
+ A scenario's time is flagged as `.regressed` only if its median grew by more than both:
+ - `Thresholds.relativeTime` of the baseline median, and
+ - `Thresholds.deviations` times the larger normalized MAD (`1.4826 * MAD`) of the two runs.
+
+ The second bound keeps noisy scenarios from failing the gate on run-to-run jitter, while the first bound ignores statistically-significant but negligible changes. Heap growth is compared the same way against `Thresholds.relativeMemory`, with `Thresholds.minimumMemoryDelta` as the noise floor. Because heap growth misses blocks that are freed before the measured block ends, the total allocated bytes and allocation count are also compared against `Thresholds.relativeAllocations`, with `Thresholds.minimumMemoryDelta` and `Thresholds.minimumAllocationCountDelta` as their noise floors. Either one growing flags the scenario's allocations as `.regressed`.
+ */
+struct BenchmarkComparison {
+
+    // MARK: Internal
+
+    let entries: [Entry]
+
+    var hasRegressions: Bool {
+
+        return self.entries.contains(where: { $0.time == .regressed || $0.memory == .regressed || $0.allocations == .regressed })
+    }
+
+    init(baseline: BenchmarkReport, current: BenchmarkReport, thresholds: Thresholds) {
+
+        var entries: [Entry] = []
+        for scenario in current.scenarios {
+
+            guard let baselineScenario = baseline.scenario(named: scenario.name) else {
+
+                entries.append(Entry(name: scenario.name, baseline: nil, current: scenario, time: .added, memory: .added, allocations: .added))
+                continue
+            }
+            guard baselineScenario.workloadSize == scenario.workloadSize else {
+
+                entries.append(Entry(name: scenario.name, baseline: baselineScenario, current: scenario, time: .incomparable, memory: .incomparable, allocations: .incomparable))
+                continue
+            }
+            let noise = BenchmarkComparison.madScale
+                * Swift.max(baselineScenario.medianAbsoluteDeviation, scenario.medianAbsoluteDeviation)
+                * thresholds.deviations
+            entries.append(
+                Entry(
+                    name: scenario.name,
+                    baseline: baselineScenario,
+                    current: scenario,
+                    time: BenchmarkComparison.verdict(
+                        baseline: baselineScenario.median,
+                        current: scenario.median,
+                        tolerance: Swift.max(baselineScenario.median * thresholds.relativeTime, noise)
+                    ),
+                    memory: BenchmarkComparison.verdict(
+                        baseline: Double(baselineScenario.mallocBytes),
+                        current: Double(scenario.mallocBytes),
+                        tolerance: Swift.max(
+                            abs(Double(baselineScenario.mallocBytes)) * thresholds.relativeMemory,
+                            Double(thresholds.minimumMemoryDelta)
+                        )
+                    ),
+                    allocations: BenchmarkComparison.allocationsVerdict(
+                        baseline: baselineScenario,
+                        current: scenario,
+                        thresholds: thresholds
+                    )
+                )
+            )
+        }
+        for baselineScenario in baseline.scenarios where current.scenario(named: baselineScenario.name) == nil {
+
+            entries.append(Entry(name: baselineScenario.name, baseline: baselineScenario, current: nil, time: .removed, memory: .removed, allocations: .removed))
+        }
+        self.entries = entries
+    }
+
+    func summary() -> String {
+
+        var lines = ["scenario | time (baseline -> current) | heap growth (baseline -> current) | allocations (baseline -> current) | peak RSS"]
+        for entry in self.entries {
+
+            let time = "\(BenchmarkComparison.format(seconds: entry.baseline?.median)) -> \(BenchmarkComparison.format(seconds: entry.current?.median)) \(BenchmarkComparison.format(change: entry.baseline?.median, entry.current?.median)) [\(entry.time.rawValue)]"
+            let memory = "\(BenchmarkComparison.format(bytes: entry.baseline?.mallocBytes)) -> \(BenchmarkComparison.format(bytes: entry.current?.mallocBytes)) [\(entry.memory.rawValue)]"
+            let allocations = "\(BenchmarkComparison.format(allocationsOf: entry.baseline)) -> \(BenchmarkComparison.format(allocationsOf: entry.current)) [\(entry.allocations.rawValue)]"
+            let peak = BenchmarkComparison.format(bytes: (entry.current?.peakResidentBytes).map({ Int64(clamping: $0) }))
+            lines.append("\(entry.name) | \(time) | \(memory) | \(allocations) | \(peak)")
+        }
+        lines.append(self.hasRegressions ? "FAILED: performance regressions detected." : "PASSED: no performance regressions detected.")
+        return lines.joined(separator: "\n")
+    }
+
+
+    // MARK: - Thresholds
+
+    struct Thresholds {
+
+        // MARK: Internal
+
+        var relativeTime: Double = 0.10
+        var deviations: Double = 3
+        var relativeMemory: Double = 0.25
+        var minimumMemoryDelta: Int64 = 1 << 20
+        var relativeAllocations: Double = 0.25
+        var minimumAllocationCountDelta: Int64 = 1_000
+    }
+
+
+    // MARK: - Verdict
+
+    enum Verdict: String {
+
+        case unchanged
+        case improved
+        case regressed
+        case added
+        case removed
+        case incomparable
+    }
+
+
+    // MARK: - Entry
+
+    struct Entry {
+
+        // MARK: Internal
+
+        let name: String
+        let baseline: BenchmarkReport.Scenario?
+        let current: BenchmarkReport.Scenario?
+        let time: Verdict
+        let memory: Verdict
+        let allocations: Verdict
+    }
+
+
+    // MARK: Private
+
+    // Scales the MAD to be a consistent estimator of the standard deviation for normally-distributed samples
+    private static let madScale: Double = 1.4826
+
+    private static func verdict(baseline: Double, current: Double, tolerance: Double) -> Verdict {
+
+        if current - baseline > tolerance {
+
+            return .regressed
+        }
+        if baseline - current > tolerance {
+
+            return .improved
+        }
+        return .unchanged
+    }
+
+    private static func allocationsVerdict(baseline: BenchmarkReport.Scenario, current: BenchmarkReport.Scenario, thresholds: Thresholds) -> Verdict {
+
+        guard let baselineBytes = baseline.allocatedBytes,
+            let baselineBlocks = baseline.allocatedBlocks,
+            let currentBytes = current.allocatedBytes,
+            let currentBlocks = current.allocatedBlocks else {
+
+            return .incomparable
+        }
+        let verdicts = [
+            BenchmarkComparison.verdict(
+                baseline: Double(baselineBytes),
+                current: Double(currentBytes),
+                tolerance: Swift.max(
+                    Double(baselineBytes) * thresholds.relativeAllocations,
+                    Double(thresholds.minimumMemoryDelta)
+                )
+            ),
+            BenchmarkComparison.verdict(
+                baseline: Double(baselineBlocks),
+                current: Double(currentBlocks),
+                tolerance: Swift.max(
+                    Double(baselineBlocks) * thresholds.relativeAllocations,
+                    Double(thresholds.minimumAllocationCountDelta)
+                )
+            )
+        ]
+        if verdicts.contains(.regressed) {
+
+            return .regressed
+        }
+        if verdicts.contains(.improved) {
+
+            return .improved
+        }
+        return .unchanged
+    }
+
+    private static func format(seconds: Double?) -> String {
+
+        guard let seconds = seconds else {
+
+            return "-"
+        }
+        return String(format: "%.2fms", seconds * 1_000)
+    }
+
+    private static func format(bytes: Int64?) -> String {
+
+        guard let bytes = bytes else {
+
+            return "-"
+        }
+        return ByteCountFormatter.string(fromByteCount: bytes, countStyle: .memory)
+    }
+
+    private static func format(allocationsOf scenario: BenchmarkReport.Scenario?) -> String {
+
+        guard let bytes = scenario?.allocatedBytes, let blocks = scenario?.allocatedBlocks else {
+
+            return "-"
+        }
+        return "\(BenchmarkComparison.format(bytes: bytes)) in \(blocks) blocks"
+    }
+
+    private static func format(change baseline: Double?, _ current: Double?) -> String {
+
+        guard let baseline = baseline, let current = current, baseline > 0 else {
+
+            return ""
+        }
+        return String(format: "(%+.1f%%)", (current - baseline) / baseline * 100)
+    }
+}
@@ -0,0 +1,107 @@
+//
+//  BenchmarkDataGenerator.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+
+
+// MARK: - BenchmarkDataGenerator
+
+/**
+ A seeded SplitMix64 generator. Sequences only depend on the seed, so every run (and every toolchain) produces the exact same workload.
+ */
+struct BenchmarkDataGenerator {
+
+    // MARK: Internal
+
+    static let groups: [String] = (UnicodeScalar("A").value ... UnicodeScalar("Z").value)
+        .map({ String(Character(UnicodeScalar($0)!)) })
+
+    init(seed: UInt64) {
+
+        self.state = seed
+    }
+
+    mutating func next() -> UInt64 {
+
+        self.state &+= 0x9E3779B97F4A7C15
+        var z = self.state
+        z = (z ^ (z >> 30)) &* 0xBF58476D1CE4E5B9
+        z = (z ^ (z >> 27)) &* 0x94D049BB133111EB
+        return z ^ (z >> 31)
+    }
+
+    mutating func nextInt(in range: Range<Int>) -> Int {
+
+        precondition(!range.isEmpty)
+        return range.lowerBound + Int(self.next() % UInt64(range.count))
+    }
+
+    mutating func nextBool() -> Bool {
+
+        return (self.next() & 1) == 1
+    }
+
+    mutating func nextDouble() -> Double {
+
+        return Double(self.next() >> 11) / Double(1 << 53)
+    }
+
+    mutating func makeRecord(id: Int64) -> BenchmarkRecord {
+
+        let number = Int32(self.nextInt(in: 0 ..< 10_000))
+        return BenchmarkRecord(
+            id: id,
+            string: "BenchmarkEntity:\(id):\(self.next() % 1_000_000)",
+            number: number,
+            date: Date(timeIntervalSinceReferenceDate: TimeInterval(self.nextInt(in: 0 ..< 31_536_000))),
+            boolean: self.nextBool(),
+            decimal: (self.nextDouble() * 100_000).rounded() / 100,
+            group: BenchmarkDataGenerator.groups[self.nextInt(in: 0 ..< BenchmarkDataGenerator.groups.count)]
+        )
+    }
+
+    mutating func makeRecords<S: Sequence>(ids: S) -> [BenchmarkRecord] where S.Element == Int64 {
+
+        return ids.map({ self.makeRecord(id: $0) })
+    }
+
+    mutating func shuffle<T>(_ array: inout [T]) {
+
+        // Fisher-Yates with our own generator; the stdlib's shuffle algorithm is not guaranteed stable across versions
+        guard array.count > 1 else {
+
+            return
+        }
+        for index in stride(from: array.count - 1, to: 0, by: -1) {
+
+            array.swapAt(index, self.nextInt(in: 0 ..< (index + 1)))
+        }
+    }
+
+
+    // MARK: Private
+
+    private var state: UInt64
+}
@@ -0,0 +1,189 @@
+//
+//  BenchmarkEntity.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkSchema
+
+/**
+ The model versions used by the benchmarks. The entities mirror the attributes of `TestEntity1` from the unit tests' Xcode model, but are declared as `CoreStoreObject`s so the SwiftPM target does not need to bundle .xcdatamodeld resources.
+ */
+enum BenchmarkSchema {
+
+    // MARK: Internal
+
+    static let v1: ModelVersion = "CoreStoreBenchmarks.V1"
+    static let v2: ModelVersion = "CoreStoreBenchmarks.V2"
+
+    static func makeV1() -> CoreStoreSchema {
+
+        return CoreStoreSchema(
+            modelVersion: BenchmarkSchema.v1,
+            entities: [
+                Entity<BenchmarkEntity>(
+                    "BenchmarkEntity",
+                    indexes: [
+                        [\BenchmarkEntity.$testEntityID],
+                        [\BenchmarkEntity.$testGroup, \BenchmarkEntity.$testNumber]
+                    ]
+                )
+            ]
+        )
+    }
+
+    static func makeV2() -> CoreStoreSchema {
+
+        return CoreStoreSchema(
+            modelVersion: BenchmarkSchema.v2,
+            entities: [
+                Entity<BenchmarkEntityV2>(
+                    "BenchmarkEntity",
+                    indexes: [
+                        [\BenchmarkEntityV2.$testEntityID],
+                        [\BenchmarkEntityV2.$testGroup, \BenchmarkEntityV2.$testNumber]
+                    ]
+                )
+            ]
+        )
+    }
+}
+
+
+// MARK: - BenchmarkRecord
+
+/**
+ A plain import source for `BenchmarkEntity`. Records are created by the `BenchmarkDataGenerator` and are fully determined by its seed.
+ */
+struct BenchmarkRecord {
+
+    // MARK: Internal
+
+    let id: Int64
+    let string: String
+    let number: Int32
+    let date: Date
+    let boolean: Bool
+    let decimal: Double
+    let group: String
+}
+
+
+// MARK: - BenchmarkEntity
+
+final class BenchmarkEntity: CoreStoreObject, ImportableUniqueObject {
+
+    // MARK: Internal
+
+    @Field.Stored("testEntityID")
+    var testEntityID: Int64 = 0
+
+    @Field.Stored("testString")
+    var testString: String = ""
+
+    @Field.Stored("testNumber")
+    var testNumber: Int32 = 0
+
+    @Field.Stored("testDate")
+    var testDate: Date = Date(timeIntervalSinceReferenceDate: 0)
+
+    @Field.Stored("testBoolean")
+    var testBoolean: Bool = false
+
+    @Field.Stored("testDecimal")
+    var testDecimal: Double = 0
+
+    @Field.Stored("testGroup")
+    var testGroup: String = ""
+
+
+    // MARK: ImportableObject
+
+    typealias ImportSource = BenchmarkRecord
+
+
+    // MARK: ImportableUniqueObject
+
+    typealias UniqueIDType = Int64
+
+    static let uniqueIDKeyPath: String = String(keyPath: \BenchmarkEntity.$testEntityID)
+
+    var uniqueIDValue: UniqueIDType {
+
+        get { return self.testEntityID }
+        set { self.testEntityID = newValue }
+    }
+
+    static func uniqueID(from source: ImportSource, in transaction: BaseDataTransaction) throws -> UniqueIDType? {
+
+        return source.id
+    }
+
+    func update(from source: ImportSource, in transaction: BaseDataTransaction) throws {
+
+        self.testString = source.string
+        self.testNumber = source.number
+        self.testDate = source.date
+        self.testBoolean = source.boolean
+        self.testDecimal = source.decimal
+        self.testGroup = source.group
+    }
+}
+
+
+// MARK: - BenchmarkEntityV2
+
+/**
+ The `BenchmarkEntity` as declared in `BenchmarkSchema.v2`. Adds a `testNote` attribute so that V1 stores require a (lightweight) migration.
+ */
+final class BenchmarkEntityV2: CoreStoreObject {
+
+    // MARK: Internal
+
+    @Field.Stored("testEntityID")
+    var testEntityID: Int64 = 0
+
+    @Field.Stored("testString")
+    var testString: String = ""
+
+    @Field.Stored("testNumber")
+    var testNumber: Int32 = 0
+
+    @Field.Stored("testDate")
+    var testDate: Date = Date(timeIntervalSinceReferenceDate: 0)
+
+    @Field.Stored("testBoolean")
+    var testBoolean: Bool = false
+
+    @Field.Stored("testDecimal")
+    var testDecimal: Double = 0
+
+    @Field.Stored("testGroup")
+    var testGroup: String = ""
+
+    @Field.Stored("testNote")
+    var testNote: String = ""
+}
@@ -0,0 +1,224 @@
+//
+//  BenchmarkMemory.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+
+#if canImport(Darwin)
+import Darwin
+
+#endif
+
+
+// MARK: - BenchmarkMemory
+
+/**
+ A point-in-time sample of the process's heap and resident memory.
+ - `mallocBytes` and `mallocBlocks` are the bytes and blocks currently allocated across all malloc zones. The difference between two samples is the net heap growth of the code in between.
+ - `allocatedBytes` and `allocatedBlocks` are the running totals counted by `BenchmarkAllocationCounter`, so the difference between two samples also includes blocks that were freed in between. They are `nil` if the counter could not be installed.
+ - `peakResidentBytes` is the resident-size high-water mark of the whole process, so it only grows during a run. Use `--filter` to run one scenario per process when comparing peaks.
+ */
+struct BenchmarkMemory {
+
+    // MARK: Internal
+
+    let mallocBytes: Int64
+    let mallocBlocks: Int64
+    let allocatedBytes: Int64?
+    let allocatedBlocks: Int64?
+    let residentBytes: UInt64
+    let peakResidentBytes: UInt64
+
+    static func current() -> BenchmarkMemory {
+
+        #if canImport(Darwin)
+
+        var statistics = malloc_statistics_t()
+        malloc_zone_statistics(nil, &statistics)
+
+        var info = task_vm_info_data_t()
+        var count = mach_msg_type_number_t(
+            MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<natural_t>.size
+        )
+        let result = withUnsafeMutablePointer(to: &info) { (pointer) in
+
+            pointer.withMemoryRebound(to: integer_t.self, capacity: Int(count)) { (pointer) in
+
+                task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), pointer, &count)
+            }
+        }
+        let allocations = BenchmarkAllocationCounter.current()
+        return BenchmarkMemory(
+            mallocBytes: Int64(statistics.size_in_use),
+            mallocBlocks: Int64(statistics.blocks_in_use),
+            allocatedBytes: allocations?.bytes,
+            allocatedBlocks: allocations?.blocks,
+            residentBytes: result == KERN_SUCCESS ? UInt64(info.resident_size) : 0,
+            peakResidentBytes: result == KERN_SUCCESS ? UInt64(info.resident_size_peak) : 0
+        )
+
+        #else
+
+        return BenchmarkMemory(
+            mallocBytes: 0,
+            mallocBlocks: 0,
+            allocatedBytes: nil,
+            allocatedBlocks: nil,
+            residentBytes: 0,
+            peakResidentBytes: 0
+        )
+
+        #endif
+    }
+}
+
+
+// MARK: - BenchmarkAllocationCounter
+
+/**
+ Counts every block allocated through the default malloc zone, including blocks that are freed again before the next `BenchmarkMemory` sample. `install()` replaces the zone's allocation functions with counting wrappers that forward to the original ones.
+ */
+enum BenchmarkAllocationCounter {
+
+    // MARK: Internal
+
+    /**
+     Installs the counting wrappers once. Returns `false` if the default zone could not be made writable, in which case `current()` returns `nil`.
+     */
+    @discardableResult
+    static func install() -> Bool {
+
+        return BenchmarkAllocationCounter.isInstalled
+    }
+
+    static func current() -> (blocks: Int64, bytes: Int64)? {
+
+        #if canImport(Darwin)
+
+        guard BenchmarkAllocationCounter.isInstalled else {
+
+            return nil
+        }
+        os_unfair_lock_lock(BenchmarkAllocationCounter.lock)
+        defer {
+
+            os_unfair_lock_unlock(BenchmarkAllocationCounter.lock)
+        }
+        return BenchmarkAllocationCounter.totals.pointee
+
+        #else
+
+        return nil
+
+        #endif
+    }
+
+
+    // MARK: Private
+
+    #if canImport(Darwin)
+
+    // The lock and totals are allocated before the wrappers are installed, so recording never allocates
+    private static let lock: os_unfair_lock_t = {
+
+        let lock = os_unfair_lock_t.allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock())
+        return lock
+    }()
+
+    private static let totals: UnsafeMutablePointer<(blocks: Int64, bytes: Int64)> = {
+
+        let totals = UnsafeMutablePointer<(blocks: Int64, bytes: Int64)>.allocate(capacity: 1)
+        totals.initialize(to: (0, 0))
+        return totals
+    }()
+
+    private static var originalZone = malloc_zone_t()
+
+    private static let isInstalled: Bool = {
+
+        _ = BenchmarkAllocationCounter.lock
+        _ = BenchmarkAllocationCounter.totals
+        guard let zone = malloc_default_zone() else {
+
+            return false
+        }
+        let pageSize = UInt(vm_page_size)
+        let zoneAddress = UInt(bitPattern: zone)
+        let pageAddress = zoneAddress & ~(pageSize - 1)
+        let protectedSize = zoneAddress - pageAddress + UInt(MemoryLayout<malloc_zone_t>.size)
+        guard vm_protect(mach_task_self_, vm_address_t(pageAddress), vm_size_t(protectedSize), 0, VM_PROT_READ | VM_PROT_WRITE) == KERN_SUCCESS else {
+
+            return false
+        }
+        defer {
+
+            vm_protect(mach_task_self_, vm_address_t(pageAddress), vm_size_t(protectedSize), 0, VM_PROT_READ)
+        }
+        BenchmarkAllocationCounter.originalZone = zone.pointee
+        zone.pointee.malloc = { (zone, size) in
+
+            BenchmarkAllocationCounter.record(size)
+            return BenchmarkAllocationCounter.originalZone.malloc(zone, size)
+        }
+        zone.pointee.calloc = { (zone, count, size) in
+
+            BenchmarkAllocationCounter.record(count * size)
+            return BenchmarkAllocationCounter.originalZone.calloc(zone, count, size)
+        }
+        zone.pointee.valloc = { (zone, size) in
+
+            BenchmarkAllocationCounter.record(size)
+            return BenchmarkAllocationCounter.originalZone.valloc(zone, size)
+        }
+        zone.pointee.realloc = { (zone, pointer, size) in
+
+            BenchmarkAllocationCounter.record(size)
+            return BenchmarkAllocationCounter.originalZone.realloc(zone, pointer, size)
+        }
+        if BenchmarkAllocationCounter.originalZone.memalign != nil {
+
+            zone.pointee.memalign = { (zone, alignment, size) in
+
+                BenchmarkAllocationCounter.record(size)
+                return BenchmarkAllocationCounter.originalZone.memalign(zone, alignment, size)
+            }
+        }
+        return true
+    }()
+
+    private static func record(_ size: Int) {
+
+        os_unfair_lock_lock(BenchmarkAllocationCounter.lock)
+        BenchmarkAllocationCounter.totals.pointee.blocks += 1
+        BenchmarkAllocationCounter.totals.pointee.bytes += Int64(size)
+        os_unfair_lock_unlock(BenchmarkAllocationCounter.lock)
+    }
+
+    #else
+
+    private static let isInstalled = false
+
+    #endif
+}
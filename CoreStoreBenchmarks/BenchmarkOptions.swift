@@ -0,0 +1,210 @@
+//
+//  BenchmarkOptions.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+
+
+// MARK: - BenchmarkOptions
+
+/**
+ Command-line options for the `CoreStoreBenchmarks` executable.
+ ```
+ swift run -c release CoreStoreBenchmarks --iterations 10 --scale 1 --output benchmarks.json
+ ```
+ To gate on regressions, record a baseline once with `--output`, commit it, and pass it back with `--baseline`:
+ ```
+ swift run -c release CoreStoreBenchmarks --baseline CoreStoreBenchmarks/Baselines/baseline.json
+ ```
+ */
+struct BenchmarkOptions {
+
+    // MARK: Internal
+
+    static let usage = """
+        USAGE: CoreStoreBenchmarks [options]
+
+        OPTIONS:
+          --iterations <n>   Number of measured iterations per scenario (default: 10)
+          --scale <x>        Multiplier applied to every scenario's workload size (default: 1)
+          --seed <n>         Seed for the deterministic data generator (default: 2021)
+          --filter <text>    Only run scenarios whose name contains <text>
+          --output <path>    Write the JSON report to <path> instead of stdout
+          --baseline <path>  Compare the results against the report at <path> and exit
+                             with a non-zero status if any scenario regressed
+          --compare <path>   Use the report at <path> as the results instead of running
+                             the scenarios (requires --baseline)
+          --time-threshold <x>
+                             Minimum relative change in median time to flag (default: 0.10)
+          --mad-multiplier <x>
+                             Minimum change in median time, in multiples of the
+                             normalized median absolute deviation (default: 3)
+          --memory-threshold <x>
+                             Minimum relative change in heap growth to flag (default: 0.25)
+          --allocation-threshold <x>
+                             Minimum relative change in total allocated bytes or
+                             allocation count to flag (default: 0.25)
+          --track-live-objects
+                             Count live publishers and snapshots (adds some overhead to
+                             the measured time)
+          --list             Print the scenario names and exit
+          --help             Print this message and exit
+        """
+
+    var iterations: Int = 10
+    var scale: Double = 1
+    var seed: UInt64 = 2021
+    var filter: String?
+    var outputPath: String?
+    var baselinePath: String?
+    var comparePath: String?
+    var thresholds = BenchmarkComparison.Thresholds()
+    var tracksLiveObjects: Bool = false
+    var listOnly: Bool = false
+    var showHelp: Bool = false
+
+    init(arguments: [String]) throws {
+
+        var iterator = arguments.makeIterator()
+        func value(for option: String) throws -> String {
+
+            guard let value = iterator.next() else {
+
+                throw BenchmarkOptionsError.missingValue(option: option)
+            }
+            return value
+        }
+        func nonNegativeDouble(for option: String) throws -> Double {
+
+            let rawValue = try value(for: option)
+            guard let value = Double(rawValue), value >= 0 else {
+
+                throw BenchmarkOptionsError.invalidValue(option: option, value: rawValue)
+            }
+            return value
+        }
+        while let argument = iterator.next() {
+
+            switch argument {
+
+            case "--iterations":
+                let rawValue = try value(for: argument)
+                guard let iterations = Int(rawValue), iterations > 0 else {
+
+                    throw BenchmarkOptionsError.invalidValue(option: argument, value: rawValue)
+                }
+                self.iterations = iterations
+
+            case "--scale":
+                let rawValue = try value(for: argument)
+                guard let scale = Double(rawValue), scale > 0 else {
+
+                    throw BenchmarkOptionsError.invalidValue(option: argument, value: rawValue)
+                }
+                self.scale = scale
+
+            case "--seed":
+                let rawValue = try value(for: argument)
+                guard let seed = UInt64(rawValue) else {
+
+                    throw BenchmarkOptionsError.invalidValue(option: argument, value: rawValue)
+                }
+                self.seed = seed
+
+            case "--filter":
+                self.filter = try value(for: argument)
+
+            case "--output":
+                self.outputPath = try value(for: argument)
+
+            case "--baseline":
+                self.baselinePath = try value(for: argument)
+
+            case "--compare":
+                self.comparePath = try value(for: argument)
+
+            case "--time-threshold":
+                self.thresholds.relativeTime = try nonNegativeDouble(for: argument)
+
+            case "--mad-multiplier":
+                self.thresholds.deviations = try nonNegativeDouble(for: argument)
+
+            case "--memory-threshold":
+                self.thresholds.relativeMemory = try nonNegativeDouble(for: argument)
+
+            case "--allocation-threshold":
+                self.thresholds.relativeAllocations = try nonNegativeDouble(for: argument)
+
+            case "--track-live-objects":
+                self.tracksLiveObjects = true
+
+            case "--list":
+                self.listOnly = true
+
+            case "--help", "-h":
+                self.showHelp = true
+
+            default:
+                throw BenchmarkOptionsError.unknownOption(argument)
+            }
+        }
+        if self.comparePath != nil && self.baselinePath == nil {
+
+            throw BenchmarkOptionsError.missingValue(option: "--baseline")
+        }
+    }
+
+    func scaled(_ size: Int) -> Int {
+
+        return Swift.max(1, Int((Double(size) * self.scale).rounded()))
+    }
+}
+
+
+// MARK: - BenchmarkOptionsError
+
+enum BenchmarkOptionsError: Error, CustomStringConvertible {
+
+    case unknownOption(String)
+    case missingValue(option: String)
+    case invalidValue(option: String, value: String)
+
+
+    // MARK: CustomStringConvertible
+
+    var description: String {
+
+        switch self {
+
+        case .unknownOption(let option):
+            return "Unknown option \"\(option)\"."
+
+        case .missingValue(let option):
+            return "Missing value for \"\(option)\"."
+
+        case .invalidValue(let option, let value):
+            return "Invalid value \"\(value)\" for \"\(option)\"."
+        }
+    }
+}
@@ -0,0 +1,234 @@
+//
+//  BenchmarkReport.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkReport
+
+/**
+ The machine-readable output of a benchmark run. Encoded as JSON with sorted keys so that reports can be diffed and tracked over time.
+ */
+struct BenchmarkReport: Codable {
+
+    // MARK: Internal
+
+    static let currentFormatVersion = 3
+
+    let formatVersion: Int
+    let seed: UInt64
+    let scale: Double
+    let iterations: Int
+    let environment: Environment
+    let scenarios: [Scenario]
+
+    static func load(from fileURL: URL) throws -> BenchmarkReport {
+
+        let report = try JSONDecoder().decode(
+            BenchmarkReport.self,
+            from: Data(contentsOf: fileURL)
+        )
+        guard report.formatVersion == BenchmarkReport.currentFormatVersion else {
+
+            throw BenchmarkError.incompatibleReport(
+                path: fileURL.path,
+                formatVersion: report.formatVersion
+            )
+        }
+        return report
+    }
+
+    func encoded() throws -> Data {
+
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        return try encoder.encode(self)
+    }
+
+    func filtered(_ isIncluded: (_ scenarioName: String) -> Bool) -> BenchmarkReport {
+
+        return BenchmarkReport(
+            formatVersion: self.formatVersion,
+            seed: self.seed,
+            scale: self.scale,
+            iterations: self.iterations,
+            environment: self.environment,
+            scenarios: self.scenarios.filter({ isIncluded($0.name) })
+        )
+    }
+
+    func scenario(named name: String) -> Scenario? {
+
+        return self.scenarios.first(where: { $0.name == name })
+    }
+
+
+    // MARK: - Environment
+
+    struct Environment: Codable {
+
+        // MARK: Internal
+
+        let operatingSystem: String
+        let processorCount: Int
+        let physicalMemory: UInt64
+        let date: String
+
+        static func current() -> Environment {
+
+            let processInfo = ProcessInfo.processInfo
+            let formatter = ISO8601DateFormatter()
+            return Environment(
+                operatingSystem: processInfo.operatingSystemVersionString,
+                processorCount: processInfo.activeProcessorCount,
+                physicalMemory: processInfo.physicalMemory,
+                date: formatter.string(from: Date())
+            )
+        }
+    }
+
+
+    // MARK: - Scenario
+
+    /**
+     The aggregated measurements of one scenario. `samples` holds the raw wall-clock seconds of each iteration; `medianAbsoluteDeviation` is the unscaled MAD of those samples. `mallocBytes` and `mallocBlocks` are the medians of the net heap growth during each measured block. `allocatedBytes` and `allocatedBlocks` are the medians of the total allocations during each measured block, including blocks freed before the block ended, and are `nil` if allocations were not counted.
+     */
+    struct Scenario: Codable {
+
+        // MARK: Internal
+
+        let name: String
+        let workloadSize: Int
+        let samples: [Double]
+        let median: Double
+        let medianAbsoluteDeviation: Double
+        let mean: Double
+        let minimum: Double
+        let maximum: Double
+        let mallocBytes: Int64
+        let mallocBlocks: Int64
+        let allocatedBytes: Int64?
+        let allocatedBlocks: Int64?
+        let peakResidentBytes: UInt64
+        let liveObjects: LiveObjects?
+
+        init(name: String, workloadSize: Int, samples: [BenchmarkSample], peakResidentBytes: UInt64, liveObjects: LiveObjects?) {
+
+            let durations = samples.map({ $0.duration })
+            let sorted = durations.sorted()
+            let median = BenchmarkReport.median(of: sorted)
+            self.name = name
+            self.workloadSize = workloadSize
+            self.samples = durations
+            self.median = median
+            self.medianAbsoluteDeviation = BenchmarkReport.median(
+                of: sorted.map({ abs($0 - median) }).sorted()
+            )
+            self.mean = sorted.isEmpty ? 0 : sorted.reduce(0, +) / Double(sorted.count)
+            self.minimum = sorted.first ?? 0
+            self.maximum = sorted.last ?? 0
+            self.mallocBytes = Int64(
+                BenchmarkReport.median(of: samples.map({ Double($0.mallocBytes) }).sorted())
+            )
+            self.mallocBlocks = Int64(
+                BenchmarkReport.median(of: samples.map({ Double($0.mallocBlocks) }).sorted())
+            )
+            let allocatedBytes = samples.compactMap({ $0.allocatedBytes })
+            let allocatedBlocks = samples.compactMap({ $0.allocatedBlocks })
+            self.allocatedBytes = allocatedBytes.isEmpty ? nil : Int64(
+                BenchmarkReport.median(of: allocatedBytes.map(Double.init).sorted())
+            )
+            self.allocatedBlocks = allocatedBlocks.isEmpty ? nil : Int64(
+                BenchmarkReport.median(of: allocatedBlocks.map(Double.init).sorted())
+            )
+            self.peakResidentBytes = peakResidentBytes
+            self.liveObjects = liveObjects
+        }
+    }
+
+
+    // MARK: - LiveObjects
+
+    /**
+     The `DataStack.MemoryStatistics` at the end of the last measured iteration, before tear down. The publisher and snapshot counts are only populated when running with `--track-live-objects`.
+     */
+    struct LiveObjects: Codable {
+
+        // MARK: Internal
+
+        let registeredObjectsInMainContext: Int
+        let registeredObjectsInRootContext: Int
+        let objectPublishers: Int
+        let objectSnapshots: Int
+        let listPublishers: Int
+        let listSnapshots: Int
+
+        init(_ statistics: DataStack.MemoryStatistics) {
+
+            self.registeredObjectsInMainContext = statistics.registeredObjectsInMainContext
+            self.registeredObjectsInRootContext = statistics.registeredObjectsInRootContext
+            self.objectPublishers = statistics.liveObjectPublishers
+            self.objectSnapshots = statistics.liveObjectSnapshots
+            self.listPublishers = statistics.liveListPublishers
+            self.listSnapshots = statistics.liveListSnapshots
+        }
+    }
+
+
+    // MARK: Private
+
+    private static func median(of sorted: [Double]) -> Double {
+
+        guard !sorted.isEmpty else {
+
+            return 0
+        }
+        let middle = sorted.count / 2
+        if sorted.count % 2 == 0 {
+
+            return (sorted[middle - 1] + sorted[middle]) / 2
+        }
+        return sorted[middle]
+    }
+}
+
+
+// MARK: - BenchmarkSample
+
+/**
+ The measurements of a single iteration.
+ */
+struct BenchmarkSample {
+
+    // MARK: Internal
+
+    let duration: Double
+    let mallocBytes: Int64
+    let mallocBlocks: Int64
+    let allocatedBytes: Int64?
+    let allocatedBlocks: Int64?
+    let liveObjects: BenchmarkReport.LiveObjects?
+}
@@ -0,0 +1,118 @@
+//
+//  BenchmarkRunner.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkRunner
+
+struct BenchmarkRunner {
+
+    // MARK: Internal
+
+    let options: BenchmarkOptions
+
+    func run(_ scenarios: [BenchmarkScenario]) throws -> BenchmarkReport {
+
+        if !BenchmarkAllocationCounter.install() {
+
+            BenchmarkRunner.log("Allocation counting is unavailable; only net heap growth will be reported")
+        }
+        var results: [BenchmarkReport.Scenario] = []
+        for scenario in scenarios {
+
+            results.append(try self.run(scenario))
+        }
+        return BenchmarkReport(
+            formatVersion: BenchmarkReport.currentFormatVersion,
+            seed: self.options.seed,
+            scale: self.options.scale,
+            iterations: self.options.iterations,
+            environment: .current(),
+            scenarios: results
+        )
+    }
+
+
+    // MARK: Private
+
+    private func run(_ scenario: BenchmarkScenario) throws -> BenchmarkReport.Scenario {
+
+        BenchmarkRunner.log("Running \"\(scenario.name)\" (\(scenario.workloadSize) items x \(self.options.iterations) iterations)")
+
+        // One untimed warm-up iteration to load the model, SQLite, and lazily-initialized caches
+        try self.measure(scenario, iteration: -1)
+
+        var samples: [BenchmarkSample] = []
+        for iteration in 0 ..< self.options.iterations {
+
+            samples.append(try self.measure(scenario, iteration: iteration))
+        }
+        return BenchmarkReport.Scenario(
+            name: scenario.name,
+            workloadSize: scenario.workloadSize,
+            samples: samples,
+            peakResidentBytes: BenchmarkMemory.current().peakResidentBytes,
+            liveObjects: samples.last?.liveObjects
+        )
+    }
+
+    @discardableResult
+    private func measure(_ scenario: BenchmarkScenario, iteration: Int) throws -> BenchmarkSample {
+
+        // Every iteration starts from the same seed so all samples measure the identical workload
+        var generator = BenchmarkDataGenerator(seed: self.options.seed)
+        let benchmarkIteration = try autoreleasepool {
+
+            try scenario.prepare(&generator)
+        }
+        defer {
+
+            autoreleasepool(invoking: benchmarkIteration.tearDown)
+        }
+        let memoryBefore = BenchmarkMemory.current()
+        let start = DispatchTime.now().uptimeNanoseconds
+        try autoreleasepool {
+
+            try benchmarkIteration.measure()
+        }
+        let end = DispatchTime.now().uptimeNanoseconds
+        let memoryAfter = BenchmarkMemory.current()
+        return BenchmarkSample(
+            duration: Double(end - start) / 1_000_000_000,
+            mallocBytes: memoryAfter.mallocBytes - memoryBefore.mallocBytes,
+            mallocBlocks: memoryAfter.mallocBlocks - memoryBefore.mallocBlocks,
+            allocatedBytes: memoryAfter.allocatedBytes.flatMap({ (after) in memoryBefore.allocatedBytes.map({ after - $0 }) }),
+            allocatedBlocks: memoryAfter.allocatedBlocks.flatMap({ (after) in memoryBefore.allocatedBlocks.map({ after - $0 }) }),
+            liveObjects: benchmarkIteration.dataStack.map({ BenchmarkReport.LiveObjects($0.memoryStatistics()) })
+        )
+    }
+
+    private static func log(_ message: String) {
+
+        FileHandle.standardError.write((message + "\n").data(using: .utf8)!)
+    }
+}
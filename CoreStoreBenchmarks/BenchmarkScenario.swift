@@ -0,0 +1,99 @@
+//
+//  BenchmarkScenario.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkScenario
+
+/**
+ A named, repeatable workload. Each iteration calls `prepare` (not measured) to build a fresh fixture, then measures only the `BenchmarkIteration.measure` closure it returns.
+ */
+struct BenchmarkScenario {
+
+    // MARK: Internal
+
+    let name: String
+    let workloadSize: Int
+    let prepare: (_ generator: inout BenchmarkDataGenerator) throws -> BenchmarkIteration
+
+    init(name: String, workloadSize: Int, prepare: @escaping (_ generator: inout BenchmarkDataGenerator) throws -> BenchmarkIteration) {
+
+        self.name = name
+        self.workloadSize = workloadSize
+        self.prepare = prepare
+    }
+}
+
+
+// MARK: - BenchmarkIteration
+
+/**
+ The fixture for one iteration of a `BenchmarkScenario`. If `dataStack` is set, the runner records its `DataStack.MemoryStatistics` right after `measure` returns.
+ */
+struct BenchmarkIteration {
+
+    // MARK: Internal
+
+    let dataStack: DataStack?
+    let measure: () throws -> Void
+    let tearDown: () -> Void
+
+    init(dataStack: DataStack? = nil, measure: @escaping () throws -> Void, tearDown: @escaping () -> Void = {}) {
+
+        self.dataStack = dataStack
+        self.measure = measure
+        self.tearDown = tearDown
+    }
+}
+
+
+// MARK: - BenchmarkError
+
+enum BenchmarkError: Error, CustomStringConvertible {
+
+    case timedOut(scenario: String)
+    case unexpectedResult(scenario: String, message: String)
+    case incompatibleReport(path: String, formatVersion: Int)
+
+
+    // MARK: CustomStringConvertible
+
+    var description: String {
+
+        switch self {
+
+        case .timedOut(let scenario):
+            return "Scenario \"\(scenario)\" timed out waiting for notifications."
+
+        case .unexpectedResult(let scenario, let message):
+            return "Scenario \"\(scenario)\" produced an unexpected result: \(message)"
+
+        case .incompatibleReport(let path, let formatVersion):
+            return "The report at \"\(path)\" uses format version \(formatVersion), but this runner expects version \(BenchmarkReport.currentFormatVersion). Record a new baseline."
+        }
+    }
+}
@@ -0,0 +1,843 @@
+//
+//  BenchmarkScenarios.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkScenarios
+
+/**
+ The catalog of benchmark workloads. Workload sizes are the defaults for `--scale 1`; all data is produced by `BenchmarkDataGenerator` so results are comparable across runs and machines.
+ */
+enum BenchmarkScenarios {
+
+    // MARK: Internal
+
+    static func all(options: BenchmarkOptions) -> [BenchmarkScenario] {
+
+        var scenarios: [BenchmarkScenario] = [
+            self.bulkInsert(options: options),
+            self.importUniqueObjects(
+                name: "importUniqueObjects.allNew",
+                size: options.scaled(10_000),
+                isExisting: { _ in false }
+            ),
+            self.importUniqueObjects(
+                name: "importUniqueObjects.allExisting",
+                size: options.scaled(10_000),
+                isExisting: { _ in true }
+            ),
+            self.importUniqueObjects(
+                name: "importUniqueObjects.mixed",
+                size: options.scaled(10_000),
+                isExisting: { $0 % 2 == 0 }
+            ),
+            self.filteredFetch(options: options),
+            self.membershipFetch(name: "membershipFetch.1k", size: options.scaled(1_000)),
+            self.membershipFetch(name: "membershipFetch.10k", size: options.scaled(10_000)),
+            self.membershipFetch(name: "membershipFetch.100k", size: options.scaled(100_000)),
+            self.inMemoryFilter(
+                name: "inMemoryFilter.nsPredicate",
+                options: options,
+                usesCompiledClause: false
+            ),
+            self.inMemoryFilter(
+                name: "inMemoryFilter.compiled",
+                options: options,
+                usesCompiledClause: true
+            ),
+            self.pagination(name: "pagination.fetchOffset", options: options, usesKeyset: false),
+            self.pagination(name: "pagination.keyset", options: options, usesKeyset: true),
+            self.clauseConstruction(options: options),
+            self.whereConstruction(options: options),
+            self.queryAttributesGroupBy(options: options),
+            self.parallelReads(
+                name: "parallelReads.readerPool",
+                options: options,
+                usesReaderPool: true
+            ),
+            self.parallelReads(
+                name: "parallelReads.transactions",
+                options: options,
+                usesReaderPool: false
+            )
+        ]
+        #if canImport(UIKit) || canImport(AppKit)
+
+        scenarios.append(self.listPublisherSnapshotDiff(options: options))
+        scenarios.append(
+            self.listPublisherReplaceAll(
+                name: "listPublisher.replaceAll.reload",
+                options: options,
+                policy: .default
+            )
+        )
+        scenarios.append(
+            self.listPublisherReplaceAll(
+                name: "listPublisher.replaceAll.staged",
+                options: options,
+                policy: .disabled
+            )
+        )
+        scenarios.append(self.listSnapshotSectionLookup(options: options))
+
+        #endif
+        scenarios.append(self.objectPublisherFanOut(options: options))
+        scenarios.append(self.migration(options: options))
+        return scenarios
+    }
+
+
+    // MARK: Private
+
+    private static func bulkInsert(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let size = options.scaled(10_000)
+        return BenchmarkScenario(name: "bulkInsert", workloadSize: size) { (generator) in
+
+            let records = generator.makeRecords(ids: 1 ... Int64(size))
+            let stack = try BenchmarkStack()
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    try stack.insert(records)
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    private static func importUniqueObjects(name: String, size: Int, isExisting: @escaping (Int64) -> Bool) -> BenchmarkScenario {
+
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let ids = Array(1 ... Int64(size))
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: ids.filter(isExisting))
+            )
+
+            // Import sources carry fresh values so that existing objects are actually updated
+            var records = generator.makeRecords(ids: ids)
+            generator.shuffle(&records)
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    try stack.dataStack.perform(
+                        synchronous: { (transaction) in
+
+                            _ = try transaction.importUniqueObjects(
+                                Into<BenchmarkEntity>(),
+                                sourceArray: records
+                            )
+                        }
+                    )
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    private static func filteredFetch(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "filteredFetch"
+        let size = options.scaled(20_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    var fetchedCount = 0
+                    for group in BenchmarkDataGenerator.groups {
+
+                        let objects = try stack.dataStack.fetchAll(
+                            From<BenchmarkEntity>()
+                                .where(\BenchmarkEntity.$testGroup == group && \BenchmarkEntity.$testNumber < 5_000)
+                                .orderBy(.ascending(\.$testNumber))
+                        )
+                        for object in objects {
+
+                            // Fire the faults so attribute materialization is part of the measurement
+                            _ = object.testDecimal
+                        }
+                        fetchedCount += objects.count
+                    }
+                    guard fetchedCount > 0 else {
+
+                        throw BenchmarkError.unexpectedResult(scenario: name, message: "No objects matched the filters.")
+                    }
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    /**
+     Fetches objects with a `Where(_:isMemberOf:)` clause over `size` IDs, half of which exist in the store. Lists longer than `CoreStoreDefaults.maximumMembershipListCount` are fetched in slices.
+     */
+    private static func membershipFetch(name: String, size: Int) -> BenchmarkScenario {
+
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            var ids = Array(stride(from: 2, through: 2 * Int64(size), by: 2))
+            generator.shuffle(&ids)
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    let count = try stack.dataStack.fetchCount(
+                        From<BenchmarkEntity>()
+                            .where(ids ~= \BenchmarkEntity.$testEntityID)
+                    )
+                    let objectIDs = try stack.dataStack.fetchObjectIDs(
+                        From<BenchmarkEntity>()
+                            .where(ids ~= \BenchmarkEntity.$testEntityID)
+                    )
+                    guard count == size / 2, objectIDs.count == count else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Expected \(size / 2) matches but counted \(count) and fetched \(objectIDs.count)."
+                        )
+                    }
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    /**
+     Filters objects that are already loaded in the main context, either with `NSPredicate.evaluate(with:)` or with a `Where` clause compiled by `Where.compiled()`.
+     */
+    private static func inMemoryFilter(name: String, options: BenchmarkOptions, usesCompiledClause: Bool) -> BenchmarkScenario {
+
+        let size = options.scaled(20_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            let objects = try stack.dataStack.fetchAll(
+                From<BenchmarkEntity>()
+                    .tweak({ $0.returnsObjectsAsFaults = false })
+            )
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    var matchedCount = 0
+                    for group in BenchmarkDataGenerator.groups {
+
+                        let clause = (\BenchmarkEntity.$testGroup == group && \BenchmarkEntity.$testNumber < 5_000)
+                            || ["a", "b"] ~= \BenchmarkEntity.$testString
+                        if usesCompiledClause {
+
+                            matchedCount += objects.filter(clause.compiled()).count
+                        }
+                        else {
+
+                            let predicate = clause.predicate
+                            matchedCount += objects.filter({ predicate.evaluate(with: $0.cs_toRaw()) }).count
+                        }
+                    }
+                    guard matchedCount > 0 else {
+
+                        throw BenchmarkError.unexpectedResult(scenario: name, message: "No objects matched the filters.")
+                    }
+                },
+                tearDown: {
+
+                    withExtendedLifetime(objects, {})
+                    stack.tearDown()
+                }
+            )
+        }
+    }
+
+    /**
+     Walks through every object in pages of 100, either with a `fetchOffset` per page or with `FetchChainBuilder.page(after:limit:uniqueKey:)`.
+     */
+    private static func pagination(name: String, options: BenchmarkOptions, usesKeyset: Bool) -> BenchmarkScenario {
+
+        let size = options.scaled(20_000)
+        let pageSize = 100
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            let chain = From<BenchmarkEntity>()
+                .orderBy(.ascending(\.$testGroup), .ascending(\.$testNumber), .ascending(\.$testEntityID))
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    var fetchedCount = 0
+                    var cursor: PageCursor<BenchmarkEntity>?
+                    while true {
+
+                        let objects: [BenchmarkEntity]
+                        if usesKeyset {
+
+                            let page = chain.page(after: cursor, limit: pageSize, uniqueKey: .ascending(\.$testEntityID))
+                            objects = try stack.dataStack.fetchAll(page)
+                            cursor = page.cursor(after: objects)
+                        }
+                        else {
+
+                            let offset = fetchedCount
+                            objects = try stack.dataStack.fetchAll(
+                                chain.tweak {
+
+                                    $0.fetchOffset = offset
+                                    $0.fetchLimit = pageSize
+                                }
+                            )
+                        }
+                        fetchedCount += objects.count
+                        if objects.count < pageSize {
+
+                            break
+                        }
+                    }
+                    guard fetchedCount == size else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Expected \(size) objects but paged through \(fetchedCount)."
+                        )
+                    }
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    private static func clauseConstruction(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "clauseConstruction"
+        let size = options.scaled(100_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (_) in
+
+            return BenchmarkIteration(
+                measure: {
+
+                    var predicateCount = 0
+                    for index in 0 ..< size {
+
+                        let whereClause = Where<BenchmarkEntity>(\.$testGroup == "group")
+                            && Where<BenchmarkEntity>(\.$testNumber > Int32(truncatingIfNeeded: index))
+                        let orderBy = OrderBy<BenchmarkEntity>(.ascending(\.$testGroup), .descending(\.$testNumber))
+                        let select = Select<BenchmarkEntity, String>(.attribute(\.$testString))
+                        if !orderBy.sortDescriptors.isEmpty && !select.selectTerms.isEmpty {
+
+                            predicateCount += whereClause.predicate is NSCompoundPredicate ? 1 : 0
+                        }
+                    }
+                    guard predicateCount == size else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Expected \(size) clauses but built \(predicateCount)."
+                        )
+                    }
+                }
+            )
+        }
+    }
+
+    private static func whereConstruction(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "whereConstruction.tenTerms"
+        let size = options.scaled(20_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (_) in
+
+            return BenchmarkIteration(
+                measure: {
+
+                    var termCount = 0
+                    for index in 0 ..< size {
+
+                        let number = Int32(truncatingIfNeeded: index)
+                        let terms: [Where<BenchmarkEntity>] = [
+                            \.$testGroup == "group",
+                            \.$testGroup != "other",
+                            \.$testNumber > number,
+                            \.$testNumber >= number,
+                            \.$testNumber < number + 100,
+                            \.$testNumber <= number + 100,
+                            \.$testNumber != number + 50,
+                            \.$testString == "string",
+                            \.$testString != "other",
+                            [number, number + 1, number + 2] ~= \.$testNumber
+                        ]
+                        let whereClause = terms.combinedByAnd()
+                        termCount += (whereClause.predicate as? NSCompoundPredicate)?.subpredicates.count ?? 0
+                    }
+                    guard termCount == size * 10 else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Expected \(size * 10) terms but built \(termCount)."
+                        )
+                    }
+                }
+            )
+        }
+    }
+
+    private static func queryAttributesGroupBy(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "queryAttributes.groupBy"
+        let size = options.scaled(50_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    let results = try stack.dataStack.queryAttributes(
+                        From<BenchmarkEntity>()
+                            .select(
+                                NSDictionary.self,
+                                .attribute("testGroup"),
+                                .count("testEntityID", as: "count"),
+                                .average("testDecimal", as: "averageDecimal"),
+                                .maximum("testNumber", as: "maximumNumber")
+                            )
+                            .groupBy(GroupBy<BenchmarkEntity>("testGroup"))
+                    )
+                    guard !results.isEmpty else {
+
+                        throw BenchmarkError.unexpectedResult(scenario: name, message: "The query returned no groups.")
+                    }
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    /**
+     Runs the same filtered ID fetches and counts from several background threads at once, either through the `DataStack`'s reader connections or through unsafe transactions, which share the stack's single coordinator.
+     */
+    private static func parallelReads(name: String, options: BenchmarkOptions, usesReaderPool: Bool) -> BenchmarkScenario {
+
+        let size = options.scaled(20_000)
+        let workerCount = 4
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            stack.dataStack.maximumConcurrentReaders = usesReaderPool ? workerCount : 0
+
+            let read = { (source: FetchableSource & QueryableSource, group: String) throws -> Int in
+
+                let objectIDs = try source.fetchObjectIDs(
+                    From<BenchmarkEntity>()
+                        .where(\BenchmarkEntity.$testGroup == group && \BenchmarkEntity.$testNumber < 5_000)
+                        .orderBy(.ascending(\.$testNumber))
+                )
+                let count = try source.queryValue(
+                    From<BenchmarkEntity>()
+                        .select(Int.self, .count(\.$testEntityID))
+                        .where(\BenchmarkEntity.$testGroup == group)
+                )
+                return objectIDs.count + (count ?? 0)
+            }
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    // Keep the main thread out of the workers so that neither path can fall back to the main context
+                    let lock = NSLock()
+                    var readCount = 0
+                    var readError: Error?
+                    let workers = DispatchGroup()
+                    DispatchQueue.global(qos: .userInitiated).async(group: workers) {
+
+                        DispatchQueue.concurrentPerform(iterations: workerCount) { _ in
+
+                            let source: FetchableSource & QueryableSource = usesReaderPool
+                                ? stack.dataStack
+                                : stack.dataStack.beginUnsafe()
+                            do {
+
+                                var workerReadCount = 0
+                                for testGroup in BenchmarkDataGenerator.groups {
+
+                                    workerReadCount += try read(source, testGroup)
+                                }
+                                lock.lock()
+                                readCount += workerReadCount
+                                lock.unlock()
+                            }
+                            catch {
+
+                                lock.lock()
+                                readError = error
+                                lock.unlock()
+                            }
+                        }
+                    }
+                    workers.wait()
+                    if let readError = readError {
+
+                        throw readError
+                    }
+                    guard readCount > 0 else {
+
+                        throw BenchmarkError.unexpectedResult(scenario: name, message: "No objects matched the filters.")
+                    }
+                },
+                tearDown: stack.tearDown
+            )
+        }
+    }
+
+    #if canImport(UIKit) || canImport(AppKit)
+
+    private static func listPublisherSnapshotDiff(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "listPublisher.snapshotDiff"
+        let size = options.scaled(5_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            let listPublisher = stack.dataStack.publishList(
+                From<BenchmarkEntity>()
+                    .sectionBy(\.$testGroup)
+                    .orderBy(.ascending(\.$testGroup), .ascending(\.$testNumber), .ascending(\.$testEntityID))
+            )
+            let adapter = DiffableDataSource.BaseAdapter<BenchmarkEntity, BenchmarkNullTarget>(
+                target: BenchmarkNullTarget(),
+                dataStack: stack.dataStack
+            )
+            adapter.apply(listPublisher.snapshot, animatingDifferences: false)
+
+            // Churn: delete 5%, move 10% (by changing their sort key), and insert 5% new objects
+            let churnCount = Swift.max(1, size / 20)
+            var shuffledIDs = Array(1 ... Int64(size))
+            generator.shuffle(&shuffledIDs)
+            let deletedIDs = Array(shuffledIDs.prefix(churnCount))
+            var updatedNumbers: [Int64: Int32] = [:]
+            for id in shuffledIDs.dropFirst(churnCount).prefix(churnCount * 2) {
+
+                updatedNumbers[id] = Int32(generator.nextInt(in: 0 ..< 10_000))
+            }
+            let insertedRecords = generator.makeRecords(ids: Int64(size + 1) ... Int64(size + churnCount))
+
+            let observer = BenchmarkObserver()
+            var didUpdateSnapshot = false
+            listPublisher.addObserver(observer) { (_) in
+
+                didUpdateSnapshot = true
+            }
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    try stack.dataStack.perform(
+                        synchronous: { (transaction) in
+
+                            transaction.delete(
+                                try transaction.fetchAll(
+                                    From<BenchmarkEntity>()
+                                        .where(deletedIDs ~= \BenchmarkEntity.$testEntityID)
+                                )
+                            )
+                            let updatedObjects = try transaction.fetchAll(
+                                From<BenchmarkEntity>()
+                                    .where(updatedNumbers.keys ~= \BenchmarkEntity.$testEntityID)
+                            )
+                            for object in updatedObjects {
+
+                                object.testNumber = updatedNumbers[object.testEntityID]!
+                            }
+                            for record in insertedRecords {
+
+                                let object = transaction.create(Into<BenchmarkEntity>())
+                                object.testEntityID = record.id
+                                try object.update(from: record, in: transaction)
+                            }
+                        }
+                    )
+                    try BenchmarkStack.runMainLoop(scenario: name) { didUpdateSnapshot }
+                    adapter.apply(listPublisher.snapshot, animatingDifferences: false)
+                },
+                tearDown: {
+
+                    listPublisher.removeObserver(observer)
+                    withExtendedLifetime(adapter, {})
+                    stack.tearDown()
+                }
+            )
+        }
+    }
+
+    private static func listPublisherReplaceAll(name: String, options: BenchmarkOptions, policy: DiffableDataSource.LargeChangesetPolicy) -> BenchmarkScenario {
+
+        let size = options.scaled(5_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            // The two lists have no objects in common, so applying one after the other replaces every item
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size * 2))
+            )
+            let sourcePublisher = stack.dataStack.publishList(
+                From<BenchmarkEntity>()
+                    .sectionBy(\.$testGroup)
+                    .where(\.$testEntityID <= Int64(size))
+                    .orderBy(.ascending(\.$testGroup), .ascending(\.$testEntityID))
+            )
+            let targetPublisher = stack.dataStack.publishList(
+                From<BenchmarkEntity>()
+                    .sectionBy(\.$testGroup)
+                    .where(\.$testEntityID > Int64(size))
+                    .orderBy(.ascending(\.$testGroup), .ascending(\.$testEntityID))
+            )
+            let adapter = DiffableDataSource.BaseAdapter<BenchmarkEntity, BenchmarkNullTarget>(
+                target: BenchmarkNullTarget(),
+                dataStack: stack.dataStack
+            )
+            adapter.largeChangesetPolicy = policy
+            adapter.apply(sourcePublisher.snapshot, animatingDifferences: false)
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    adapter.apply(targetPublisher.snapshot, animatingDifferences: false)
+                    let reloadsData = adapter.lastChangesetEstimate?.reloadsData ?? false
+                    guard reloadsData == (policy != .disabled) else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Expected reloadsData to be \(!reloadsData)."
+                        )
+                    }
+                },
+                tearDown: {
+
+                    withExtendedLifetime((sourcePublisher, targetPublisher, adapter), {})
+                    stack.tearDown()
+                }
+            )
+        }
+    }
+
+    private static func listSnapshotSectionLookup(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "listSnapshot.sectionLookup"
+        let size = options.scaled(5_000)
+        let sectionCount = Swift.max(1, size / 10)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            let listPublisher = stack.dataStack.publishList(
+                From<BenchmarkEntity>()
+                    .orderBy(.ascending(\.$testEntityID))
+            )
+
+            // Regroup into many small sections, similar to an alphabetical contacts list
+            var snapshot = listPublisher.snapshot
+            let itemIDs = snapshot.itemIDs
+            snapshot.deleteSections(withIDs: snapshot.sectionIDs)
+
+            let sectionIDs = (0 ..< sectionCount).map({ String(format: "%05d", $0) })
+            snapshot.appendSections(withIDs: sectionIDs)
+            let itemsPerSection = (itemIDs.count + sectionCount - 1) / sectionCount
+            for (sectionIndex, sectionID) in sectionIDs.enumerated() {
+
+                let start = Swift.min(itemIDs.count, sectionIndex * itemsPerSection)
+                let end = Swift.min(itemIDs.count, start + itemsPerSection)
+                snapshot.appendItems(withIDs: itemIDs[start ..< end], toSectionWithID: sectionID)
+            }
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    // Simulates the per-cell lookups of a table view data source
+                    var visitedItemCount = 0
+                    for (sectionIndex, sectionID) in sectionIDs.enumerated() {
+
+                        let numberOfItems = snapshot.numberOfItems(inSectionIndex: sectionIndex)
+                        for _ in 0 ..< numberOfItems {
+
+                            guard snapshot.indexOfSection(withID: sectionID) == sectionIndex,
+                                snapshot.hasItems(inSectionWithID: sectionID) else {
+
+                                throw BenchmarkError.unexpectedResult(
+                                    scenario: name,
+                                    message: "Section \"\(sectionID)\" was not found at index \(sectionIndex)."
+                                )
+                            }
+                            visitedItemCount += snapshot.numberOfItems(inSectionWithID: sectionID) > 0 ? 1 : 0
+                        }
+                    }
+                    guard visitedItemCount == itemIDs.count else {
+
+                        throw BenchmarkError.unexpectedResult(
+                            scenario: name,
+                            message: "Visited \(visitedItemCount) of \(itemIDs.count) items."
+                        )
+                    }
+                },
+                tearDown: {
+
+                    withExtendedLifetime(listPublisher, {})
+                    stack.tearDown()
+                }
+            )
+        }
+    }
+
+    #endif
+
+    private static func objectPublisherFanOut(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "objectPublisher.fanOut"
+        let size = options.scaled(1_000)
+        let observersPerObject = 4
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let stack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            let objectIDs = try stack.dataStack.fetchObjectIDs(From<BenchmarkEntity>())
+            let objectPublishers = objectIDs.map { (objectID) -> ObjectPublisher<BenchmarkEntity> in
+
+                return stack.dataStack.publishObject(objectID)
+            }
+            var observers: [BenchmarkObserver] = []
+            var notificationCount = 0
+            for objectPublisher in objectPublishers {
+
+                for _ in 0 ..< observersPerObject {
+
+                    let observer = BenchmarkObserver()
+                    objectPublisher.addObserver(observer) { (objectPublisher) in
+
+                        _ = objectPublisher.snapshot
+                        notificationCount += 1
+                    }
+                    observers.append(observer)
+                }
+            }
+            let expectedNotificationCount = objectPublishers.count * observersPerObject
+            return BenchmarkIteration(
+                dataStack: stack.dataStack,
+                measure: {
+
+                    notificationCount = 0
+                    try stack.dataStack.perform(
+                        synchronous: { (transaction) in
+
+                            for object in try transaction.fetchAll(From<BenchmarkEntity>()) {
+
+                                object.testNumber += 1
+                            }
+                        }
+                    )
+                    try BenchmarkStack.runMainLoop(scenario: name) {
+
+                        notificationCount >= expectedNotificationCount
+                    }
+                },
+                tearDown: {
+
+                    for (index, objectPublisher) in objectPublishers.enumerated() {
+
+                        for observer in observers[(index * observersPerObject) ..< ((index + 1) * observersPerObject)] {
+
+                            objectPublisher.removeObserver(observer)
+                        }
+                    }
+                    stack.tearDown()
+                }
+            )
+        }
+    }
+
+    private static func migration(options: BenchmarkOptions) -> BenchmarkScenario {
+
+        let name = "migration.lightweight"
+        let size = options.scaled(20_000)
+        return BenchmarkScenario(name: name, workloadSize: size) { (generator) in
+
+            let sourceStack = try BenchmarkStack(
+                records: generator.makeRecords(ids: 1 ... Int64(size))
+            )
+            sourceStack.dataStack.unsafeRemoveAllPersistentStoresAndWait()
+
+            let dataStack = DataStack(
+                BenchmarkSchema.makeV1(),
+                BenchmarkSchema.makeV2(),
+                migrationChain: [BenchmarkSchema.v1, BenchmarkSchema.v2]
+            )
+            let migratedStack = BenchmarkStack(
+                dataStack: dataStack,
+                directoryURL: sourceStack.directoryURL
+            )
+            return BenchmarkIteration(
+                dataStack: dataStack,
+                measure: {
+
+                    var result: SetupResult<SQLiteStore>?
+                    _ = dataStack.addStorage(
+                        BenchmarkStack.makeStorage(in: migratedStack.directoryURL),
+                        completion: { result = $0 }
+                    )
+                    try BenchmarkStack.runMainLoop(scenario: name) { result != nil }
+                    if case .failure(let error) = result! {
+
+                        throw error
+                    }
+                },
+                tearDown: migratedStack.tearDown
+            )
+        }
+    }
+}
+
+
+// MARK: - BenchmarkObserver
+
+private final class BenchmarkObserver {}
@@ -0,0 +1,164 @@
+//
+//  BenchmarkStack.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - BenchmarkStack
+
+/**
+ A `DataStack` backed by a `SQLiteStore` in a unique temporary directory. Every iteration creates its own `BenchmarkStack` so that no state (row cache, registered objects, file size) leaks between samples.
+ */
+final class BenchmarkStack {
+
+    // MARK: Internal
+
+    let dataStack: DataStack
+    let directoryURL: URL
+
+    static func makeTemporaryDirectory() throws -> URL {
+
+        let directoryURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent("CoreStoreBenchmarks", isDirectory: true)
+            .appendingPathComponent(UUID().uuidString, isDirectory: true)
+        try FileManager.default.createDirectory(
+            at: directoryURL,
+            withIntermediateDirectories: true,
+            attributes: nil
+        )
+        return directoryURL
+    }
+
+    static func makeStorage(in directoryURL: URL) -> SQLiteStore {
+
+        return SQLiteStore(
+            fileURL: directoryURL.appendingPathComponent("Benchmark.sqlite")
+        )
+    }
+
+    init(records: [BenchmarkRecord] = []) throws {
+
+        let directoryURL = try BenchmarkStack.makeTemporaryDirectory()
+        let dataStack = DataStack(BenchmarkSchema.makeV1())
+        try dataStack.addStorageAndWait(BenchmarkStack.makeStorage(in: directoryURL))
+        self.dataStack = dataStack
+        self.directoryURL = directoryURL
+
+        if !records.isEmpty {
+
+            try self.insert(records)
+        }
+    }
+
+    init(dataStack: DataStack, directoryURL: URL) {
+
+        self.dataStack = dataStack
+        self.directoryURL = directoryURL
+    }
+
+    func insert(_ records: [BenchmarkRecord]) throws {
+
+        try self.dataStack.perform(
+            synchronous: { (transaction) in
+
+                for record in records {
+
+                    let object = transaction.create(Into<BenchmarkEntity>())
+                    object.testEntityID = record.id
+                    try object.update(from: record, in: transaction)
+                }
+            }
+        )
+    }
+
+    func tearDown() {
+
+        self.dataStack.unsafeRemoveAllPersistentStoresAndWait()
+        try? FileManager.default.removeItem(at: self.directoryURL)
+    }
+
+
+    // MARK: - Run loop
+
+    /**
+     Spins the main run loop until `condition` returns `true`. `ListPublisher` and `ObjectPublisher` deliver their notifications on the main queue, so scenarios that measure observers need to wait here rather than block the main thread.
+     */
+    static func runMainLoop(scenario: String, timeout: TimeInterval = 60, until condition: () -> Bool) throws {
+
+        let deadline = Date(timeIntervalSinceNow: timeout)
+        while !condition() {
+
+            guard Date() < deadline else {
+
+                throw BenchmarkError.timedOut(scenario: scenario)
+            }
+            _ = RunLoop.main.run(mode: .default, before: Date(timeIntervalSinceNow: 0.001))
+        }
+    }
+}
+
+
+#if canImport(UIKit) || canImport(AppKit)
+
+// MARK: - BenchmarkNullTarget
+
+/**
+ A `DiffableDataSource.Target` that performs no UI work, so that `DiffableDataSource.BaseAdapter.apply(...)` measures only the snapshot diffing and changeset staging.
+ */
+struct BenchmarkNullTarget: DiffableDataSource.Target {
+
+    // MARK: DiffableDataSource.Target
+
+    var shouldSuspendBatchUpdates: Bool {
+
+        return false
+    }
+
+    func deleteSections(at indices: IndexSet, animated: Bool) {}
+
+    func insertSections(at indices: IndexSet, animated: Bool) {}
+
+    func reloadSections(at indices: IndexSet, animated: Bool) {}
+
+    func moveSection(at index: IndexSet.Element, to newIndex: IndexSet.Element, animated: Bool) {}
+
+    func deleteItems(at indexPaths: [IndexPath], animated: Bool) {}
+
+    func insertItems(at indexPaths: [IndexPath], animated: Bool) {}
+
+    func reloadItems(at indexPaths: [IndexPath], animated: Bool) {}
+
+    func moveItem(at indexPath: IndexPath, to newIndexPath: IndexPath, animated: Bool) {}
+
+    func performBatchUpdates(updates: () -> Void, animated: Bool) {
+
+        updates()
+    }
+
+    func reloadData() {}
+}
+
+#endif
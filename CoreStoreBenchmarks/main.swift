@@ -0,0 +1,105 @@
+//
+//  main.swift
+//  CoreStoreBenchmarks
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreStore
+
+
+// MARK: - Entry Point
+
+/**
+ Runs the benchmark scenarios and prints a JSON `BenchmarkReport`. Progress messages go to stderr so stdout can be redirected to a file:
+ ```
+ swift run -c release CoreStoreBenchmarks --iterations 10 > benchmarks.json
+ ```
+ When `--baseline` is given, a per-scenario comparison is printed to stderr and the process exits with a non-zero status if any scenario regressed.
+ */
+do {
+
+    let options = try BenchmarkOptions(arguments: Array(CommandLine.arguments.dropFirst()))
+    if options.showHelp {
+
+        print(BenchmarkOptions.usage)
+        exit(EXIT_SUCCESS)
+    }
+    let scenarios = BenchmarkScenarios.all(options: options).filter { (scenario) in
+
+        guard let filter = options.filter else {
+
+            return true
+        }
+        return scenario.name.contains(filter)
+    }
+    if options.listOnly {
+
+        scenarios.forEach({ print($0.name) })
+        exit(EXIT_SUCCESS)
+    }
+    CoreStoreDefaults.tracksLiveObjects = options.tracksLiveObjects
+    let report: BenchmarkReport
+    if let comparePath = options.comparePath {
+
+        report = try BenchmarkReport.load(from: URL(fileURLWithPath: comparePath))
+    }
+    else {
+
+        report = try BenchmarkRunner(options: options).run(scenarios)
+        let data = try report.encoded()
+        if let outputPath = options.outputPath {
+
+            try data.write(to: URL(fileURLWithPath: outputPath), options: .atomic)
+        }
+        else {
+
+            FileHandle.standardOutput.write(data)
+            FileHandle.standardOutput.write("\n".data(using: .utf8)!)
+        }
+    }
+    if let baselinePath = options.baselinePath {
+
+        let baseline = try BenchmarkReport.load(from: URL(fileURLWithPath: baselinePath))
+        let scenarioNames = Set(scenarios.map({ $0.name }))
+        let comparison = BenchmarkComparison(
+            baseline: baseline.filtered(scenarioNames.contains),
+            current: report.filtered(scenarioNames.contains),
+            thresholds: options.thresholds
+        )
+        FileHandle.standardError.write((comparison.summary() + "\n").data(using: .utf8)!)
+        if comparison.hasRegressions {
+
+            exit(EXIT_FAILURE)
+        }
+    }
+}
+catch let error as BenchmarkOptionsError {
+
+    FileHandle.standardError.write("\(error)\n\n\(BenchmarkOptions.usage)\n".data(using: .utf8)!)
+    exit(EXIT_FAILURE)
+}
+catch {
+
+    FileHandle.standardError.write("Benchmark failed: \(error)\n".data(using: .utf8)!)
+    exit(EXIT_FAILURE)
+}
@@ -0,0 +1,164 @@
+//
+//  ChangeFeedTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - ChangeFeedTests
+
+class ChangeFeedTests: BaseTestCase {
+
+    @objc
+    dynamic func test_ThatChangeFeeds_ReadCommittedChangesInOrder() {
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let storage = SQLiteStore(
+            fileURL: SQLiteStore.defaultRootDirectory
+                .appendingPathComponent(UUID().uuidString)
+                .appendingPathComponent("\(Self.self).sqlite"),
+            configuration: "Config1",
+            localStorageOptions: .recreateStoreOnModelMismatch
+        )
+        storage.tracksPersistentHistory = true
+        do {
+
+            try stack.addStorageAndWait(storage)
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    for index in 1 ... 3 {
+
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: index)
+                        object.testString = "initial:\(index)"
+                    }
+                }
+            )
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    let objects = try transaction.fetchAll(
+                        From<TestEntity1>("Config1"),
+                        OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                    )
+                    objects[0].testString = "updated:1"
+                    transaction.delete(objects[2])
+                }
+            )
+
+            let changes = try stack.fetchChanges()
+            XCTAssertEqual(changes.map({ $0.operation }), [.insert, .insert, .insert, .update, .delete])
+            XCTAssertEqual(changes.map({ $0.sequence }), changes.map({ $0.sequence }).sorted())
+            XCTAssertEqual(Set(changes.map({ $0.sequence })).count, 5)
+            XCTAssertTrue(changes.allSatisfy({ $0.entityName == "TestEntity1AAA" }))
+            XCTAssertEqual(changes[3].changedKeys, [#keyPath(TestEntity1.testString)])
+            XCTAssertTrue(changes[0].changedKeys.isEmpty)
+
+            let firstPage = try stack.fetchChanges(limit: 2)
+            XCTAssertEqual(firstPage.map({ $0.sequence }), changes.prefix(2).map({ $0.sequence }))
+
+            let encodedCursor = try JSONEncoder().encode(firstPage[1].cursor)
+            let cursor = try JSONDecoder().decode(DataStack.ChangeCursor.self, from: encodedCursor)
+            XCTAssertEqual(cursor, firstPage[1].cursor)
+
+            let remainingChanges = try stack.fetchChanges(after: cursor)
+            XCTAssertEqual(remainingChanges.map({ $0.sequence }), changes.dropFirst(2).map({ $0.sequence }))
+            XCTAssertTrue(try stack.fetchChanges(after: changes[4].cursor).isEmpty)
+
+            try stack.compactChanges(before: changes[2].cursor)
+            XCTAssertEqual(
+                try stack.fetchChanges().suffix(2).map({ $0.sequence }),
+                changes.suffix(2).map({ $0.sequence })
+            )
+            XCTAssertLessThanOrEqual(try stack.fetchChanges().count, 3)
+            XCTAssertEqual(
+                try stack.fetchChanges(after: changes[3].cursor).map({ $0.operation }),
+                [.delete]
+            )
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatChangeFeeds_LimitChangesAcrossTransactions() {
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let storage = SQLiteStore(
+            fileURL: SQLiteStore.defaultRootDirectory
+                .appendingPathComponent(UUID().uuidString)
+                .appendingPathComponent("\(Self.self).sqlite"),
+            configuration: "Config1",
+            localStorageOptions: .recreateStoreOnModelMismatch
+        )
+        storage.tracksPersistentHistory = true
+        do {
+
+            try stack.addStorageAndWait(storage)
+            for index in 1 ... 6 {
+
+                try stack.perform(
+                    synchronous: { (transaction) in
+
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: index)
+                    }
+                )
+            }
+            let changes = try stack.fetchChanges()
+            XCTAssertEqual(changes.count, 6)
+
+            var cursor = DataStack.ChangeCursor.start
+            var pagedSequences: [Int64] = []
+            while true {
+
+                let page = try stack.fetchChanges(after: cursor, limit: 4)
+                guard let lastChange = page.last else {
+
+                    break
+                }
+                XCTAssertLessThanOrEqual(page.count, 4)
+                pagedSequences.append(contentsOf: page.map({ $0.sequence }))
+                cursor = lastChange.cursor
+            }
+            XCTAssertEqual(pagedSequences, changes.map({ $0.sequence }))
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+        }
+    }
+}
@@ -0,0 +1,96 @@
+//
+//  CompiledWhereTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - CompiledWhereTests
+
+class CompiledWhereTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatCompiledWhereClauses_MatchPredicateEvaluation() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            let objects = try stack.fetchAll(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(objects.count, 5)
+
+            let date = self.dateFormatter.date(from: "2000-01-03T00:00:00Z")!
+            let nativeClauses: [Where<TestEntity1>] = [
+                Where<TestEntity1>(),
+                Where<TestEntity1>(false),
+                Where<TestEntity1>("%K > %@", #keyPath(TestEntity1.testNumber), 2),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isMemberOf: [101, 103, 999]),
+                !Where<TestEntity1>(#keyPath(TestEntity1.testBoolean), isEqualTo: true)
+                    && Where<TestEntity1>("%K <= %@", #keyPath(TestEntity1.testDate), date as NSDate),
+                Where<TestEntity1>(#keyPath(TestEntity1.testString), isEqualTo: nil)
+                    || Where<TestEntity1>(#keyPath(TestEntity1.testString), isEqualTo: "nil:TestEntity1:5"),
+                Where<TestEntity1>("%K != %@", #keyPath(TestEntity1.testDecimal), NSDecimalNumber(string: "4"))
+            ]
+            let fallbackClauses: [Where<TestEntity1>] = [
+                Where<TestEntity1>("%K BEGINSWITH[c] %@", #keyPath(TestEntity1.testString), "NIL:TESTENTITY1:1"),
+                Where<TestEntity1>("%K < %@", #keyPath(TestEntity1.testNumber), 3)
+                    || Where<TestEntity1>("%K CONTAINS %@", #keyPath(TestEntity1.testString), "5")
+            ]
+            for clause in nativeClauses + fallbackClauses {
+
+                let compiled = clause.compiled()
+                XCTAssertEqual(
+                    objects.filter(compiled).map({ $0.testEntityID?.intValue }),
+                    objects.filter({ clause.predicate.evaluate(with: $0) }).map({ $0.testEntityID?.intValue }),
+                    clause.predicate.predicateFormat
+                )
+            }
+            XCTAssertTrue(nativeClauses.allSatisfy({ $0.compiled().isNative }))
+            XCTAssertTrue(fallbackClauses.allSatisfy({ !$0.compiled().isNative }))
+
+            let clause = Where<TestEntity1>("%K > %@", #keyPath(TestEntity1.testNumber), 3)
+            XCTAssertEqual(objects.filter(clause).map({ $0.testEntityID?.intValue }), [104, 105])
+            XCTAssertTrue(clause.compiled()(objects[4]))
+
+            let snapshots = objects.compactMap({ $0.asSnapshot() })
+            XCTAssertEqual(
+                snapshots.filter(clause.compiled()).map({ $0.dictionaryForValues()[#keyPath(TestEntity1.testEntityID)] as? Int }),
+                [104, 105]
+            )
+            let listPublisher = stack.publishList(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(
+                listPublisher.snapshot.filter(clause.compiled()).compactMap({ $0.object?.testEntityID?.intValue }),
+                [104, 105]
+            )
+        }
+    }
+}
@@ -0,0 +1,250 @@
+//
+//  DiffableDataSourceSnapshotTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import CoreData
+import XCTest
+
+@testable
+import CoreStore
+
+
+#if canImport(UIKit) || canImport(AppKit)
+
+// MARK: - DiffableDataSourceSnapshotTests
+
+class DiffableDataSourceSnapshotTests: BaseTestCase {
+
+    typealias Item = Internals.DiffableDataSourceSnapshot.Item
+    typealias ItemList = Internals.DiffableDataSourceSnapshot.ItemList
+
+    @objc
+    dynamic func test_ThatItemLists_BehaveLikeArrays() {
+
+        self.prepareStack { (stack) in
+
+            let objectIDs = try self.prepareObjectIDs(count: 1_000, in: stack)
+
+            var expectedItems = objectIDs.prefix(500).map({ Item(differenceIdentifier: $0) })
+            var itemList = ItemList(expectedItems)
+            let originalItems = expectedItems
+            let originalItemList = itemList
+
+            for (offset, objectID) in objectIDs.dropFirst(500).enumerated() {
+
+                let insertIndex = (offset * 7_919) % (expectedItems.count + 1)
+                expectedItems.insert(Item(differenceIdentifier: objectID), at: insertIndex)
+                itemList.insert(Item(differenceIdentifier: objectID), at: insertIndex)
+
+                if offset % 3 == 0 {
+
+                    let removeIndex = (offset * 104_729) % expectedItems.count
+                    XCTAssertEqual(itemList.remove(at: removeIndex), expectedItems.remove(at: removeIndex))
+                }
+            }
+            XCTAssertEqual(itemList.count, expectedItems.count)
+            XCTAssertEqual(Array(itemList), expectedItems)
+            for index in stride(from: 0, to: expectedItems.count, by: 37) {
+
+                XCTAssertEqual(itemList[index], expectedItems[index])
+            }
+
+            itemList[10].isReloaded = true
+            expectedItems[10].isReloaded = true
+            XCTAssertEqual(Array(itemList), expectedItems)
+
+            itemList.removeSubrange(100 ..< 400)
+            expectedItems.removeSubrange(100 ..< 400)
+            XCTAssertEqual(Array(itemList), expectedItems)
+            XCTAssertEqual(Array(itemList[50 ..< 150]), Array(expectedItems[50 ..< 150]))
+
+            XCTAssertEqual(Array(originalItemList), originalItems)
+            XCTAssertNotEqual(originalItemList, itemList)
+
+            itemList.removeAll()
+            XCTAssertTrue(itemList.isEmpty)
+            XCTAssertEqual(originalItemList.count, 500)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatItemLists_ReplaceRangesInBulk() {
+
+        self.prepareStack { (stack) in
+
+            let objectIDs = try self.prepareObjectIDs(count: 3_000, in: stack)
+            let items = objectIDs.map({ Item(differenceIdentifier: $0) })
+
+            var expectedItems = Array(items.prefix(1_000))
+            var itemList = ItemList(expectedItems)
+            let originalItemList = itemList
+            var nextItemIndex = 1_000
+
+            for offset in 0 ..< 40 {
+
+                let lowerBound = (offset * 7_919) % (expectedItems.count + 1)
+                let upperBound = Swift.min(expectedItems.count, lowerBound + (offset * 104_729) % 150)
+                let newItemsCount = Swift.min(items.count - nextItemIndex, (offset * 31) % 120)
+                let newItems = items[nextItemIndex ..< (nextItemIndex + newItemsCount)]
+                nextItemIndex += newItemsCount
+
+                expectedItems.replaceSubrange(lowerBound ..< upperBound, with: newItems)
+                itemList.replaceSubrange(lowerBound ..< upperBound, with: newItems)
+                XCTAssertEqual(itemList.count, expectedItems.count)
+            }
+            XCTAssertEqual(Array(itemList), expectedItems)
+            XCTAssertEqual(Array(originalItemList), Array(items.prefix(1_000)))
+
+            for index in stride(from: 0, to: expectedItems.count, by: 13) {
+
+                XCTAssertEqual(itemList[index], expectedItems[index])
+                XCTAssertEqual(itemList.index(ofItem: expectedItems[index].differenceIdentifier), index)
+            }
+            itemList.remove(at: 0)
+            XCTAssertNil(itemList.index(ofItem: expectedItems[0].differenceIdentifier))
+            XCTAssertEqual(itemList.index(ofItem: expectedItems[1].differenceIdentifier), 0)
+
+            itemList.replaceSubrange(0 ..< itemList.count, with: items.prefix(10))
+            XCTAssertEqual(Array(itemList), Array(items.prefix(10)))
+        }
+    }
+
+    @objc
+    dynamic func test_ThatItemIndices_StayCorrectAcrossMutations() {
+
+        self.prepareStack { (stack) in
+
+            let objectIDs = try self.prepareObjectIDs(count: 600, in: stack)
+            let items = objectIDs.map({ Item(differenceIdentifier: $0) })
+
+            var expectedItems = Array(items.prefix(400))
+            var itemList = ItemList(expectedItems)
+            XCTAssertEqual(itemList.index(ofItem: expectedItems[399].differenceIdentifier), 399)
+
+            let originalItemList = itemList
+            for offset in 0 ..< 200 {
+
+                switch offset % 4 {
+
+                case 0:
+                    let index = (offset * 7_919) % (expectedItems.count + 1)
+                    expectedItems.insert(items[400 + offset], at: index)
+                    itemList.insert(items[400 + offset], at: index)
+
+                case 1:
+                    let index = (offset * 104_729) % expectedItems.count
+                    XCTAssertEqual(itemList.remove(at: index), expectedItems.remove(at: index))
+
+                case 2:
+                    let index = (offset * 31) % expectedItems.count
+                    expectedItems[index] = items[400 + offset]
+                    itemList[index] = items[400 + offset]
+
+                default:
+                    let lowerBound = (offset * 13) % expectedItems.count
+                    let upperBound = Swift.min(expectedItems.count, lowerBound + 3)
+                    let newItems = [items[400 + offset]]
+                    expectedItems.replaceSubrange(lowerBound ..< upperBound, with: newItems)
+                    itemList.replaceSubrange(lowerBound ..< upperBound, with: newItems)
+                }
+                let probe = expectedItems[(offset * 17) % expectedItems.count]
+                XCTAssertEqual(
+                    itemList.index(ofItem: probe.differenceIdentifier),
+                    expectedItems.firstIndex(of: probe)
+                )
+            }
+            for (index, item) in expectedItems.enumerated() {
+
+                XCTAssertEqual(itemList.index(ofItem: item.differenceIdentifier), index)
+            }
+            for (index, item) in items.prefix(400).enumerated() {
+
+                XCTAssertEqual(originalItemList.index(ofItem: item.differenceIdentifier), index)
+            }
+        }
+    }
+
+    @objc
+    dynamic func test_ThatSectionIndices_AreRebuiltAfterMutations() {
+
+        self.prepareStack { (stack) in
+
+            let objectIDs = try self.prepareObjectIDs(count: 1_000, in: stack)
+            let sectionIDs = (0 ..< 500).map({ String(format: "%03d", $0) })
+
+            var snapshot = Internals.DiffableDataSourceSnapshot()
+            snapshot.appendSections(sectionIDs)
+            for (sectionIndex, sectionID) in sectionIDs.enumerated() {
+
+                snapshot.appendItems(objectIDs[(sectionIndex * 2) ..< (sectionIndex * 2 + 2)], toSection: sectionID)
+            }
+            for (sectionIndex, sectionID) in sectionIDs.enumerated() {
+
+                XCTAssertEqual(snapshot.indexOfSection(sectionID), sectionIndex)
+                XCTAssertEqual(snapshot.numberOfItems(inSection: sectionID), 2)
+            }
+            XCTAssertNil(snapshot.indexOfSection("missing"))
+            XCTAssertEqual(snapshot.itemIdentifier(atSectionIndex: 10, itemIndex: 1), objectIDs[21])
+            XCTAssertNil(snapshot.itemIdentifier(atSectionIndex: 10, itemIndex: 2))
+            XCTAssertNil(snapshot.itemIdentifier(atSectionIndex: 500, itemIndex: 0))
+
+            let originalSnapshot = snapshot
+            snapshot.deleteSections(["000"])
+            snapshot.moveSection("499", beforeSection: "001")
+
+            XCTAssertEqual(snapshot.indexOfSection("499"), 0)
+            XCTAssertEqual(snapshot.indexOfSection("001"), 1)
+            XCTAssertEqual(snapshot.indexOfSection("498"), 498)
+            XCTAssertNil(snapshot.indexOfSection("000"))
+
+            XCTAssertEqual(originalSnapshot.indexOfSection("000"), 0)
+            XCTAssertEqual(originalSnapshot.indexOfSection("499"), 499)
+        }
+    }
+
+
+
+    // MARK: Private
+
+    @nonobjc
+    private func prepareObjectIDs(count: Int, in stack: DataStack) throws -> [NSManagedObjectID] {
+
+        try stack.perform(
+            synchronous: { (transaction) in
+
+                for index in 0 ..< count {
+
+                    let object = transaction.create(Into<TestEntity1>())
+                    object.testEntityID = NSNumber(value: index)
+                }
+            }
+        )
+        return try stack.fetchObjectIDs(
+            From<TestEntity1>(),
+            OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+        )
+    }
+}
+
+#endif
@@ -508,6 +508,68 @@ class DynamicModelTests: BaseTestDataTestCase {
         XCTAssertEqual(String(keyPath: \Dog.$species), "species")
     }
     
+    @objc
+    dynamic func test_ThatCompiledWhereClauses_MatchPredicatesOnCoreStoreObjects() {
+
+        let dataStack = DataStack(
+            CoreStoreSchema(
+                modelVersion: "V1",
+                entities: [
+                    Entity<Animal>("Animal"),
+                    Entity<Dog>("Dog"),
+                    Entity<Person>("Person")
+                ]
+            )
+        )
+        self.prepareStack(dataStack) { (stack) in
+
+            do {
+
+                try stack.perform(
+                    synchronous: { (transaction) in
+
+                        let person = transaction.create(Into<Person>())
+                        person.name = "John"
+                        for species in ["Sparrow", "Swift", "Robin", "Swift"] {
+
+                            let animal = transaction.create(Into<Animal>())
+                            animal.species = species
+                            animal.master = species == "Swift" ? person : nil
+                        }
+                    }
+                )
+                let animals = try stack.fetchAll(From<Animal>().orderBy(.ascending({ $0.$species })))
+                let clauses: [Where<Animal>] = [
+                    \.$species == "Swift",
+                    \.$species > "Robin",
+                    (\.$master ~ \.$name) == "John",
+                    (\.$master ~ \.$name) != "John" && \.$species != "Sparrow"
+                ]
+                for clause in clauses {
+
+                    let compiled = clause.compiled()
+                    XCTAssertTrue(compiled.isNative, clause.predicate.predicateFormat)
+                    XCTAssertEqual(
+                        animals.filter(compiled).map({ $0.species }),
+                        animals.filter({ clause.predicate.evaluate(with: $0.cs_toRaw()) }).map({ $0.species }),
+                        clause.predicate.predicateFormat
+                    )
+                }
+                XCTAssertEqual(
+                    animals.filter((\Animal.$master ~ \.$name) == "John").map({ $0.species }),
+                    ["Swift", "Swift"]
+                )
+            }
+            catch {
+
+                XCTFail()
+            }
+        }
+        self.addTeardownBlock {
+            dataStack.unsafeRemoveAllPersistentStoresAndWait()
+        }
+    }
+    
     @nonobjc
     func prepareStack(_ dataStack: DataStack, configurations: [ModelConfiguration] = [nil], _ closure: (_ dataStack: DataStack) -> Void) {
         
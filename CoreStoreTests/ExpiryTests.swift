@@ -0,0 +1,139 @@
+//
+//  ExpiryTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - ExpiryTests
+
+class ExpiryTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatExpiryPolicies_PurgeExpiredObjectsInBatches() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    for object in try transaction.fetchAll(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>("%K IN %@", #keyPath(TestEntity1.testEntityID), [101, 102])
+                    ) {
+
+                        object.testDate = Date()
+                    }
+                }
+            )
+            guard let expiredObject = try stack.fetchOne(
+                From<TestEntity1>(),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 103)) else {
+
+                XCTFail()
+                return
+            }
+            let objectPublisher = stack.publishObject(expiredObject)
+            XCTAssertNotNil(objectPublisher.snapshot)
+
+            let deleteExpectation = self.expectation(description: "delete")
+            objectPublisher.addObserver(self) { (objectPublisher) in
+
+                XCTAssertNil(objectPublisher.snapshot)
+                deleteExpectation.fulfill()
+            }
+
+            let reportExpectation = self.expectation(description: "report")
+            stack.expiryPolicy = DataStack.ExpiryPolicy(
+                rules: [
+                    .entity(From<TestEntity1>(), expiresAfter: 24 * 60 * 60, since: #keyPath(TestEntity1.testDate))
+                ],
+                batchSize: 2,
+                reportHandler: { (report) in
+
+                    XCTAssertTrue(Thread.isMainThread)
+                    XCTAssertEqual(report.purgedObjectCounts, ["TestEntity1AAA": 3])
+                    reportExpectation.fulfill()
+                }
+            )
+            let purgeExpectation = self.expectation(description: "purge")
+            stack.purgeExpiredObjects { (report) in
+
+                XCTAssertEqual(report.purgedObjectCount, 3)
+                XCTAssertEqual(report.batchCount, 2)
+                XCTAssertTrue(report.errors.isEmpty)
+                XCTAssertEqual(
+                    try stack.fetchAll(
+                        From<TestEntity1>(),
+                        OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                    ).map({ $0.testEntityID?.intValue }),
+                    [101, 102]
+                )
+                XCTAssertEqual(try stack.fetchCount(From<TestEntity2>()), 5)
+                purgeExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            objectPublisher.removeObserver(self)
+            stack.expiryPolicy = nil
+        }
+    }
+
+    @objc
+    dynamic func test_ThatExpiryPurges_SignalChangeSequences() {
+
+        guard #available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *) else {
+
+            return
+        }
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let saveSignal = Internals.ContextSaveSignal(dataStack: stack)
+            let generation = saveSignal.generation
+
+            stack.expiryPolicy = DataStack.ExpiryPolicy(
+                rules: [
+                    .entity(From<TestEntity1>(), expiresAfter: 24 * 60 * 60, since: #keyPath(TestEntity1.testDate))
+                ],
+                batchSize: 2
+            )
+            let purgeExpectation = self.expectation(description: "purge")
+            stack.purgeExpiredObjects { (report) in
+
+                XCTAssertEqual(report.purgedObjectCount, 5)
+                XCTAssertGreaterThan(saveSignal.generation, generation)
+                purgeExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            stack.expiryPolicy = nil
+        }
+    }
+}
@@ -0,0 +1,268 @@
+//
+//  FullTextSearchTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - FullTextSearchTests
+
+class FullTextSearchTests: BaseTestCase {
+
+    @objc
+    dynamic func test_ThatFullTextIndexes_TrackSavedObjects() {
+
+        let fileURL = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("\(Self.self).sqlite")
+        do {
+
+            let unindexedStack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try unindexedStack.addStorageAndWait(
+                SQLiteStore(fileURL: fileURL, configuration: "Config1")
+            )
+            try unindexedStack.perform(
+                synchronous: { (transaction) in
+
+                    for (index, text) in ["Grocery list for the weekend", "Meeting notes", "Crème brûlée recipe"].enumerated() {
+
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: index + 1)
+                        object.testString = text
+                    }
+                }
+            )
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+            return
+        }
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let storage = SQLiteStore(fileURL: fileURL, configuration: "Config1")
+        storage.fullTextIndexes = [
+            .entity(From<TestEntity1>(), #keyPath(TestEntity1.testString))
+        ]
+        do {
+
+            try stack.addStorageAndWait(storage)
+            stack.fullTextIndexer.waitUntilRebuilt()
+
+            let rebuiltMatches = try stack.fetchFullTextMatches(From<TestEntity1>(), matching: "creme")
+            XCTAssertEqual(rebuiltMatches.map({ $0.testEntityID?.intValue }), [3])
+
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    let object = transaction.create(Into<TestEntity1>("Config1"))
+                    object.testEntityID = 4
+                    object.testString = "Grocery budget"
+
+                    let meetingNotes = try transaction.fetchOne(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 2)
+                    )
+                    meetingNotes?.testString = "Meeting agenda"
+                }
+            )
+            XCTAssertEqual(
+                Set(try stack.fetchFullTextMatches(From<TestEntity1>(), matching: "groc").map({ $0.testEntityID?.intValue })),
+                [1, 4]
+            )
+            XCTAssertEqual(
+                try stack.fetchFullTextMatches(From<TestEntity1>(), matching: "grocery WEEKEND").map({ $0.testEntityID?.intValue }),
+                [1]
+            )
+            XCTAssertTrue(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "notes").isEmpty)
+            XCTAssertEqual(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "agenda").count, 1)
+
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    _ = try transaction.deleteAll(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 4)
+                    )
+                }
+            )
+            XCTAssertEqual(
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    try .matches(fullText: "grocery", in: stack)
+                ).map({ $0.testEntityID?.intValue }),
+                [1]
+            )
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatFullTextIndexes_CatchUpWithMissedSaves() {
+
+        let fileURL = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("\(Self.self).sqlite")
+        func indexedStorage() -> SQLiteStore {
+
+            let storage = SQLiteStore(fileURL: fileURL, configuration: "Config1")
+            storage.fullTextIndexes = [
+                .entity(From<TestEntity1>(), #keyPath(TestEntity1.testString))
+            ]
+            return storage
+        }
+        do {
+
+            let indexedStack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try indexedStack.addStorageAndWait(indexedStorage())
+            try indexedStack.perform(
+                synchronous: { (transaction) in
+
+                    let object = transaction.create(Into<TestEntity1>("Config1"))
+                    object.testEntityID = 1
+                    object.testString = "Grocery list"
+                }
+            )
+            XCTAssertEqual(try indexedStack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "grocery").count, 1)
+            indexedStack.unsafeRemoveAllPersistentStoresAndWait()
+
+            // Simulates a save whose index update was lost, such as when the app is terminated right after saving
+            let unindexedStack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            let unindexedStorage = try unindexedStack.addStorageAndWait(
+                SQLiteStore(fileURL: fileURL, configuration: "Config1")
+            )
+            try unindexedStack.perform(
+                synchronous: { (transaction) in
+
+                    let object = try transaction.fetchOne(From<TestEntity1>())
+                    object?.testString = "Sourdough recipe"
+
+                    let coordinator = unindexedStack.coordinator
+                    let store = coordinator.persistentStores.first(where: { $0.storageInterface === unindexedStorage })!
+                    var metadata = coordinator.metadata(for: store)
+                    let generation = (metadata["CoreStoreFullTextIndexGeneration"] as? NSNumber)?.int64Value ?? 0
+                    metadata["CoreStoreFullTextIndexGeneration"] = NSNumber(value: generation + 1)
+                    coordinator.setMetadata(metadata, for: store)
+                }
+            )
+            unindexedStack.unsafeRemoveAllPersistentStoresAndWait()
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+            return
+        }
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        do {
+
+            try stack.addStorageAndWait(indexedStorage())
+            stack.fullTextIndexer.waitUntilRebuilt()
+
+            XCTAssertTrue(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "grocery").isEmpty)
+            XCTAssertEqual(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "sourdough").count, 1)
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatFullTextIndexes_RebuildAcrossBatches() {
+
+        let fileURL = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("\(Self.self).sqlite")
+        do {
+
+            let unindexedStack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try unindexedStack.addStorageAndWait(
+                SQLiteStore(fileURL: fileURL, configuration: "Config1")
+            )
+            try unindexedStack.perform(
+                synchronous: { (transaction) in
+
+                    for index in 1 ... 1_201 {
+
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: index)
+                        object.testString = "Shared note \(index)"
+                    }
+                }
+            )
+            unindexedStack.unsafeRemoveAllPersistentStoresAndWait()
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+            return
+        }
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        do {
+
+            let storage = SQLiteStore(fileURL: fileURL, configuration: "Config1")
+            storage.fullTextIndexes = [
+                .entity(From<TestEntity1>(), #keyPath(TestEntity1.testString))
+            ]
+            try stack.addStorageAndWait(storage)
+            stack.fullTextIndexer.waitUntilRebuilt()
+
+            XCTAssertEqual(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "shared", limit: 2_000).count, 1_201)
+            XCTAssertEqual(try stack.fetchFullTextMatchIDs(From<TestEntity1>(), matching: "1201").count, 1)
+        }
+        catch {
+
+            XCTFail(error.localizedDescription)
+        }
+    }
+}
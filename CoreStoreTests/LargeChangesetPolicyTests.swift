@@ -0,0 +1,124 @@
+//
+//  LargeChangesetPolicyTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+#if canImport(UIKit) || canImport(AppKit)
+
+// MARK: - LargeChangesetPolicyTests
+
+class LargeChangesetPolicyTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatLargeChangesetPolicies_EstimateFromIdentifierDifferences() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let objectIDs1 = try stack.fetchObjectIDs(From<TestEntity1>())
+            let objectIDs2 = try stack.fetchObjectIDs(From<TestEntity2>())
+            XCTAssertEqual(objectIDs1.count, 5)
+            XCTAssertEqual(objectIDs2.count, 5)
+
+            let source = [
+                Internals.DiffableDataSourceSnapshot.Section(
+                    differenceIdentifier: "A",
+                    indexTitle: nil,
+                    items: objectIDs1.map({ .init(differenceIdentifier: $0) })
+                )
+            ]
+            let partialTarget = [
+                Internals.DiffableDataSourceSnapshot.Section(
+                    differenceIdentifier: "A",
+                    indexTitle: nil,
+                    items: (objectIDs1.prefix(3) + objectIDs2.prefix(2)).map({ .init(differenceIdentifier: $0) })
+                )
+            ]
+            let replacedTarget = [
+                Internals.DiffableDataSourceSnapshot.Section(
+                    differenceIdentifier: "B",
+                    indexTitle: nil,
+                    items: objectIDs2.map({ .init(differenceIdentifier: $0) })
+                )
+            ]
+            do {
+
+                let policy = DiffableDataSource.LargeChangesetPolicy(
+                    maximumChangeCount: nil,
+                    maximumChangeRatio: 0.5,
+                    minimumChangeCount: 4
+                )
+                let estimate = policy.estimate(source: source, target: partialTarget)
+                XCTAssertEqual(estimate.insertedItemCount, 2)
+                XCTAssertEqual(estimate.deletedItemCount, 2)
+                XCTAssertEqual(estimate.insertedSectionCount, 0)
+                XCTAssertEqual(estimate.deletedSectionCount, 0)
+                XCTAssertEqual(estimate.changeCount, 4)
+                XCTAssertEqual(estimate.changeRatio, 4.0 / 12.0, accuracy: 0.0001)
+                XCTAssertFalse(estimate.reloadsData)
+            }
+            do {
+
+                let policy = DiffableDataSource.LargeChangesetPolicy(
+                    maximumChangeCount: nil,
+                    maximumChangeRatio: 0.5,
+                    minimumChangeCount: 4
+                )
+                let estimate = policy.estimate(source: source, target: replacedTarget)
+                XCTAssertEqual(estimate.insertedItemCount, 5)
+                XCTAssertEqual(estimate.deletedItemCount, 5)
+                XCTAssertEqual(estimate.insertedSectionCount, 1)
+                XCTAssertEqual(estimate.deletedSectionCount, 1)
+                XCTAssertEqual(estimate.changeRatio, 1, accuracy: 0.0001)
+                XCTAssertTrue(estimate.reloadsData)
+            }
+            do {
+
+                let policy = DiffableDataSource.LargeChangesetPolicy(
+                    maximumChangeCount: nil,
+                    maximumChangeRatio: 0.5,
+                    minimumChangeCount: 100
+                )
+                XCTAssertFalse(policy.estimate(source: source, target: replacedTarget).reloadsData)
+            }
+            do {
+
+                let policy = DiffableDataSource.LargeChangesetPolicy(
+                    maximumChangeCount: 3,
+                    maximumChangeRatio: nil
+                )
+                XCTAssertTrue(policy.estimate(source: source, target: partialTarget).reloadsData)
+                XCTAssertTrue(DiffableDataSource.LargeChangesetPolicy.disabled.isDisabled)
+            }
+        }
+    }
+}
+
+#endif
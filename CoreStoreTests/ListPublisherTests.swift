@@ -112,6 +112,7 @@ class ListPublisherTests: BaseTestDataTestCase {
             XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 0), 2)
             XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 1), 3)
 
+            let previousSnapshot = listPublisher.snapshot
             let didChangeExpectation = self.expectation(description: "didChange")
             listPublisher.addObserver(observer) { listPublisher in
 
@@ -121,6 +122,10 @@ class ListPublisherTests: BaseTestDataTestCase {
                 XCTAssertTrue(listPublisher.snapshot.hasItems(inSectionIndex: 0))
                 XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 0), 2)
                 XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 1), 3)
+                XCTAssertEqual(listPublisher.snapshot.updatedItemIdentifiers.count, 2)
+                XCTAssertTrue(
+                    listPublisher.snapshot.diffableSnapshot.hasSameStructure(as: previousSnapshot.diffableSnapshot)
+                )
 
                 didChangeExpectation.fulfill()
             }
@@ -196,6 +201,7 @@ class ListPublisherTests: BaseTestDataTestCase {
             XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 0), 2)
             XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 1), 3)
 
+            let previousSnapshot = listPublisher.snapshot
             let didChangeExpectation = self.expectation(description: "didChange")
             listPublisher.addObserver(observer) { listPublisher in
 
@@ -205,6 +211,9 @@ class ListPublisherTests: BaseTestDataTestCase {
                 XCTAssertTrue(listPublisher.snapshot.hasItems(inSectionIndex: 0))
                 XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 0), 1)
                 XCTAssertEqual(listPublisher.snapshot.numberOfItems(inSectionIndex: 1), 4)
+                XCTAssertFalse(
+                    listPublisher.snapshot.diffableSnapshot.hasSameStructure(as: previousSnapshot.diffableSnapshot)
+                )
 
                 didChangeExpectation.fulfill()
             }
@@ -0,0 +1,135 @@
+//
+//  ListStateTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+#if canImport(Combine) && canImport(SwiftUI)
+
+import Combine
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - ListStateTests
+
+@available(iOS 13.0, tvOS 13.0, watchOS 6.0, macOS 10.15, *)
+class ListStateTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatRowGranularObservers_OnlyInvalidateForStructuralChanges() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let listPublisher = stack.publishList(
+                From<TestEntity1>(),
+                SectionBy(#keyPath(TestEntity1.testBoolean)),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testBoolean)), .ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            let listObserver = ListState<TestEntity1>.Observer(listPublisher: listPublisher, updateGranularity: .list)
+            let rowsObserver = ListState<TestEntity1>.Observer(listPublisher: listPublisher, updateGranularity: .rows)
+
+            var listChangeCount = 0
+            var rowsChangeCount = 0
+            var didChangeExpectation: XCTestExpectation?
+            let cancellables: Set<AnyCancellable> = [
+                listObserver.objectWillChange.sink {
+
+                    listChangeCount += 1
+                    didChangeExpectation?.fulfill()
+                },
+                rowsObserver.objectWillChange.sink {
+
+                    rowsChangeCount += 1
+                }
+            ]
+
+            didChangeExpectation = self.expectation(description: "update")
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    let object = try transaction.fetchOne(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 101)
+                    )
+                    object?.testString = "nil:TestEntity1:11"
+                }
+            )
+            self.waitAndCheckExpectations()
+            XCTAssertEqual(listChangeCount, 1)
+            XCTAssertEqual(rowsChangeCount, 0)
+            XCTAssertEqual(rowsObserver.items.count, 5)
+            XCTAssertEqual(rowsObserver.items.updatedItemIdentifiers.count, 1)
+
+            didChangeExpectation = self.expectation(description: "insert")
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    let object = transaction.create(Into<TestEntity1>())
+                    object.testEntityID = NSNumber(value: 106)
+                    object.testBoolean = NSNumber(value: false)
+                }
+            )
+            self.waitAndCheckExpectations()
+            XCTAssertEqual(listChangeCount, 2)
+            XCTAssertEqual(rowsChangeCount, 1)
+
+            didChangeExpectation = self.expectation(description: "move")
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    let object = try transaction.fetchOne(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 102)
+                    )
+                    object?.testBoolean = NSNumber(value: true)
+                }
+            )
+            self.waitAndCheckExpectations()
+            XCTAssertEqual(listChangeCount, 3)
+            XCTAssertEqual(rowsChangeCount, 2)
+
+            didChangeExpectation = self.expectation(description: "delete")
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    try transaction.deleteAll(
+                        From<TestEntity1>(),
+                        Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 106)
+                    )
+                }
+            )
+            self.waitAndCheckExpectations()
+            XCTAssertEqual(listChangeCount, 4)
+            XCTAssertEqual(rowsChangeCount, 3)
+            XCTAssertEqual(rowsObserver.items.count, 5)
+
+            withExtendedLifetime((listObserver, rowsObserver, cancellables), {})
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,226 @@
+//
+//  MembershipChunkingTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - MembershipChunkingTests
+
+class MembershipChunkingTests: BaseTestDataTestCase {
+
+    override func setUp() {
+
+        super.setUp()
+        CoreStoreDefaults.maximumMembershipListCount = 2
+    }
+
+    override func tearDown() {
+
+        CoreStoreDefaults.maximumMembershipListCount = 500
+        super.tearDown()
+    }
+
+    @objc
+    dynamic func test_ThatMembershipChunker_OnlySplitsLargeSingleValuedMembershipTests() {
+
+        self.prepareStack { (stack) in
+
+            let entity = stack.entityDescription(for: TestEntity1.self)
+            let membershipTest = NSPredicate(format: "%K IN %@", #keyPath(TestEntity1.testEntityID), [1, 2, 2, 3, 4, 5, 5])
+            do {
+
+                let chunker = Internals.MembershipChunker(
+                    predicate: membershipTest,
+                    entity: entity,
+                    maximumListCount: 2
+                )
+                XCTAssertEqual(
+                    chunker?.predicates,
+                    [
+                        NSPredicate(format: "%K IN %@", #keyPath(TestEntity1.testEntityID), [1, 2]),
+                        NSPredicate(format: "%K IN %@", #keyPath(TestEntity1.testEntityID), [3, 4]),
+                        NSPredicate(format: "%K IN %@", #keyPath(TestEntity1.testEntityID), [5])
+                    ]
+                )
+            }
+            do {
+
+                let chunker = Internals.MembershipChunker(
+                    predicate: NSCompoundPredicate(
+                        andPredicateWithSubpredicates: [
+                            NSPredicate(format: "%K == YES", #keyPath(TestEntity1.testBoolean)),
+                            membershipTest
+                        ]
+                    ),
+                    entity: entity,
+                    maximumListCount: 3
+                )
+                XCTAssertEqual(
+                    chunker?.predicates,
+                    [
+                        NSPredicate(format: "%K == YES AND %K IN %@", #keyPath(TestEntity1.testBoolean), #keyPath(TestEntity1.testEntityID), [1, 2, 3]),
+                        NSPredicate(format: "%K == YES AND %K IN %@", #keyPath(TestEntity1.testBoolean), #keyPath(TestEntity1.testEntityID), [4, 5])
+                    ]
+                )
+            }
+            XCTAssertNil(
+                Internals.MembershipChunker(
+                    predicate: membershipTest,
+                    entity: entity,
+                    maximumListCount: 5
+                )
+            )
+            XCTAssertNil(
+                Internals.MembershipChunker(
+                    predicate: NSCompoundPredicate(
+                        orPredicateWithSubpredicates: [
+                            NSPredicate(format: "%K == YES", #keyPath(TestEntity1.testBoolean)),
+                            membershipTest
+                        ]
+                    ),
+                    entity: entity,
+                    maximumListCount: 2
+                )
+            )
+            XCTAssertNil(
+                Internals.MembershipChunker(
+                    predicate: NSPredicate(format: "%K IN %@", "unknownKey", [1, 2, 3]),
+                    entity: entity,
+                    maximumListCount: 2
+                )
+            )
+            XCTAssertNil(
+                Internals.MembershipChunker(
+                    predicate: NSPredicate(format: "%K IN[c] %@", #keyPath(TestEntity1.testString), ["Bob", "bob", "Carol"]),
+                    entity: entity,
+                    maximumListCount: 2
+                )
+            )
+        }
+    }
+
+    @objc
+    dynamic func test_ThatMembershipTestsWithOptions_AreNotFetchedInChunks() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let whereClause = Where<TestEntity1>(
+                NSPredicate(
+                    format: "%K IN[c] %@",
+                    #keyPath(TestEntity1.testString),
+                    ["nil:TestEntity1:1", "NIL:TESTENTITY1:1", "nil:testentity1:3"]
+                )
+            )
+            XCTAssertEqual(
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                ).map({ $0.testEntityID?.intValue }),
+                [101, 103]
+            )
+            XCTAssertEqual(try stack.fetchCount(From<TestEntity1>(), whereClause), 2)
+            XCTAssertEqual(Set(try stack.fetchObjectIDs(From<TestEntity1>(), whereClause)).count, 2)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatLargeMembershipTests_AreFetchedInChunks() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let whereClause = Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isMemberOf: [105, 101, 103, 104, 999])
+            XCTAssertEqual(
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.descending(#keyPath(TestEntity1.testEntityID)))
+                ).map({ $0.testEntityID?.intValue }),
+                [105, 104, 103, 101]
+            )
+            XCTAssertEqual(
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.descending(#keyPath(TestEntity1.testEntityID))),
+                    Tweak {
+
+                        $0.fetchOffset = 1
+                        $0.fetchLimit = 2
+                    }
+                ).map({ $0.testEntityID?.intValue }),
+                [104, 103]
+            )
+            XCTAssertEqual(
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    whereClause && Where<TestEntity1>(#keyPath(TestEntity1.testBoolean), isEqualTo: true),
+                    OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                ).map({ $0.testEntityID?.intValue }),
+                [101, 103, 105]
+            )
+            XCTAssertEqual(
+                try stack.fetchOne(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                )?.testEntityID,
+                101
+            )
+            XCTAssertEqual(try stack.fetchCount(From<TestEntity1>(), whereClause), 4)
+            XCTAssertEqual(
+                try stack.fetchObjectIDs(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                ),
+                try stack.fetchAll(
+                    From<TestEntity1>(),
+                    whereClause,
+                    OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                ).map({ $0.objectID })
+            )
+            XCTAssertEqual(Set(try stack.fetchObjectIDs(From<TestEntity1>(), whereClause)).count, 4)
+
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    XCTAssertEqual(try transaction.deleteAll(From<TestEntity1>(), whereClause), 4)
+                }
+            )
+            XCTAssertEqual(
+                try stack.fetchAll(From<TestEntity1>()).map({ $0.testEntityID?.intValue }),
+                [102]
+            )
+        }
+    }
+}
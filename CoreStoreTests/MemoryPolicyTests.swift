@@ -0,0 +1,200 @@
+//
+//  MemoryPolicyTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - MemoryPolicyTests
+
+class MemoryPolicyTests: BaseTestDataTestCase {
+
+    override func setUp() {
+
+        super.setUp()
+        CoreStoreDefaults.tracksLiveObjects = true
+    }
+
+    override func tearDown() {
+
+        CoreStoreDefaults.tracksLiveObjects = false
+        super.tearDown()
+    }
+
+    @objc
+    dynamic func test_ThatMemoryPressure_RefreshesUnobservedObjects() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            stack.memoryPolicy = DataStack.MemoryPolicy(
+                maximumRegisteredObjects: nil,
+                observesSystemMemoryPressure: false
+            )
+
+            let objects = try stack.fetchAll(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID))),
+                Tweak { $0.returnsObjectsAsFaults = false }
+            )
+            XCTAssertEqual(objects.count, 5)
+            XCTAssertTrue(objects.allSatisfy({ !$0.isFault }))
+
+            let observedPublisher = stack.publishObject(objects[0])
+            observedPublisher.addObserver(self) { _ in }
+            let unobservedPublisher = stack.publishObject(objects[1])
+            XCTAssertNotNil(observedPublisher.snapshot)
+            XCTAssertNotNil(unobservedPublisher.snapshot)
+            let listPublisher = stack.publishList(
+                From<TestEntity1>(),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 103),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(listPublisher.snapshot.numberOfItems, 1)
+
+            let initialStatistics = stack.memoryStatistics()
+            stack.handleMemoryPressure(.warning)
+
+            XCTAssertFalse(objects[0].isFault)
+            XCTAssertTrue(objects[1].isFault)
+            XCTAssertFalse(objects[2].isFault)
+            XCTAssertTrue(objects.dropFirst(3).allSatisfy({ $0.isFault }))
+
+            let statistics = stack.memoryStatistics()
+            XCTAssertEqual(statistics.liveObjectSnapshots, initialStatistics.liveObjectSnapshots - 1)
+            XCTAssertEqual(unobservedPublisher.testString, "nil:TestEntity1:2")
+            XCTAssertEqual(objects[1].testString, "nil:TestEntity1:2")
+
+            observedPublisher.removeObserver(self)
+            withExtendedLifetime(listPublisher) {}
+        }
+    }
+
+    @objc
+    dynamic func test_ThatMemoryPolicies_CapRegisteredObjects() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            stack.memoryPolicy = DataStack.MemoryPolicy(
+                maximumRegisteredObjects: 2,
+                observesSystemMemoryPressure: false
+            )
+
+            let objects = try stack.fetchAll(
+                From<TestEntity1>(),
+                Tweak { $0.returnsObjectsAsFaults = false }
+            )
+            XCTAssertEqual(objects.count, 5)
+            XCTAssertTrue(objects.allSatisfy({ !$0.isFault }))
+
+            let expectation = self.expectation(description: "memoryPolicyCheck")
+            DispatchQueue.main.async {
+
+                // The check is scheduled on the main context's queue before this block
+                XCTAssertTrue(objects.allSatisfy({ $0.isFault }))
+                expectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            stack.memoryPolicy = nil
+            let uncappedObjects = try stack.fetchAll(
+                From<TestEntity1>(),
+                Tweak { $0.returnsObjectsAsFaults = false }
+            )
+            let uncappedExpectation = self.expectation(description: "noMemoryPolicyCheck")
+            DispatchQueue.main.async {
+
+                XCTAssertTrue(uncappedObjects.allSatisfy({ !$0.isFault }))
+                uncappedExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+        }
+    }
+
+    @objc
+    dynamic func test_ThatFaultRecycler_RecyclesStaleUnobservedObjects() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            stack.memoryPolicy = DataStack.MemoryPolicy(
+                maximumRegisteredObjects: nil,
+                observesSystemMemoryPressure: false,
+                recyclingInterval: 60 * 60,
+                recyclingBatchSize: 2
+            )
+
+            let objects = try stack.fetchAll(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID))),
+                Tweak { $0.returnsObjectsAsFaults = false }
+            )
+            XCTAssertEqual(objects.count, 5)
+            XCTAssertTrue(objects.allSatisfy({ !$0.isFault }))
+
+            let objectPublisher = stack.publishObject(objects[0])
+            objectPublisher.addObserver(self) { _ in }
+            let listPublisher = stack.publishList(
+                From<TestEntity1>(),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 102),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(listPublisher.snapshot.numberOfItems, 1)
+
+            let firstPassExpectation = self.expectation(description: "firstPass")
+            stack.faultRecycler.recycle { (recycledObjectCount) in
+
+                // Objects are only recycled after staying idle for a whole pass
+                XCTAssertEqual(recycledObjectCount, 0)
+                XCTAssertTrue(objects.allSatisfy({ !$0.isFault }))
+                firstPassExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            let secondPassExpectation = self.expectation(description: "secondPass")
+            stack.faultRecycler.recycle { (recycledObjectCount) in
+
+                XCTAssertEqual(recycledObjectCount, 3)
+                XCTAssertFalse(objects[0].isFault)
+                XCTAssertFalse(objects[1].isFault)
+                XCTAssertTrue(objects.dropFirst(2).allSatisfy({ $0.isFault }))
+                secondPassExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            let statistics = stack.memoryStatistics()
+            XCTAssertEqual(statistics.recycledObjects, 3)
+            XCTAssertEqual(statistics.recyclingPasses, 2)
+            XCTAssertEqual(objects[2].testString, "nil:TestEntity1:3")
+
+            objectPublisher.removeObserver(self)
+            withExtendedLifetime(listPublisher) {}
+            stack.memoryPolicy = nil
+        }
+    }
+}
@@ -0,0 +1,124 @@
+//
+//  MemoryStatisticsTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - MemoryStatisticsTests
+
+class MemoryStatisticsTests: BaseTestDataTestCase {
+
+    override func setUp() {
+
+        super.setUp()
+        CoreStoreDefaults.tracksLiveObjects = true
+    }
+
+    override func tearDown() {
+
+        CoreStoreDefaults.tracksLiveObjects = false
+        super.tearDown()
+    }
+
+    @objc
+    dynamic func test_ThatMemoryStatistics_CountRegisteredObjects() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let objects = try stack.fetchAll(From<TestEntity1>())
+            XCTAssertEqual(objects.count, 5)
+
+            let statistics = stack.memoryStatistics()
+            XCTAssertGreaterThanOrEqual(statistics.registeredObjectsInMainContext, objects.count)
+
+            withExtendedLifetime(objects, {})
+        }
+    }
+
+    @objc
+    dynamic func test_ThatMemoryStatistics_TrackLiveObjectPublishersAndSnapshots() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            guard let object = try stack.fetchOne(
+                From<TestEntity1>(),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 101)) else {
+
+                    XCTFail()
+                    return
+            }
+            let initialStatistics = stack.memoryStatistics()
+            autoreleasepool {
+
+                let objectPublisher = stack.publishObject(object)
+                XCTAssertNotNil(objectPublisher.snapshot)
+
+                let statistics = stack.memoryStatistics()
+                XCTAssertEqual(statistics.liveObjectPublishers, initialStatistics.liveObjectPublishers + 1)
+                XCTAssertEqual(statistics.liveObjectSnapshots, initialStatistics.liveObjectSnapshots + 1)
+
+                withExtendedLifetime(objectPublisher, {})
+            }
+            let finalStatistics = stack.memoryStatistics()
+            XCTAssertEqual(finalStatistics.liveObjectPublishers, initialStatistics.liveObjectPublishers)
+            XCTAssertEqual(finalStatistics.liveObjectSnapshots, initialStatistics.liveObjectSnapshots)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatMemoryStatistics_IgnoreObjectsCreatedWhileTrackingIsDisabled() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            guard let object = try stack.fetchOne(
+                From<TestEntity1>(),
+                Where<TestEntity1>(#keyPath(TestEntity1.testEntityID), isEqualTo: 101)) else {
+
+                    XCTFail()
+                    return
+            }
+            CoreStoreDefaults.tracksLiveObjects = false
+
+            let initialStatistics = stack.memoryStatistics()
+            let objectPublisher = stack.publishObject(object)
+            XCTAssertNotNil(objectPublisher.snapshot)
+
+            let statistics = stack.memoryStatistics()
+            XCTAssertEqual(statistics.liveObjectPublishers, initialStatistics.liveObjectPublishers)
+            XCTAssertEqual(statistics.liveObjectSnapshots, initialStatistics.liveObjectSnapshots)
+
+            withExtendedLifetime(objectPublisher, {})
+        }
+    }
+}
@@ -150,5 +150,46 @@ class ObjectPublisherTests: BaseTestDataTestCase {
             withExtendedLifetime(observer, {})
         }
     }
+
+    #if canImport(UIKit) || canImport(AppKit)
+
+    @objc
+    dynamic func test_ThatObjectPrefetchers_PrewarmObjectPublishersWithinCapacity() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let objectIDs = try stack.fetchObjectIDs(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(objectIDs.count, 5)
+
+            let prefetcher = Internals.ObjectPrefetcher<TestEntity1>(dataStack: stack)
+            prefetcher.prefetch(objectIDs, capacity: 3)
+
+            let prefetchExpectation = self.expectation(
+                for: NSPredicate(block: { _, _ in prefetcher.prefetchedObjectIDs.count == 3 }),
+                evaluatedWith: nil
+            )
+            self.wait(for: [prefetchExpectation], timeout: 10)
+
+            XCTAssertEqual(prefetcher.prefetchedObjectIDs, Array(objectIDs.suffix(3)))
+            for objectID in prefetcher.prefetchedObjectIDs {
+
+                let objectPublisher: ObjectPublisher<TestEntity1> = stack.mainContext.objectPublisher(objectID: objectID)
+                XCTAssertNotNil(objectPublisher.snapshot)
+                XCTAssertNil(stack.mainContext.registeredObject(for: objectID))
+            }
+            let lastPublisher: ObjectPublisher<TestEntity1> = stack.mainContext.objectPublisher(objectID: objectIDs[4])
+            XCTAssertEqual(lastPublisher.snapshot?.testEntityID, NSNumber(value: 105))
+
+            prefetcher.cancelPrefetching(objectIDs)
+            XCTAssertTrue(prefetcher.prefetchedObjectIDs.isEmpty)
+        }
+    }
+
+    #endif
 }
 
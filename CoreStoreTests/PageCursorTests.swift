@@ -0,0 +1,141 @@
+//
+//  PageCursorTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+
+@testable
+import CoreStore
+
+
+// MARK: - PageCursorTests
+
+class PageCursorTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatPages_ContinueAfterTheirCursors() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let chain = From<TestEntity1>()
+                .where(Where<TestEntity1>(#keyPath(TestEntity1.testBoolean), isEqualTo: true))
+                .orderBy(.descending(#keyPath(TestEntity1.testEntityID)))
+
+            var cursor: PageCursor<TestEntity1>?
+            var pages: [[Int?]] = []
+            repeat {
+
+                let page = chain.page(
+                    after: cursor,
+                    limit: 2,
+                    uniqueKey: .descending(#keyPath(TestEntity1.testEntityID))
+                )
+                let objects = try stack.fetchAll(page)
+                pages.append(objects.map({ $0.testEntityID?.intValue }))
+                cursor = page.cursor(after: objects)
+            }
+            while cursor != nil
+            XCTAssertEqual(pages, [[105, 103], [101], []])
+        }
+    }
+
+    @objc
+    dynamic func test_ThatPages_DoNotRepeatOrSkipTiedObjects() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let chain = From<TestEntity1>()
+                .orderBy(.ascending(#keyPath(TestEntity1.testBoolean)))
+
+            var cursor: PageCursor<TestEntity1>?
+            var objects: [TestEntity1] = []
+            var pageCount = 0
+            repeat {
+
+                let page = chain.page(
+                    after: cursor,
+                    limit: 2,
+                    uniqueKey: .ascending(#keyPath(TestEntity1.testEntityID))
+                )
+                let pageObjects = try stack.fetchAll(page)
+                XCTAssertLessThanOrEqual(pageObjects.count, 2)
+                objects.append(contentsOf: pageObjects)
+                cursor = page.cursor(after: pageObjects)
+                pageCount += 1
+            }
+            while cursor != nil && pageCount < 10
+
+            XCTAssertEqual(pageCount, 4)
+            XCTAssertEqual(
+                objects.compactMap({ $0.testEntityID?.intValue }),
+                [102, 104, 101, 103, 105]
+            )
+            XCTAssertEqual(
+                objects.compactMap({ $0.testBoolean?.boolValue }),
+                [false, false, true, true, true]
+            )
+        }
+    }
+
+    #if canImport(UIKit) || canImport(AppKit)
+
+    @objc
+    dynamic func test_ThatListPublishers_CanPublishPages() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let chain = From<TestEntity1>()
+                .orderBy(.ascending(#keyPath(TestEntity1.testEntityID)))
+
+            let firstPage = chain.page(
+                after: nil,
+                limit: 3,
+                uniqueKey: .ascending(#keyPath(TestEntity1.testEntityID))
+            )
+            let firstPublisher = stack.publishList(firstPage)
+            XCTAssertEqual(
+                firstPublisher.snapshot.compactMap({ $0.object?.testEntityID?.intValue }),
+                [101, 102, 103]
+            )
+            let secondPage = chain.page(
+                after: firstPage.cursor(after: firstPublisher.snapshot),
+                limit: 3,
+                uniqueKey: .ascending(#keyPath(TestEntity1.testEntityID))
+            )
+            let secondPublisher = stack.publishList(secondPage)
+            XCTAssertEqual(
+                secondPublisher.snapshot.compactMap({ $0.object?.testEntityID?.intValue }),
+                [104, 105]
+            )
+        }
+    }
+
+    #endif
+}
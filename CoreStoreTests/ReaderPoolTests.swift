@@ -0,0 +1,299 @@
+//
+//  ReaderPoolTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+import CoreData
+
+@testable
+import CoreStore
+
+
+// MARK: - ReaderPoolTests
+
+class ReaderPoolTests: BaseTestDataTestCase {
+
+    @objc
+    dynamic func test_ThatBackgroundReads_AreServedFromReaders() {
+
+        let configurations: [ModelConfiguration] = ["Config1", "Config2"]
+        self.prepareStack(configurations: configurations) { (stack) in
+
+            self.prepareTestDataForStack(stack, configurations: configurations)
+            XCTAssertEqual(stack.maximumConcurrentReaders, 0)
+            XCTAssertFalse(stack.readerPool.canRead)
+
+            stack.maximumConcurrentReaders = 2
+            XCTAssertTrue(stack.readerPool.canRead)
+
+            let mainObjectIDs = try stack.fetchObjectIDs(
+                From<TestEntity1>("Config1"),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            let readExpectation = self.expectation(description: "read")
+            DispatchQueue.global(qos: .userInitiated).async {
+
+                do {
+
+                    let objectIDs = try stack.fetchObjectIDs(
+                        From<TestEntity1>("Config1"),
+                        OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                    )
+                    XCTAssertEqual(objectIDs, mainObjectIDs)
+                    XCTAssertTrue(objectIDs.allSatisfy({ $0.persistentStore?.persistentStoreCoordinator === stack.coordinator }))
+
+                    let count = try stack.fetchCount(From<TestEntity2>("Config2"))
+                    XCTAssertEqual(count, 5)
+
+                    let maximumID = try stack.queryValue(
+                        From<TestEntity2>("Config2"),
+                        Select<TestEntity2, Int>(.maximum(#keyPath(TestEntity2.testEntityID)))
+                    )
+                    XCTAssertEqual(maximumID, 405)
+                }
+                catch {
+
+                    XCTFail((error as NSError).coreStoreDumpString)
+                }
+                readExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+
+            let object = stack.fetchExisting(mainObjectIDs[0]) as TestEntity1?
+            XCTAssertEqual(object?.testEntityID, 101)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatReaders_SeeSavedChanges() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            stack.maximumConcurrentReaders = 2
+
+            let readExpectation = self.expectation(description: "read")
+            DispatchQueue.global(qos: .userInitiated).async {
+
+                do {
+
+                    DispatchQueue.concurrentPerform(iterations: 8) { _ in
+
+                        XCTAssertEqual(try? stack.fetchCount(From<TestEntity1>()), 5)
+                    }
+                    try stack.perform(
+                        synchronous: { (transaction) in
+
+                            let object = transaction.create(Into<TestEntity1>())
+                            object.testEntityID = 106
+                        }
+                    )
+                    XCTAssertEqual(try stack.fetchCount(From<TestEntity1>()), 6)
+                }
+                catch {
+
+                    XCTFail((error as NSError).coreStoreDumpString)
+                }
+                readExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+        }
+    }
+
+    @objc
+    dynamic func test_ThatNonSQLiteStacks_AreNotServedFromReaders() {
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        do {
+
+            try stack.addStorageAndWait(InMemoryStore())
+            stack.maximumConcurrentReaders = 2
+            XCTAssertFalse(stack.readerPool.canRead)
+
+            let stack2 = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try stack2.addStorageAndWait(
+                SQLiteStore(
+                    fileURL: SQLiteStore.defaultRootDirectory
+                        .appendingPathComponent(UUID().uuidString)
+                        .appendingPathComponent("\(Self.self).sqlite"),
+                    localStorageOptions: .recreateStoreOnModelMismatch
+                )
+            )
+            stack2.maximumConcurrentReaders = 2
+            XCTAssertTrue(stack2.readerPool.canRead)
+
+            stack2.maximumConcurrentReaders = 0
+            XCTAssertFalse(stack2.readerPool.canRead)
+            stack2.unsafeRemoveAllPersistentStoresAndWait()
+        }
+        catch {
+
+            XCTFail((error as NSError).coreStoreDumpString)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatDataReaders_ReturnSnapshotsAndObjectIDs() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            stack.maximumConcurrentReaders = 2
+
+            let mainObjectIDs = try stack.fetchObjectIDs(
+                From<TestEntity1>(),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            let readExpectation = self.expectation(description: "read")
+            DispatchQueue.global(qos: .userInitiated).async {
+
+                do {
+
+                    let snapshots: [ObjectSnapshot<TestEntity1>] = try stack.read { (reader) in
+
+                        let objects = try reader.fetchAll(
+                            From<TestEntity1>(),
+                            OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                        )
+                        XCTAssertEqual(objects.count, 5)
+                        XCTAssertEqual(reader.fetchExisting(mainObjectIDs).count, 5)
+                        XCTAssertEqual(reader.objectID(of: objects[0]), mainObjectIDs[0])
+                        return reader.snapshots(of: objects)
+                    }
+                    XCTAssertEqual(snapshots.map({ $0.objectID() }), mainObjectIDs)
+                    XCTAssertEqual(
+                        snapshots.compactMap({ $0.dictionaryForValues()[#keyPath(TestEntity1.testEntityID)] as? NSNumber }),
+                        [101, 102, 103, 104, 105]
+                    )
+                    let objectIDs = try stack.read { (reader) in
+
+                        return try reader.fetchObjectIDs(
+                            From<TestEntity1>(),
+                            OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                        )
+                    }
+                    XCTAssertEqual(objectIDs, mainObjectIDs)
+                }
+                catch {
+
+                    XCTFail((error as NSError).coreStoreDumpString)
+                }
+                readExpectation.fulfill()
+            }
+            self.waitAndCheckExpectations()
+        }
+    }
+
+    @objc
+    dynamic func test_ThatAsynchronousDataReaders_CompleteOnTheSpecifiedQueue() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+
+            let completionQueue = DispatchQueue(label: "ReaderPoolTests.completionQueue")
+            let readExpectation = self.expectation(description: "read")
+            stack.read(
+                { (reader) in
+
+                    XCTAssertFalse(Thread.isMainThread)
+                    return try reader.fetchCount(From<TestEntity1>())
+                },
+                queue: completionQueue,
+                completion: { (result) in
+
+                    XCTAssertFalse(Thread.isMainThread)
+                    switch result {
+
+                    case .success(let count):
+                        XCTAssertEqual(count, 5)
+
+                    case .failure(let error):
+                        XCTFail((error as NSError).coreStoreDumpString)
+                    }
+                    readExpectation.fulfill()
+                }
+            )
+            self.waitAndCheckExpectations()
+        }
+    }
+
+    @objc
+    dynamic func test_ThatDataReaders_FallBackToTheStackCoordinatorForNonSQLiteStores() {
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        do {
+
+            try stack.addStorageAndWait(InMemoryStore())
+            self.prepareTestDataForStack(stack)
+
+            let count = try stack.read { (reader) in
+
+                return try reader.fetchCount(From<TestEntity1>())
+            }
+            XCTAssertEqual(count, 5)
+        }
+        catch {
+
+            XCTFail((error as NSError).coreStoreDumpString)
+        }
+    }
+
+    @objc
+    dynamic func test_ThatFallbackDataReaders_OnlySeeSavedChanges() {
+
+        self.prepareStack { (stack) in
+
+            self.prepareTestDataForStack(stack)
+            XCTAssertFalse(stack.readerPool.canRead)
+
+            let rootContext = stack.rootSavingContext
+            rootContext.performAndWait {
+
+                let entity = stack.entityDescription(for: TestEntity1.self)!
+                let object = TestEntity1(entity: entity, insertInto: rootContext)
+                object.testEntityID = NSNumber(value: 106)
+            }
+            let count = try stack.read { (reader) in
+
+                return try reader.fetchCount(From<TestEntity1>())
+            }
+            XCTAssertEqual(count, 5)
+
+            rootContext.performAndWait {
+
+                rootContext.rollback()
+            }
+        }
+    }
+}
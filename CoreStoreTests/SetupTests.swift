@@ -132,6 +132,79 @@ class SetupTests: BaseTestDataTestCase {
         }
     }
     
+    @objc
+    dynamic func test_ThatInMemoryStores_RestoreFromSnapshots() {
+        
+        let snapshotFileURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("Fixtures.sqlite")
+        do {
+            
+            try InMemoryStore.generateSnapshot(
+                fileURL: snapshotFileURL,
+                schema: XcodeDataModelSchema.from(
+                    modelName: "Model",
+                    bundle: Bundle(for: Self.self)
+                ),
+                configuration: "Config1",
+                importSource: { (transaction) in
+                    
+                    for testEntityID in 101 ... 105 {
+                        
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: testEntityID)
+                        object.testString = "fixture\(testEntityID)"
+                    }
+                }
+            )
+        }
+        catch let error as NSError {
+            
+            XCTFail(error.coreStoreDumpString)
+        }
+        for _ in 0 ..< 2 {
+            
+            let stack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            do {
+                
+                let inMemoryStore = InMemoryStore(
+                    configuration: "Config1",
+                    snapshotFileURL: snapshotFileURL
+                )
+                try stack.addStorageAndWait(inMemoryStore)
+                
+                let persistentStore = stack.persistentStoreForStorage(inMemoryStore)
+                XCTAssertEqual(persistentStore?.type, NSInMemoryStoreType)
+                XCTAssertEqual(persistentStore?.configurationName, "Config1")
+                XCTAssertEqual(
+                    try stack.queryAttributes(
+                        From<TestEntity1>("Config1"),
+                        Select<TestEntity1, NSDictionary>(#keyPath(TestEntity1.testString)),
+                        OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+                    ).compactMap({ $0[#keyPath(TestEntity1.testString)] as? String }),
+                    (101 ... 105).map({ "fixture\($0)" })
+                )
+                
+                // Changes stay in memory, so the next stack restores the original contents
+                try stack.perform(
+                    synchronous: { (transaction) in
+                        
+                        try transaction.deleteAll(From<TestEntity1>("Config1"))
+                    }
+                )
+                XCTAssertEqual(try stack.fetchCount(From<TestEntity1>("Config1")), 0)
+            }
+            catch let error as NSError {
+                
+                XCTFail(error.coreStoreDumpString)
+            }
+        }
+        _ = try? FileManager.default.removeItem(at: snapshotFileURL.deletingLastPathComponent())
+    }
+    
     @objc
     dynamic func test_ThatSQLiteStores_SetupCorrectly() {
         
@@ -194,6 +267,311 @@ class SetupTests: BaseTestDataTestCase {
         }
     }
     
+    @objc
+    dynamic func test_ThatSQLiteStores_AddInBatchesCorrectly() {
+        
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let rootDirectory = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+        let sqliteStores = [
+            SQLiteStore(
+                fileURL: rootDirectory.appendingPathComponent("DefaultStore.sqlite"),
+                localStorageOptions: .recreateStoreOnModelMismatch
+            ),
+            SQLiteStore(
+                fileURL: rootDirectory.appendingPathComponent("ConfigStore1.sqlite"),
+                configuration: "Config1",
+                localStorageOptions: .recreateStoreOnModelMismatch
+            ),
+            SQLiteStore(
+                fileURL: rootDirectory.appendingPathComponent("ConfigStore2.sqlite"),
+                configuration: "Config2",
+                localStorageOptions: .recreateStoreOnModelMismatch
+            ),
+            SQLiteStore(
+                fileURL: rootDirectory.appendingPathComponent("ConfigStore2.sqlite"),
+                configuration: "Config1",
+                localStorageOptions: .recreateStoreOnModelMismatch
+            )
+        ]
+        let setupExpectation = self.expectation(description: "setup")
+        self.expectLogger([.logError: self.expectation(description: "logError")])
+        let progress = stack.addStorages(sqliteStores) { (results) in
+            
+            XCTAssertTrue(Thread.isMainThread)
+            XCTAssertEqual(results.count, sqliteStores.count)
+            for (sqliteStore, result) in zip(sqliteStores.prefix(3), results) {
+                
+                switch result {
+                    
+                case .success(let storage):
+                    XCTAssertTrue(storage === sqliteStore)
+                    let persistentStore = stack.persistentStoreForStorage(sqliteStore)
+                    XCTAssertNotNil(persistentStore)
+                    XCTAssert(sqliteStore.matchesPersistentStore(persistentStore!))
+                    
+                case .failure(let error):
+                    XCTFail(error.coreStoreDumpString)
+                }
+            }
+            switch results[3] {
+                
+            case .success:
+                XCTFail()
+                
+            case .failure(let error):
+                XCTAssertEqual((error as NSError).code, CoreStoreErrorCode.differentStorageExistsAtURL.rawValue)
+            }
+            setupExpectation.fulfill()
+        }
+        XCTAssertEqual(progress.totalUnitCount, Int64(sqliteStores.count))
+        self.waitAndCheckExpectations()
+        XCTAssertEqual(progress.fractionCompleted, 1)
+        
+        self.prepareTestDataForStack(stack, configurations: [nil, "Config1", "Config2"])
+        XCTAssertEqual(try stack.fetchCount(From<TestEntity1>("Config1")), 5)
+        XCTAssertEqual(try stack.fetchCount(From<TestEntity2>("Config2")), 5)
+        stack.unsafeRemoveAllPersistentStoresAndWait()
+    }
+    
+    @objc
+    dynamic func test_ThatSQLiteStores_PrewarmAfterBeingAdded() {
+        
+        let fileURL = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("\(Self.self).sqlite")
+        do {
+            
+            let stack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try! stack.addStorageAndWait(SQLiteStore(fileURL: fileURL))
+            self.prepareTestDataForStack(stack)
+            stack.unsafeRemoveAllPersistentStoresAndWait()
+        }
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let prewarmExpectation = self.expectation(description: "prewarm")
+        let sqliteStore = SQLiteStore(fileURL: fileURL)
+        sqliteStore.prewarming = .init(
+            byteBudget: nil,
+            targets: [
+                .index(From<TestEntity1>(), #keyPath(TestEntity1.testEntityID)),
+                .entity(From<TestEntity1>(), Where<TestEntity1>("%K > %@", #keyPath(TestEntity1.testEntityID), 102)),
+                .list(
+                    From<TestEntity1>().orderBy(.descending(#keyPath(TestEntity1.testEntityID))),
+                    pageSize: 2
+                )
+            ],
+            completion: { (report) in
+                
+                XCTAssertTrue(Thread.isMainThread)
+                XCTAssertEqual(report.backgroundObjectCount, 8)
+                XCTAssertGreaterThan(report.backgroundByteCount, 0)
+                XCTAssertFalse(report.isBudgetExhausted)
+                XCTAssertEqual(report.mainContextObjectCount, 2)
+                XCTAssertTrue(report.errors.isEmpty)
+                
+                let registeredIDs = stack.mainContext.registeredObjects
+                    .compactMap({ ($0 as? TestEntity1)?.testEntityID?.intValue })
+                XCTAssertEqual(Set(registeredIDs), [104, 105])
+                prewarmExpectation.fulfill()
+            }
+        )
+        do {
+            
+            try stack.addStorageAndWait(sqliteStore)
+        }
+        catch let error as NSError {
+            
+            XCTFail(error.coreStoreDumpString)
+        }
+        self.waitAndCheckExpectations()
+        XCTAssertEqual(sqliteStore.prewarmedObjects.count, 2)
+        stack.unsafeRemoveAllPersistentStoresAndWait()
+        
+        let budgetStack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let budgetExpectation = self.expectation(description: "budget")
+        let budgetStore = SQLiteStore(fileURL: fileURL)
+        budgetStore.prewarming = .init(
+            byteBudget: 1,
+            targets: [
+                .entity(From<TestEntity1>()),
+                .entity(From<TestEntity2>())
+            ],
+            completion: { (report) in
+                
+                XCTAssertTrue(report.isBudgetExhausted)
+                XCTAssertEqual(report.backgroundObjectCount, 5)
+                XCTAssertEqual(report.mainContextObjectCount, 0)
+                budgetExpectation.fulfill()
+            }
+        )
+        try! budgetStack.addStorageAndWait(budgetStore)
+        self.waitAndCheckExpectations()
+        budgetStack.unsafeRemoveAllPersistentStoresAndWait()
+    }
+
+    @objc
+    dynamic func test_ThatSQLiteStores_PrewarmAcrossBatches() {
+
+        let fileURL = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+            .appendingPathComponent("\(Self.self).sqlite")
+        do {
+
+            let stack = DataStack(
+                xcodeModelName: "Model",
+                bundle: Bundle(for: Self.self)
+            )
+            try! stack.addStorageAndWait(SQLiteStore(fileURL: fileURL))
+            try! stack.perform(
+                synchronous: { (transaction) in
+
+                    for index in 0 ..< 1_200 {
+
+                        let object = transaction.create(Into<TestEntity1>())
+                        object.testEntityID = NSNumber(value: index)
+                        object.testNumber = index < 100 ? nil : NSNumber(value: index / 700)
+                    }
+                }
+            )
+            stack.unsafeRemoveAllPersistentStoresAndWait()
+        }
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let prewarmExpectation = self.expectation(description: "prewarm")
+        let sqliteStore = SQLiteStore(fileURL: fileURL)
+        sqliteStore.prewarming = .init(
+            byteBudget: nil,
+            targets: [
+                .index(From<TestEntity1>(), #keyPath(TestEntity1.testNumber)),
+                .index(From<TestEntity1>(), #keyPath(TestEntity1.testNumber), #keyPath(TestEntity1.testEntityID)),
+                .entity(From<TestEntity1>(), Where<TestEntity1>("%K >= %@", #keyPath(TestEntity1.testEntityID), 100)),
+                .entity(From<TestEntity1>(), OrderBy<TestEntity1>(.descending(#keyPath(TestEntity1.testNumber))))
+            ],
+            completion: { (report) in
+
+                XCTAssertEqual(report.backgroundObjectCount, 1_200 + 1_200 + 1_100 + 1_200)
+                XCTAssertFalse(report.isBudgetExhausted)
+                XCTAssertTrue(report.errors.isEmpty)
+                prewarmExpectation.fulfill()
+            }
+        )
+        try! stack.addStorageAndWait(sqliteStore)
+        self.waitAndCheckExpectations()
+        stack.unsafeRemoveAllPersistentStoresAndWait()
+
+        let budgetedStack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let budgetedPrewarmExpectation = self.expectation(description: "budgeted-prewarm")
+        let budgetedSQLiteStore = SQLiteStore(fileURL: fileURL)
+        budgetedSQLiteStore.prewarming = .init(
+            byteBudget: 1,
+            targets: [
+                .entity(From<TestEntity1>(), OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))),
+                .index(From<TestEntity1>(), #keyPath(TestEntity1.testNumber))
+            ],
+            completion: { (report) in
+
+                // Reading stops after the first batch instead of loading every matching row first
+                XCTAssertEqual(report.backgroundObjectCount, 500)
+                XCTAssertTrue(report.isBudgetExhausted)
+                XCTAssertTrue(report.errors.isEmpty)
+                budgetedPrewarmExpectation.fulfill()
+            }
+        )
+        try! budgetedStack.addStorageAndWait(budgetedSQLiteStore)
+        self.waitAndCheckExpectations()
+        budgetedStack.unsafeRemoveAllPersistentStoresAndWait()
+    }
+
+    @objc
+    dynamic func test_ThatReadOnlySQLiteStores_SetupCorrectly() {
+        
+        let rootDirectory = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+        let referenceFileURL = rootDirectory.appendingPathComponent("Reference.sqlite")
+        do {
+            
+            try ReadOnlySQLiteStore.generate(
+                fileURL: referenceFileURL,
+                schema: XcodeDataModelSchema.from(
+                    modelName: "Model",
+                    bundle: Bundle(for: Self.self)
+                ),
+                configuration: "Config1",
+                importSource: { (transaction) in
+                    
+                    for testEntityID in 101 ... 103 {
+                        
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: testEntityID)
+                    }
+                }
+            )
+        }
+        catch let error as NSError {
+            
+            XCTFail(error.coreStoreDumpString)
+        }
+        let fileManager = FileManager.default
+        XCTAssertTrue(fileManager.fileExists(atPath: referenceFileURL.path))
+        XCTAssertFalse(fileManager.fileExists(atPath: referenceFileURL.path.appending("-wal")))
+        XCTAssertFalse(fileManager.fileExists(atPath: referenceFileURL.path.appending("-shm")))
+        
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        do {
+            
+            let readOnlyStore = ReadOnlySQLiteStore(
+                fileURL: referenceFileURL,
+                configuration: "Config1"
+            )
+            try stack.addStorageAndWait(readOnlyStore)
+            try stack.addStorageAndWait(
+                SQLiteStore(
+                    fileURL: rootDirectory.appendingPathComponent("User.sqlite"),
+                    configuration: "Config2"
+                )
+            )
+            let persistentStore = stack.persistentStoreForStorage(readOnlyStore)
+            XCTAssertNotNil(persistentStore)
+            XCTAssertTrue(persistentStore?.isReadOnly == true)
+            XCTAssert(readOnlyStore.matchesPersistentStore(persistentStore!))
+            
+            XCTAssertEqual(try stack.fetchCount(From<TestEntity1>("Config1")), 3)
+            XCTAssertEqual(
+                try stack.queryValue(
+                    From<TestEntity1>("Config1"),
+                    Select<TestEntity1, Int>(.maximum(#keyPath(TestEntity1.testEntityID)))
+                ),
+                103
+            )
+            XCTAssertFalse(fileManager.fileExists(atPath: referenceFileURL.path.appending("-wal")))
+        }
+        catch let error as NSError {
+            
+            XCTFail(error.coreStoreDumpString)
+        }
+        stack.unsafeRemoveAllPersistentStoresAndWait()
+    }
+    
     @objc
     dynamic func test_ThatSQLiteStores_DeleteFilesCorrectly() {
         
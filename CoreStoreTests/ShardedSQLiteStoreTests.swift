@@ -0,0 +1,160 @@
+//
+//  ShardedSQLiteStoreTests.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import XCTest
+import CoreData
+
+@testable
+import CoreStore
+
+
+// MARK: - ShardedSQLiteStoreTests
+
+class ShardedSQLiteStoreTests: BaseTestCase {
+
+    @objc
+    dynamic func test_ThatShardedStores_RouteInsertsAndFetches() {
+
+        let stack = DataStack(
+            xcodeModelName: "Model",
+            bundle: Bundle(for: Self.self)
+        )
+        let rootDirectory = SQLiteStore.defaultRootDirectory
+            .appendingPathComponent(UUID().uuidString)
+        let shardedStore = ShardedSQLiteStore<TestEntity1>(
+            shardKey: #keyPath(TestEntity1.testNumber),
+            configuration: "Config1",
+            shardCount: 3,
+            fileURL: { rootDirectory.appendingPathComponent("Shard\($0).sqlite") }
+        )
+        do {
+
+            try stack.addStorageAndWait(shardedStore)
+            try stack.addStorageAndWait(
+                SQLiteStore(
+                    fileURL: rootDirectory.appendingPathComponent("Config2.sqlite"),
+                    configuration: "Config2"
+                )
+            )
+            try stack.perform(
+                synchronous: { (transaction) in
+
+                    for index in 0 ..< 9 {
+
+                        let object = transaction.create(Into<TestEntity1>("Config1"))
+                        object.testEntityID = NSNumber(value: 100 + index)
+                        object.testNumber = NSNumber(value: index)
+                    }
+                }
+            )
+            let objects = try stack.fetchAll(
+                From<TestEntity1>("Config1"),
+                OrderBy<TestEntity1>(.ascending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(objects.map({ $0.testEntityID?.intValue }), Array(100 ..< 109))
+            for object in objects {
+
+                let shard = shardedStore.storages[object.testNumber!.intValue % 3]
+                XCTAssertEqual(object.objectID.persistentStore?.url, shard.fileURL)
+            }
+
+            let pinnedObjects = try stack.fetchAll(
+                From<TestEntity1>("Config1"),
+                Where<TestEntity1>("%K IN %@", #keyPath(TestEntity1.testNumber), [1, 4, 6]),
+                OrderBy<TestEntity1>(.descending(#keyPath(TestEntity1.testEntityID)))
+            )
+            XCTAssertEqual(pinnedObjects.map({ $0.testEntityID?.intValue }), [106, 104, 101])
+            XCTAssertEqual(
+                try stack.fetchCount(
+                    From<TestEntity1>("Config1"),
+                    Where<TestEntity1>("%K == %@", #keyPath(TestEntity1.testNumber), 4)
+                        && Where<TestEntity1>("%K > %@", #keyPath(TestEntity1.testEntityID), 100)
+                ),
+                1
+            )
+            XCTAssertEqual(
+                try stack.fetchCount(
+                    From<TestEntity1>("Config1"),
+                    Where<TestEntity1>("%K >= %@", #keyPath(TestEntity1.testNumber), 3)
+                ),
+                6
+            )
+        }
+        catch let error as NSError {
+
+            XCTFail(error.coreStoreDumpString)
+        }
+        stack.unsafeRemoveAllPersistentStoresAndWait()
+    }
+
+    @objc
+    dynamic func test_ThatShardRouters_FindPinnedShardKeyValues() {
+
+        let shardedStore = ShardedSQLiteStore<TestEntity1>(
+            shardKey: #keyPath(TestEntity1.testNumber),
+            configuration: "Config1",
+            shardCount: 4,
+            fileURL: { SQLiteStore.defaultRootDirectory.appendingPathComponent("Shard\($0).sqlite") }
+        )
+        let shardRouter = Internals.ShardRouter(shardedStore)
+        func pinnedValues(_ where: Where<TestEntity1>) -> [Int]? {
+
+            return shardRouter.pinnedShardKeyValues(in: `where`.predicate)?
+                .compactMap({ ($0 as? NSNumber)?.intValue })
+        }
+        XCTAssertEqual(pinnedValues(Where("%K == %@", #keyPath(TestEntity1.testNumber), 3)), [3])
+        XCTAssertEqual(pinnedValues(Where("%K IN %@", #keyPath(TestEntity1.testNumber), [1, 2])), [1, 2])
+        XCTAssertEqual(
+            pinnedValues(
+                Where("%K == %@", #keyPath(TestEntity1.testNumber), 1)
+                    || Where("%K == %@", #keyPath(TestEntity1.testNumber), 2)
+            ),
+            [1, 2]
+        )
+        XCTAssertEqual(
+            pinnedValues(
+                Where("%K == %@", #keyPath(TestEntity1.testNumber), 1)
+                    && Where("%K == %@", #keyPath(TestEntity1.testString), "a")
+            ),
+            [1]
+        )
+        XCTAssertNil(pinnedValues(Where("%K > %@", #keyPath(TestEntity1.testNumber), 1)))
+        XCTAssertNil(pinnedValues(Where("%K == %@", #keyPath(TestEntity1.testEntityID), 1)))
+        XCTAssertNil(
+            pinnedValues(
+                Where("%K == %@", #keyPath(TestEntity1.testNumber), 1)
+                    || Where("%K == %@", #keyPath(TestEntity1.testString), "a")
+            )
+        )
+
+        XCTAssertEqual(ShardedSQLiteStore<TestEntity1>.defaultShardIndex(for: 6, shardCount: 4), 2)
+        XCTAssertEqual(ShardedSQLiteStore<TestEntity1>.defaultShardIndex(for: NSNumber(value: 6), shardCount: 4), 2)
+        XCTAssertEqual(
+            ShardedSQLiteStore<TestEntity1>.defaultShardIndex(for: "conversation", shardCount: 4),
+            ShardedSQLiteStore<TestEntity1>.defaultShardIndex(for: "conversation" as NSString, shardCount: 4)
+        )
+        XCTAssertTrue(shardedStore.storage(forShardKeyValue: 5) === shardedStore.storages[1])
+    }
+}
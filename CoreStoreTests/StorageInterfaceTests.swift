@@ -153,6 +153,33 @@ final class StorageInterfaceTests: XCTestCase {
         XCTAssertEqual(store.localStorageOptions, [.recreateStoreOnModelMismatch])
     }
     
+    @objc
+    dynamic func test_ThatReadOnlySQLiteStores_ConfigureCorrectly() {
+        
+        let fileURL = Bundle(for: Self.self).resourceURL!
+            .appendingPathComponent("Reference.sqlite", isDirectory: false)
+        let store = ReadOnlySQLiteStore(
+            bundle: Bundle(for: Self.self),
+            fileName: "Reference.sqlite",
+            configuration: "config1",
+            mmapSize: 1024
+        )
+        XCTAssertEqual(type(of: store).storeType, NSSQLiteStoreType)
+        XCTAssertEqual(store.configuration, "config1")
+        XCTAssertEqual(store.fileURL, fileURL)
+        XCTAssertEqual(store.localStorageOptions, .none)
+        XCTAssertTrue(store.migrationMappingProviders.isEmpty)
+        XCTAssertEqual(store.storeOptions?[NSReadOnlyPersistentStoreOption] as? Bool, true)
+        XCTAssertEqual(
+            store.storeOptions?[NSSQLitePragmasOption] as? NSDictionary,
+            ["journal_mode": "DELETE", "mmap_size": 1024] as NSDictionary
+        )
+        XCTAssertEqual(
+            store.dictionary(forOptions: .allowSynchronousLightweightMigration) as NSDictionary?,
+            store.storeOptions as NSDictionary?
+        )
+    }
+    
     @objc
     dynamic func test_ThatLegacySQLiteStoreDefaultDirectories_AreCorrect() {
         
@@ -71,6 +71,30 @@ final class WhereTests: XCTestCase {
         XCTAssertAllEqual(String(keyPath: \Animal.$color), "color")
     }
 
+    @objc
+    dynamic func test_ThatKeyPathStrings_AreCachedAcrossThreads() {
+
+        XCTAssertEqual(String(keyPath: \Animal.$color), "color")
+        XCTAssertEqual(
+            Internals.KeyPathStringCache.shared.keyPathString(for: \Animal.$color) {
+
+                XCTFail("Expected a cached key path string")
+                return ""
+            },
+            "color"
+        )
+
+        // Meta objects are not thread-safe to create, so resolve once before reading concurrently
+        XCTAssertEqual((\Animal.$master ~ \.$pets).description, "master.pets")
+        DispatchQueue.concurrentPerform(iterations: 100) { _ in
+
+            XCTAssertEqual(String(keyPath: \Animal.$color), "color")
+            XCTAssertEqual(String(keyPath: \TestEntity1.testEntityID), "testEntityID")
+            XCTAssertEqual((\Animal.$master ~ \.$pets).description, "master.pets")
+            XCTAssertEqual((\TestEntity1.testToOne ~ \.testEntityID).description, "testToOne.testEntityID")
+        }
+    }
+
     @objc
     dynamic func test_ThatExpressions_HaveCorrectKeyPaths() {
 
@@ -392,7 +416,48 @@ final class WhereTests: XCTestCase {
             XCTAssertAllEqual(whereClause.predicate, predicate)
         }
     }
-    
+
+    @objc
+    dynamic func test_ThatWhereClauses_BuildComparisonPredicatesDirectly() {
+
+        do {
+
+            let whereClause = Where<NSManagedObject>("size", isEqualTo: 1)
+            XCTAssertTrue(whereClause.predicate is NSComparisonPredicate)
+            XCTAssertAllEqual(whereClause.predicate, NSPredicate(format: "%K == %@", "size", NSNumber(value: 1)))
+        }
+        do {
+
+            let whereClause = Where<NSManagedObject>("key", isEqualTo: nil)
+            XCTAssertTrue(whereClause.predicate is NSComparisonPredicate)
+            XCTAssertAllEqual(whereClause.predicate, NSPredicate(format: "key == nil"))
+        }
+        do {
+
+            let whereClause = Where<NSManagedObject>("SELF", isEqualTo: "value")
+            XCTAssertAllEqual(whereClause.predicate, NSPredicate(format: "SELF == %@", "value"))
+        }
+        do {
+
+            let whereClause = Where<NSManagedObject>("any master.pets.species", isEqualTo: "dog")
+            XCTAssertAllEqual(whereClause.predicate, NSPredicate(format: "ANY master.pets.species == %@", "dog"))
+        }
+        do {
+
+            let whereClause = Where<NSManagedObject>("key + 1", isEqualTo: 2)
+            XCTAssertAllEqual(whereClause.predicate, NSPredicate(format: "key + 1 == %@", NSNumber(value: 2)))
+        }
+        do {
+
+            let first: Where<Animal> = (\.$master ~ \.$pets ~ \.$species).any() == "dog"
+            let second: Where<Animal> = (\.$master ~ \.$pets ~ \.$species).any() == "cat"
+            let firstComparison = first.predicate as? NSComparisonPredicate
+            let secondComparison = second.predicate as? NSComparisonPredicate
+            XCTAssertNotNil(firstComparison)
+            XCTAssertTrue(firstComparison?.leftExpression === secondComparison?.leftExpression)
+        }
+    }
+
     @objc
     dynamic func test_ThatWhereClauses_BridgeArgumentsCorrectly() {
         
@@ -32,7 +32,8 @@ let package = Package(
            .macOS(.v10_13), .iOS(.v11), .tvOS(.v11), .watchOS(.v4)
     ],
     products: [
-        .library(name: "CoreStore", targets: ["CoreStore"])
+        .library(name: "CoreStore", targets: ["CoreStore"]),
+        .executable(name: "CoreStoreBenchmarks", targets: ["CoreStoreBenchmarks"])
     ],
     dependencies: [],
     targets: [
@@ -47,6 +48,11 @@ let package = Package(
             dependencies: ["CoreStore"],
             path: "CoreStoreTests",
             exclude: ["BridgingTests.h", "BridgingTests.m"]
+        ),
+        .target(
+            name: "CoreStoreBenchmarks",
+            dependencies: ["CoreStore"],
+            path: "CoreStoreBenchmarks"
         )
     ],
     swiftLanguageVersions: [.v5]
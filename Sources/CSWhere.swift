@@ -88,8 +88,8 @@ public final class CSWhere: NSObject, CSFetchClause, CSQueryClause, CSDeleteClau
     public convenience init(keyPath: KeyPathString, isEqualTo value: CoreDataNativeType?) {
         
         self.init(value == nil || value is NSNull
-            ? Where("\(keyPath) == nil")
-            : Where("\(keyPath) == %@", value!))
+            ? Where<NSManagedObject>(keyPath, .equalTo, nil)
+            : Where<NSManagedObject>(keyPath, .equalTo, value!))
     }
     
     /**
@@ -101,7 +101,7 @@ public final class CSWhere: NSObject, CSFetchClause, CSQueryClause, CSDeleteClau
     @objc
     public convenience init(keyPath: KeyPathString, isMemberOf list: [CoreDataNativeType]) {
         
-        self.init(Where("\(keyPath) IN %@", list as NSArray))
+        self.init(Where<NSManagedObject>(keyPath, .in, list as NSArray))
     }
     
     /**
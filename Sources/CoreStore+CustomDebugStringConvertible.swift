@@ -201,6 +201,35 @@ extension DataStack: CustomDebugStringConvertible, CoreStoreDebugStringConvertib
 }
 
 
+// MARK: - DataStack.MemoryStatistics
+
+extension DataStack.MemoryStatistics: CustomDebugStringConvertible, CoreStoreDebugStringConvertible {
+    
+    // MARK: CustomDebugStringConvertible
+    
+    public var debugDescription: String {
+        
+        return formattedDebugDescription(self)
+    }
+    
+    
+    // MARK: CoreStoreDebugStringConvertible
+    
+    public var coreStoreDumpString: String {
+        
+        return createFormattedString(
+            "(", ")",
+            ("registeredObjectsInMainContext", self.registeredObjectsInMainContext),
+            ("registeredObjectsInRootContext", self.registeredObjectsInRootContext),
+            ("liveObjectPublishers", self.liveObjectPublishers),
+            ("liveObjectSnapshots", self.liveObjectSnapshots),
+            ("liveListPublishers", self.liveListPublishers),
+            ("liveListSnapshots", self.liveListSnapshots)
+        )
+    }
+}
+
+
 // MARK: - Entity
 
 extension Entity: CustomDebugStringConvertible, CoreStoreDebugStringConvertible {
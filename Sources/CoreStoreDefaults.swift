@@ -67,6 +67,31 @@ public enum CoreStoreDefaults {
     }
 
 
+    /**
+     Enables the live-object debug registry. While `true`, newly created `ObjectPublisher`, `ObjectSnapshot`, `ListPublisher`, and `ListSnapshot` instances are counted until they are released, and the counts are reported by `DataStack.memoryStatistics()`. Tracking adds bookkeeping to each instance, so this is meant for unit tests and benchmarks. Defaults to `false`.
+     - Note: Set this before creating the instances to be tracked. Instances created while tracking was disabled are never counted.
+     */
+    public static var tracksLiveObjects: Bool {
+
+        get {
+
+            return Internals.LiveObjectRegistry.isEnabled
+        }
+        set {
+
+            Internals.LiveObjectRegistry.isEnabled = newValue
+        }
+    }
+
+
+    /**
+     The maximum number of values that a single fetch sends to the store for an `IN` membership test, such as those created by `Where(_:isMemberOf:)` and by `importUniqueObjects(_:sourceArray:)`. Each value is bound as a separate SQLite parameter, so fetches, counts, and deletes that test membership in longer lists are split into one fetch per slice of the list, and their results are merged. Defaults to `500`.
+
+     Only membership tests on attributes, to-one relationships, or `SELF` that are combined with `&&` are split. Merged results are sorted in memory with the fetch request's sort descriptors, which may order strings differently from SQLite for descriptors that don't specify a comparison selector. `ListMonitor`s and `ListPublisher`s always send the whole list.
+     */
+    public static var maximumMembershipListCount: Int = 500
+
+
     // MARK: Private
 
     private static let defaultStackBarrierQueue = DispatchQueue.concurrent("com.coreStore.defaultStackBarrierQueue", qos: .userInteractive)
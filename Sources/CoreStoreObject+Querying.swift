@@ -60,7 +60,7 @@ extension FieldContainer.Stored {
      */
     public static func < (_ attribute: Self, _ value: V) -> Where<O> {
 
-        return Where("%K < %@", attribute.keyPath, value.cs_toFieldStoredNativeType() as Any)
+        return Where(attribute.keyPath, .lessThan, value.cs_toFieldStoredNativeType() as Any)
     }
 
     /**
@@ -71,7 +71,7 @@ extension FieldContainer.Stored {
      */
     public static func > (_ attribute: Self, _ value: V) -> Where<O> {
 
-        return Where("%K > %@", attribute.keyPath, value.cs_toFieldStoredNativeType() as Any)
+        return Where(attribute.keyPath, .greaterThan, value.cs_toFieldStoredNativeType() as Any)
     }
 
     /**
@@ -82,7 +82,7 @@ extension FieldContainer.Stored {
      */
     public static func <= (_ attribute: Self, _ value: V) -> Where<O> {
 
-        return Where("%K <= %@", attribute.keyPath, value.cs_toFieldStoredNativeType() as Any)
+        return Where(attribute.keyPath, .lessThanOrEqualTo, value.cs_toFieldStoredNativeType() as Any)
     }
 
     /**
@@ -93,7 +93,7 @@ extension FieldContainer.Stored {
      */
     public static func >= (_ attribute: Self, _ value: V) -> Where<O> {
 
-        return Where("%K >= %@", attribute.keyPath, value.cs_toFieldStoredNativeType() as Any)
+        return Where(attribute.keyPath, .greaterThanOrEqualTo, value.cs_toFieldStoredNativeType() as Any)
     }
 
     /**
@@ -142,7 +142,7 @@ extension ValueContainer.Required {
      */
     public static func < (_ attribute: ValueContainer<O>.Required<V>, _ value: V) -> Where<O> {
         
-        return Where("%K < %@", attribute.keyPath, value.cs_toQueryableNativeType())
+        return Where(attribute.keyPath, .lessThan, value.cs_toQueryableNativeType())
     }
     
     /**
@@ -153,7 +153,7 @@ extension ValueContainer.Required {
      */
     public static func > (_ attribute: ValueContainer<O>.Required<V>, _ value: V) -> Where<O> {
         
-        return Where("%K > %@", attribute.keyPath, value.cs_toQueryableNativeType())
+        return Where(attribute.keyPath, .greaterThan, value.cs_toQueryableNativeType())
     }
     
     /**
@@ -164,7 +164,7 @@ extension ValueContainer.Required {
      */
     public static func <= (_ attribute: ValueContainer<O>.Required<V>, _ value: V) -> Where<O> {
         
-        return Where("%K <= %@", attribute.keyPath, value.cs_toQueryableNativeType())
+        return Where(attribute.keyPath, .lessThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     
     /**
@@ -175,7 +175,7 @@ extension ValueContainer.Required {
      */
     public static func >= (_ attribute: ValueContainer<O>.Required<V>, _ value: V) -> Where<O> {
         
-        return Where("%K >= %@", attribute.keyPath, value.cs_toQueryableNativeType())
+        return Where(attribute.keyPath, .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     
     /**
@@ -227,11 +227,11 @@ extension ValueContainer.Optional {
         
         if let value = value {
             
-            return Where("%K < %@", attribute.keyPath, value.cs_toQueryableNativeType())
+            return Where(attribute.keyPath, .lessThan, value.cs_toQueryableNativeType())
         }
         else {
             
-            return Where("%K < nil", attribute.keyPath)
+            return Where(attribute.keyPath, .lessThan, nil)
         }
     }
     
@@ -245,11 +245,11 @@ extension ValueContainer.Optional {
         
         if let value = value {
             
-            return Where("%K > %@", attribute.keyPath, value.cs_toQueryableNativeType())
+            return Where(attribute.keyPath, .greaterThan, value.cs_toQueryableNativeType())
         }
         else {
             
-            return Where("%K > nil", attribute.keyPath)
+            return Where(attribute.keyPath, .greaterThan, nil)
         }
     }
     
@@ -263,11 +263,11 @@ extension ValueContainer.Optional {
         
         if let value = value {
             
-            return Where("%K <= %@", attribute.keyPath, value.cs_toQueryableNativeType())
+            return Where(attribute.keyPath, .lessThanOrEqualTo, value.cs_toQueryableNativeType())
         }
         else {
             
-            return Where("%K <= nil", attribute.keyPath)
+            return Where(attribute.keyPath, .lessThanOrEqualTo, nil)
         }
     }
     
@@ -281,11 +281,11 @@ extension ValueContainer.Optional {
         
         if let value = value {
             
-            return Where("%K >= %@", attribute.keyPath, value.cs_toQueryableNativeType())
+            return Where(attribute.keyPath, .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
         }
         else {
             
-            return Where("%K >= nil", attribute.keyPath)
+            return Where(attribute.keyPath, .greaterThanOrEqualTo, nil)
         }
     }
     
@@ -0,0 +1,515 @@
+//
+//  DataReader+Querying.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataReader
+
+extension DataReader: FetchableSource, QueryableSource {
+    
+    // MARK: FetchableSource
+    
+    /**
+     Fetches the `DynamicObject` instance in the reader's context from a reference created from a transaction, from the `DataStack`, or from a different reader.
+     
+     - parameter object: a reference to the object created/fetched outside the reader
+     - returns: the `DynamicObject` instance if the object exists in the reader, or `nil` if not found.
+     */
+    public func fetchExisting<O: DynamicObject>(_ object: O) -> O? {
+        
+        return self.fetchExisting(object.cs_id())
+    }
+    
+    /**
+     Fetches the `DynamicObject` instance in the reader's context from an `NSManagedObjectID`.
+     
+     - parameter objectID: the `NSManagedObjectID` for the object
+     - returns: the `DynamicObject` instance if the object exists in the reader, or `nil` if not found.
+     */
+    public func fetchExisting<O: DynamicObject>(_ objectID: NSManagedObjectID) -> O? {
+        
+        guard let objectID = self.context.objectIDInCoordinator(objectID) else {
+            
+            return nil
+        }
+        return self.context.fetchExisting(objectID)
+    }
+    
+    /**
+     Fetches the `DynamicObject` instances in the reader's context from references created from a transaction, from the `DataStack`, or from a different reader.
+     
+     - parameter objects: an array of `DynamicObject`s created/fetched outside the reader
+     - returns: the `DynamicObject` array for objects that exists in the reader
+     */
+    public func fetchExisting<O: DynamicObject, S: Sequence>(_ objects: S) -> [O] where S.Iterator.Element == O {
+        
+        return self.fetchExisting(objects.map({ $0.cs_id() }))
+    }
+    
+    /**
+     Fetches the `DynamicObject` instances in the reader's context from a list of `NSManagedObjectID`.
+     
+     - parameter objectIDs: the `NSManagedObjectID` array for the objects
+     - returns: the `DynamicObject` array for objects that exists in the reader
+     */
+    public func fetchExisting<O: DynamicObject, S: Sequence>(_ objectIDs: S) -> [O] where S.Iterator.Element == NSManagedObjectID {
+        
+        let context = self.context
+        return context.fetchExisting(objectIDs.compactMap(context.objectIDInCoordinator(_:)))
+    }
+    
+    /**
+     Fetches the first `DynamicObject` instance that satisfies the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the first `DynamicObject` instance that satisfies the specified `FetchClause`s, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchOne<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> O? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchOne(from, fetchClauses)
+    }
+    
+    /**
+     Fetches the first `DynamicObject` instance that satisfies the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the first `DynamicObject` instance that satisfies the specified `FetchClause`s, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchOne<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> O? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchOne(from, fetchClauses)
+    }
+    
+    /**
+     Fetches the first `DynamicObject` instance that satisfies the specified `FetchChainableBuilderType` built from a chain of clauses.
+     ```
+     let youngestTeen = reader.fetchOne(
+         From<MyPersonEntity>()
+             .where(\.age > 18)
+             .orderBy(.ascending(\.age))
+     )
+     ```
+     - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - returns: the first `DynamicObject` instance that satisfies the specified `FetchChainableBuilderType`, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchOne<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> B.ObjectType? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchOne(clauseChain)
+    }
+    
+    /**
+     Fetches all `DynamicObject` instances that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: all `DynamicObject` instances that satisfy the specified `FetchClause`s, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchAll<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> [O] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchAll(from, fetchClauses)
+    }
+    
+    /**
+     Fetches all `DynamicObject` instances that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: all `DynamicObject` instances that satisfy the specified `FetchClause`s, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchAll<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> [O] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchAll(from, fetchClauses)
+    }
+    
+    /**
+     Fetches all `DynamicObject` instances that satisfy the specified `FetchChainableBuilderType` built from a chain of clauses.
+     ```
+     let people = reader.fetchAll(
+         From<MyPersonEntity>()
+             .where(\.age > 18)
+             .orderBy(.ascending(\.age))
+     )
+     ```
+     - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - returns: all `DynamicObject` instances that satisfy the specified `FetchChainableBuilderType`, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchAll<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> [B.ObjectType] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchAll(clauseChain)
+    }
+    
+    /**
+     Fetches the number of `DynamicObject`s that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the number of `DynamicObject`s that satisfy the specified `FetchClause`s
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchCount<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> Int {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchCount(from, fetchClauses)
+    }
+    
+    /**
+     Fetches the number of `DynamicObject`s that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the number of `DynamicObject`s that satisfy the specified `FetchClause`s
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchCount<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> Int {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchCount(from, fetchClauses)
+    }
+    
+    /**
+     Fetches the number of `DynamicObject`s that satisfy the specified `FetchChainableBuilderType` built from a chain of clauses.
+     ```
+     let numberOfAdults = reader.fetchCount(
+         From<MyPersonEntity>()
+             .where(\.age > 18)
+             .orderBy(.ascending(\.age))
+     )
+     ```
+     - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - returns: the number of `DynamicObject`s that satisfy the specified `FetchChainableBuilderType`
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchCount<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> Int {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchCount(clauseChain)
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchClause`s, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectID<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> NSManagedObjectID? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchObjectID(from, fetchClauses).flatMap(self.importedObjectID(_:))
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchClause`s, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectID<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> NSManagedObjectID? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchObjectID(from, fetchClauses).flatMap(self.importedObjectID(_:))
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchChainableBuilderType` built from a chain of clauses.
+     ```
+     let youngestTeenID = reader.fetchObjectID(
+         From<MyPersonEntity>()
+             .where(\.age > 18)
+             .orderBy(.ascending(\.age))
+     )
+     ```
+     - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - returns: the `NSManagedObjectID` for the first `DynamicObject` that satisfies the specified `FetchChainableBuilderType`, or `nil` if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectID<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> NSManagedObjectID? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.context.fetchObjectID(clauseChain).flatMap(self.importedObjectID(_:))
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchClause`s, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectIDs<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> [NSManagedObjectID] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedObjectIDs(self.context.fetchObjectIDs(from, fetchClauses))
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchClause`s. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter fetchClauses: a series of `FetchClause` instances for the fetch request. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - returns: the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchClause`s, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectIDs<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> [NSManagedObjectID] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedObjectIDs(self.context.fetchObjectIDs(from, fetchClauses))
+    }
+    
+    /**
+     Fetches the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchChainableBuilderType` built from a chain of clauses.
+     ```
+     let idsOfAdults = reader.fetchObjectIDs(
+         From<MyPersonEntity>()
+             .where(\.age > 18)
+             .orderBy(.ascending(\.age))
+     )
+     ```
+     - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - returns: the `NSManagedObjectID` for all `DynamicObject`s that satisfy the specified `FetchChainableBuilderType`, or an empty array if no match was found
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func fetchObjectIDs<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> [NSManagedObjectID] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to fetch from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedObjectIDs(self.context.fetchObjectIDs(clauseChain))
+    }
+    
+    
+    // MARK: QueryableSource
+    
+    /**
+     Queries aggregate values as specified by the `QueryClause`s. Requires at least a `Select` clause, and optional `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter selectClause: a `Select<U>` clause indicating the properties to fetch, and with the generic type indicating the return type.
+     - parameter queryClauses: a series of `QueryClause` instances for the query request. Accepts `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     - returns: the result of the the query, or `nil` if no match was found. The type of the return value is specified by the generic type of the `Select<U>` parameter.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryValue<O, U: QueryableAttributeType>(_ from: From<O>, _ selectClause: Select<O, U>, _ queryClauses: QueryClause...) throws -> U? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedValue(self.context.queryValue(from, selectClause, queryClauses))
+    }
+    
+    /**
+     Queries aggregate values or aggregates as specified by the `QueryClause`s. Requires at least a `Select` clause, and optional `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter selectClause: a `Select<U>` clause indicating the properties to fetch, and with the generic type indicating the return type.
+     - parameter queryClauses: a series of `QueryClause` instances for the query request. Accepts `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     - returns: the result of the the query, or `nil` if no match was found. The type of the return value is specified by the generic type of the `Select<U>` parameter.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryValue<O, U: QueryableAttributeType>(_ from: From<O>, _ selectClause: Select<O, U>, _ queryClauses: [QueryClause]) throws -> U? {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedValue(self.context.queryValue(from, selectClause, queryClauses))
+    }
+    
+    /**
+     Queries a property value or aggregate as specified by the `QueryChainableBuilderType` built from a chain of clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     ```
+     let averageAdultAge = reader.queryValue(
+         From<MyPersonEntity>()
+             .select(Int.self, .average(\.age))
+             .where(\.age > 18)
+     )
+     ```
+     - parameter clauseChain: a `QueryChainableBuilderType` indicating the property/aggregate to fetch and the series of queries for the request.
+     - returns: the result of the the query as specified by the `QueryChainableBuilderType`, or `nil` if no match was found.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryValue<B: QueryChainableBuilderType>(_ clauseChain: B) throws -> B.ResultType? where B.ResultType: QueryableAttributeType {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedValue(self.context.queryValue(clauseChain.from, clauseChain.select, clauseChain.queryClauses))
+    }
+    
+    /**
+     Queries a dictionary of attribute values as specified by the `QueryClause`s. Requires at least a `Select` clause, and optional `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter selectClause: a `Select<U>` clause indicating the properties to fetch, and with the generic type indicating the return type.
+     - parameter queryClauses: a series of `QueryClause` instances for the query request. Accepts `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     - returns: the result of the the query. The type of the return value is specified by the generic type of the `Select<U>` parameter.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryAttributes<O>(_ from: From<O>, _ selectClause: Select<O, NSDictionary>, _ queryClauses: QueryClause...) throws -> [[String: Any]] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedAttributes(self.context.queryAttributes(from, selectClause, queryClauses))
+    }
+    
+    /**
+     Queries a dictionary of attribute values as specified by the `QueryClause`s. Requires at least a `Select` clause, and optional `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     
+     - parameter from: a `From` clause indicating the entity type
+     - parameter selectClause: a `Select<U>` clause indicating the properties to fetch, and with the generic type indicating the return type.
+     - parameter queryClauses: a series of `QueryClause` instances for the query request. Accepts `Where`, `OrderBy`, `GroupBy`, and `Tweak` clauses.
+     - returns: the result of the the query. The type of the return value is specified by the generic type of the `Select<U>` parameter.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryAttributes<O>(_ from: From<O>, _ selectClause: Select<O, NSDictionary>, _ queryClauses: [QueryClause]) throws -> [[String: Any]] {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedAttributes(self.context.queryAttributes(from, selectClause, queryClauses))
+    }
+    
+    /**
+     Queries a dictionary of attribute values or  as specified by the `QueryChainableBuilderType` built from a chain of clauses.
+     
+     A "query" differs from a "fetch" in that it only retrieves values already stored in the persistent store. As such, values from unsaved transactions or contexts will not be incorporated in the query result.
+     ```
+     let results = reader.queryAttributes(
+         From<MyPersonEntity>()
+             .select(
+                 NSDictionary.self,
+                 .attribute(\.age, as: "age"),
+                 .count(\.age, as: "numberOfPeople")
+              )
+             .groupBy(\.age)
+     )
+     for dictionary in results! {
+         let age = dictionary["age"] as! Int
+         let count = dictionary["numberOfPeople"] as! Int
+         print("There are \(count) people who are \(age) years old."
+     }
+     ```
+     - parameter clauseChain: a `QueryChainableBuilderType` indicating the properties to fetch and the series of queries for the request.
+     - returns: the result of the the query as specified by the `QueryChainableBuilderType`
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema.
+     */
+    public func queryAttributes<B: QueryChainableBuilderType>(_ clauseChain: B) throws -> [[String: Any]] where B.ResultType == NSDictionary {
+        
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to query from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        return try self.importedAttributes(self.context.queryAttributes(clauseChain.from, clauseChain.select, clauseChain.queryClauses))
+    }
+    
+    
+    // MARK: FetchableSource, QueryableSource
+    
+    /**
+     The internal `NSManagedObjectContext` managed by this instance. Using this context directly should typically be avoided, and is provided by CoreStore only for extremely specialized cases.
+     */
+    public func unsafeContext() -> NSManagedObjectContext {
+        
+        return self.context
+    }
+}
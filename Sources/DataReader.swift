@@ -0,0 +1,202 @@
+//
+//  DataReader.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataReader
+
+/**
+ The `DataReader` provides read-only fetches and queries from a background context. A reader is only valid within the closure passed to `DataStack.read(...)`, which runs on a pooled read-only connection to the `DataStack`'s `SQLiteStore`s so that reads neither wait on the main queue nor queue behind transactions.
+
+ Objects fetched from a reader are reset as soon as the closure returns, so they should not escape it. Return `NSManagedObjectID`s, queried values, or `ObjectSnapshot`s created with `snapshot(of:)` instead:
+ ```
+ let adults: [ObjectSnapshot<Person>] = try dataStack.read { (reader) in
+
+     let people = try reader.fetchAll(From<Person>().where(\.age >= 18))
+     return reader.snapshots(of: people)
+ }
+ ```
+ `NSManagedObjectID`s returned from a reader's methods always belong to the `DataStack`, and can be passed to the `DataStack` or to other readers and transactions.
+ - Important: Readers only see changes that were already saved to the persistent store.
+ */
+public final class DataReader {
+
+    // MARK: Public
+
+    /**
+     Creates an `ObjectSnapshot` from an object fetched from this reader. The snapshot's values are read immediately from the reader's context, and the snapshot remains valid after the reader's closure returns.
+
+     - parameter object: an object fetched from this reader
+     - returns: the `ObjectSnapshot` for the object, or `nil` if the object no longer exists
+     */
+    public func snapshot<O: DynamicObject>(of object: O) -> ObjectSnapshot<O>? {
+
+        Internals.assert(
+            self.isRunningInAllowedQueue(),
+            "Attempted to read from a \(Internals.typeName(self)) outside its designated queue."
+        )
+        let readerObjectID = object.cs_id()
+        guard let values = O.cs_snapshotDictionary(id: readerObjectID, context: self.context),
+            let objectID = self.readerPool.importedObjectID(readerObjectID) else {
+
+            return nil
+        }
+        return ObjectSnapshot<O>(
+            objectID: objectID,
+            context: self.dataStack.mainContext,
+            values: values.mapValues({ self.readerPool.importedValue($0) ?? $0 })
+        )
+    }
+
+    /**
+     Creates `ObjectSnapshot`s from objects fetched from this reader. The snapshots' values are read immediately from the reader's context, and the snapshots remain valid after the reader's closure returns.
+
+     - parameter objects: a sequence of objects fetched from this reader
+     - returns: the `ObjectSnapshot`s for the objects that still exist, in the same order
+     */
+    public func snapshots<O: DynamicObject, S: Sequence>(of objects: S) -> [ObjectSnapshot<O>] where S.Iterator.Element == O {
+
+        return objects.compactMap({ self.snapshot(of: $0) })
+    }
+
+    /**
+     Returns the `NSManagedObjectID` of an object fetched from this reader, usable outside the reader's closure.
+
+     - parameter object: an object fetched from this reader
+     - returns: the `NSManagedObjectID` of the object in the `DataStack`
+     */
+    public func objectID<O: DynamicObject>(of object: O) -> O.ObjectID? {
+
+        return self.readerPool.importedObjectID(object.cs_id())
+    }
+
+
+    // MARK: Internal
+
+    internal let context: NSManagedObjectContext
+    internal let dataStack: DataStack
+
+    internal init(context: NSManagedObjectContext, dataStack: DataStack) {
+
+        self.context = context
+        self.dataStack = dataStack
+        self.readerPool = dataStack.readerPool
+    }
+
+    internal func isRunningInAllowedQueue() -> Bool {
+
+        return self.runningThread == Thread.current
+    }
+
+    internal func importedObjectID(_ objectID: NSManagedObjectID) -> NSManagedObjectID? {
+
+        return self.readerPool.importedObjectID(objectID)
+    }
+
+    internal func importedObjectIDs(_ objectIDs: [NSManagedObjectID]) -> [NSManagedObjectID] {
+
+        return self.readerPool.importedObjectIDs(objectIDs)
+    }
+
+    internal func importedValue<T>(_ value: T?) -> T? {
+
+        return self.readerPool.importedValue(value)
+    }
+
+    internal func importedAttributes(_ attributes: [[String: Any]]) -> [[String: Any]] {
+
+        return self.readerPool.importedAttributes(attributes)
+    }
+
+    /**
+     Runs `task` with this reader. Must be called from within the context's queue.
+     */
+    internal func run<T>(_ task: (_ reader: DataReader) throws -> T) throws -> T {
+
+        self.runningThread = Thread.current
+        self.context.parentReader = self
+        defer {
+
+            self.context.parentReader = nil
+            self.runningThread = nil
+        }
+        do {
+
+            return try task(self)
+        }
+        catch let error as CoreStoreError {
+
+            throw error
+        }
+        catch {
+
+            throw CoreStoreError.userError(error: error)
+        }
+    }
+
+
+    // MARK: Private
+
+    private let readerPool: Internals.ReaderPool
+    private var runningThread: Thread?
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    @nonobjc
+    internal weak var parentReader: DataReader? {
+
+        get {
+
+            return Internals.getAssociatedObjectForKey(
+                &PropertyKeys.parentReader,
+                inObject: self
+            )
+        }
+        set {
+
+            Internals.setAssociatedWeakObject(
+                newValue,
+                forKey: &PropertyKeys.parentReader,
+                inObject: self
+            )
+        }
+    }
+
+
+    // MARK: Private
+
+    private struct PropertyKeys {
+
+        static var parentReader: Void?
+    }
+}
@@ -0,0 +1,561 @@
+//
+//  DataStack+ChangeFeed.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Fetches the changes committed to the stack's history-tracking `SQLiteStore`s after a cursor, in commit order. Only stores added with `SQLiteStore.tracksPersistentHistory` enabled record changes.
+     ```
+     let changes = try dataStack.fetchChanges(after: savedCursor, limit: 200)
+     for change in changes {
+
+         try upload(change)
+         savedCursor = change.cursor
+     }
+     ```
+     Each `Change` carries the cursor that resumes right after it, so consumers only need to persist the `cursor` of the last change they processed. Changes from multiple stores are returned one store at a time, and are only ordered within each store.
+     - parameter cursor: the position to read after. Defaults to `.start`, which reads all recorded changes.
+     - parameter limit: the maximum number of changes to return. Defaults to `500`.
+     - throws: a `CoreStoreError` value indicating the failure
+     - returns: the changes committed after `cursor`, or an empty array if there were none
+     */
+    public func fetchChanges(after cursor: ChangeCursor = .start, limit: Int = 500) throws -> [Change] {
+
+        let context = self.changeFeedContext()
+        var changes: [Change] = []
+        var runningCursor = cursor
+        var fetchError: Error?
+        context.performAndWait {
+
+            do {
+
+                for persistentStore in self.historyTrackingPersistentStores() where changes.count < limit {
+
+                    guard let storeIdentifier = persistentStore.identifier else {
+
+                        continue
+                    }
+                    let position = runningCursor.positions[storeIdentifier]
+                    var previousToken = position?.token
+                    var hasMoreTransactions = true
+                    while hasMoreTransactions && changes.count < limit {
+
+                        let request = NSPersistentHistoryChangeRequest.fetchHistory(after: previousToken)
+                        request.resultType = .transactionsAndChanges
+                        request.affectedStores = [persistentStore]
+
+                        // Every transaction after the cursor has at least one unread change, so fetching more transactions than the remaining limit would only read history that is thrown away
+                        let transactionLimit = limit - changes.count
+                        if #available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *),
+                            let fetchRequest = NSPersistentHistoryTransaction.fetchRequest {
+
+                            fetchRequest.fetchLimit = transactionLimit
+                            request.fetchRequest = fetchRequest
+                        }
+                        let result = try context.execute(request) as? NSPersistentHistoryResult
+                        let transactions = (result?.result as? [NSPersistentHistoryTransaction]) ?? []
+                        hasMoreTransactions = request.fetchRequest != nil && transactions.count == transactionLimit
+
+                        transactions: for transaction in transactions {
+
+                            let transactionChanges = transaction.changes ?? []
+                            for (index, change) in transactionChanges.enumerated() {
+
+                                if let lastChangeID = position?.changeID, change.changeID <= lastChangeID {
+
+                                    continue
+                                }
+                                guard changes.count < limit else {
+
+                                    break transactions
+                                }
+                                // A partially read transaction is read again from its start, skipping up to `changeID`
+                                runningCursor.positions[storeIdentifier] = try ChangeCursor.Position(
+                                    token: index == transactionChanges.count - 1 ? transaction.token : previousToken,
+                                    changeID: change.changeID
+                                )
+                                changes.append(
+                                    Change(
+                                        change,
+                                        in: transaction,
+                                        storeIdentifier: storeIdentifier,
+                                        cursor: runningCursor
+                                    )
+                                )
+                            }
+                            previousToken = transaction.token
+                        }
+                        context.reset()
+                    }
+                }
+            }
+            catch {
+
+                fetchError = error
+            }
+            context.reset()
+        }
+        if let fetchError = fetchError {
+
+            let coreStoreError = CoreStoreError(fetchError)
+            Internals.log(
+                coreStoreError,
+                "Failed to fetch the persistent history."
+            )
+            throw coreStoreError
+        }
+        return changes
+    }
+
+    /**
+     Deletes the recorded changes up to a cursor, such as the `cursor` of the last change that every consumer has processed. Changes after the cursor are kept.
+     - parameter cursor: the position up to which recorded changes are deleted
+     - throws: a `CoreStoreError` value indicating the failure
+     */
+    public func compactChanges(before cursor: ChangeCursor) throws {
+
+        let context = self.changeFeedContext()
+        var compactError: Error?
+        context.performAndWait {
+
+            do {
+
+                for persistentStore in self.historyTrackingPersistentStores() {
+
+                    guard let storeIdentifier = persistentStore.identifier,
+                        let token = cursor.positions[storeIdentifier]?.token else {
+
+                        continue
+                    }
+                    let request = NSPersistentHistoryChangeRequest.deleteHistory(before: token)
+                    request.affectedStores = [persistentStore]
+                    try context.execute(request)
+                }
+            }
+            catch {
+
+                compactError = error
+            }
+        }
+        if let compactError = compactError {
+
+            let coreStoreError = CoreStoreError(compactError)
+            Internals.log(
+                coreStoreError,
+                "Failed to compact the persistent history."
+            )
+            throw coreStoreError
+        }
+    }
+
+
+    // MARK: - Change
+
+    /**
+     A single insert, update, or delete committed to a history-tracking `SQLiteStore`. Returned by `DataStack.fetchChanges(after:limit:)`.
+     */
+    public struct Change {
+
+        /**
+         The kind of change
+         */
+        public enum Operation: Hashable {
+
+            case insert
+            case update
+            case delete
+        }
+
+        /**
+         The sequence number of the change. Sequence numbers increase monotonically within each store.
+         */
+        public let sequence: Int64
+
+        /**
+         The identifier of the store where the change was committed
+         */
+        public let storeIdentifier: String
+
+        /**
+         The kind of change
+         */
+        public let operation: Operation
+
+        /**
+         The name of the changed object's entity
+         */
+        public let entityName: EntityName
+
+        /**
+         The `NSManagedObjectID` of the changed object. For deletes, the object no longer exists in the store.
+         */
+        public let objectID: NSManagedObjectID
+
+        /**
+         The names of the properties changed by an update, or an empty set for inserts and deletes
+         */
+        public let changedKeys: Set<KeyPathString>
+
+        /**
+         For deletes, the values of the object's attributes that were marked with "Preserve After Deletion" (`preservesValueInHistoryOnDeletion`) in the model, such as a unique ID that a server knows the object by
+         */
+        public let tombstone: [String: Any]?
+
+        /**
+         The time the change was committed
+         */
+        public let timestamp: Date
+
+        /**
+         The cursor that resumes reading right after this change
+         */
+        public let cursor: ChangeCursor
+
+
+        // MARK: FilePrivate
+
+        fileprivate init(_ change: NSPersistentHistoryChange, in transaction: NSPersistentHistoryTransaction, storeIdentifier: String, cursor: ChangeCursor) {
+
+            self.sequence = change.changeID
+            self.storeIdentifier = storeIdentifier
+            switch change.changeType {
+
+            case .insert:
+                self.operation = .insert
+
+            case .update:
+                self.operation = .update
+
+            case .delete:
+                self.operation = .delete
+
+            @unknown default:
+                self.operation = .update
+            }
+            self.entityName = change.changedObjectID.entity.name ?? ""
+            self.objectID = change.changedObjectID
+            self.changedKeys = Set((change.updatedProperties ?? []).map({ $0.name }))
+            self.tombstone = change.tombstone as? [String: Any]
+            self.timestamp = transaction.timestamp
+            self.cursor = cursor
+        }
+    }
+
+
+    // MARK: - ChangeCursor
+
+    /**
+     A position in the stack's change history. Cursors are `Codable`, so consumers can persist the `cursor` of the last `Change` they processed and resume from it after relaunching.
+     */
+    public struct ChangeCursor: Hashable, Codable {
+
+        /**
+         The position before all recorded changes
+         */
+        public static let start = ChangeCursor(positions: [:])
+
+
+        // MARK: Internal
+
+        internal var positions: [String: Position]
+
+
+        // MARK: - Position
+
+        internal struct Position: Hashable, Codable {
+
+            internal let tokenData: Data?
+            internal let changeID: Int64
+
+            internal init(token: NSPersistentHistoryToken?, changeID: Int64) throws {
+
+                self.tokenData = try token.map({ try NSKeyedArchiver.archivedData(withRootObject: $0, requiringSecureCoding: true) })
+                self.changeID = changeID
+            }
+
+            internal var token: NSPersistentHistoryToken? {
+
+                return self.tokenData.flatMap({ try? NSKeyedUnarchiver.unarchivedObject(ofClass: NSPersistentHistoryToken.self, from: $0) })
+            }
+        }
+    }
+
+
+    // MARK: Private
+
+    private func changeFeedContext() -> NSManagedObjectContext {
+
+        let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+        context.persistentStoreCoordinator = self.coordinator
+        context.undoManager = nil
+        context.name = "com.coreStore.changeFeedContext"
+        return context
+    }
+
+    private func historyTrackingPersistentStores() -> [NSPersistentStore] {
+
+        return self.coordinator.persistentStores
+            .filter({ ($0.options?[NSPersistentHistoryTrackingKey] as? NSNumber)?.boolValue == true })
+            .sorted(by: { ($0.identifier ?? "") < ($1.identifier ?? "") })
+    }
+}
+
+
+#if swift(>=5.5) && canImport(_Concurrency)
+
+// MARK: - DataStack
+
+@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)
+extension DataStack {
+
+    /**
+     Returns an `AsyncSequence` of the changes committed after a cursor. The sequence first reads the changes that were already recorded, then waits for the stack to commit more, so it only ends when the consuming task is cancelled or the `DataStack` is deallocated.
+     ```
+     for try await change in dataStack.changes(after: savedCursor) {
+
+         try await upload(change)
+         savedCursor = change.cursor
+     }
+     ```
+     - parameter cursor: the position to read after. Defaults to `.start`, which reads all recorded changes.
+     - parameter batchSize: the maximum number of changes fetched at a time. Defaults to `100`.
+     - returns: an `AsyncSequence` of `Change`s
+     */
+    public func changes(after cursor: ChangeCursor = .start, batchSize: Int = 100) -> ChangeSequence {
+
+        return ChangeSequence(
+            dataStack: self,
+            cursor: cursor,
+            batchSize: Swift.max(1, batchSize)
+        )
+    }
+
+
+    // MARK: - ChangeSequence
+
+    /**
+     An `AsyncSequence` of the changes committed to a `DataStack`. Created with `DataStack.changes(after:batchSize:)`.
+     */
+    public struct ChangeSequence: AsyncSequence {
+
+        // MARK: AsyncSequence
+
+        public typealias Element = Change
+
+        public func makeAsyncIterator() -> Iterator {
+
+            return Iterator(
+                dataStack: self.dataStack,
+                cursor: self.cursor,
+                batchSize: self.batchSize
+            )
+        }
+
+
+        // MARK: - Iterator
+
+        public struct Iterator: AsyncIteratorProtocol {
+
+            // MARK: AsyncIteratorProtocol
+
+            public mutating func next() async throws -> Change? {
+
+                while true {
+
+                    if !self.bufferedChanges.isEmpty {
+
+                        return self.bufferedChanges.removeFirst()
+                    }
+                    guard !Task.isCancelled,
+                        let dataStack = self.dataStack else {
+
+                        return nil
+                    }
+                    let generation = self.saveSignal.generation
+                    let cursor = self.cursor
+                    let batchSize = self.batchSize
+                    let changes = try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<[Change], Error>) in
+
+                        dataStack.readerQueue.async {
+
+                            continuation.resume(with: Result(catching: { try dataStack.fetchChanges(after: cursor, limit: batchSize) }))
+                        }
+                    }
+                    if let lastChange = changes.last {
+
+                        self.cursor = lastChange.cursor
+                        self.bufferedChanges = changes
+                        continue
+                    }
+                    await self.saveSignal.wait(after: generation)
+                }
+            }
+
+
+            // MARK: FilePrivate
+
+            fileprivate init(dataStack: DataStack, cursor: ChangeCursor, batchSize: Int) {
+
+                self.dataStack = dataStack
+                self.cursor = cursor
+                self.batchSize = batchSize
+                self.saveSignal = Internals.ContextSaveSignal(dataStack: dataStack)
+            }
+
+
+            // MARK: Private
+
+            private weak var dataStack: DataStack?
+            private var cursor: ChangeCursor
+            private let batchSize: Int
+            private let saveSignal: Internals.ContextSaveSignal
+            private var bufferedChanges: [Change] = []
+        }
+
+
+        // MARK: FilePrivate
+
+        fileprivate init(dataStack: DataStack, cursor: ChangeCursor, batchSize: Int) {
+
+            self.dataStack = dataStack
+            self.cursor = cursor
+            self.batchSize = batchSize
+        }
+
+
+        // MARK: Private
+
+        private let dataStack: DataStack
+        private let cursor: ChangeCursor
+        private let batchSize: Int
+    }
+}
+
+
+// MARK: - Internals
+
+@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)
+extension Internals {
+
+    // MARK: - ContextSaveSignal
+
+    /**
+     Counts the saves of a `DataStack`'s root saving context and the batch deletes that bypass it, such as expired object purges, and lets tasks wait until one happens after a given count. Waiting tasks also resume when they are cancelled.
+     */
+    internal final class ContextSaveSignal {
+
+        // MARK: Internal
+
+        internal init(dataStack: DataStack) {
+
+            self.observers = [
+                NotificationCenter.default.addObserver(
+                    forName: .NSManagedObjectContextDidSave,
+                    object: dataStack.rootSavingContext,
+                    queue: nil,
+                    using: { [weak self] _ in self?.signal() }
+                ),
+                NotificationCenter.default.addObserver(
+                    forName: .dataStackDidBatchDeleteObjects,
+                    object: dataStack,
+                    queue: nil,
+                    using: { [weak self] _ in self?.signal() }
+                )
+            ]
+        }
+
+        deinit {
+
+            self.observers.forEach({ NotificationCenter.default.removeObserver($0) })
+            self.signal()
+        }
+
+        internal var generation: Int {
+
+            self.lock.lock()
+            defer {
+
+                self.lock.unlock()
+            }
+            return self.currentGeneration
+        }
+
+        internal func wait(after generation: Int) async {
+
+            let waiterID = UUID()
+            await withTaskCancellationHandler(
+                operation: {
+
+                    await withCheckedContinuation { (continuation: CheckedContinuation<Void, Never>) in
+
+                        self.lock.lock()
+                        guard self.currentGeneration == generation, !Task.isCancelled else {
+
+                            self.lock.unlock()
+                            continuation.resume()
+                            return
+                        }
+                        self.waiters[waiterID] = continuation
+                        self.lock.unlock()
+                    }
+                },
+                onCancel: {
+
+                    self.lock.lock()
+                    let continuation = self.waiters.removeValue(forKey: waiterID)
+                    self.lock.unlock()
+                    continuation?.resume()
+                }
+            )
+        }
+
+
+        // MARK: Private
+
+        private let lock = NSLock()
+        private var observers: [NSObjectProtocol] = []
+        private var currentGeneration = 0
+        private var waiters: [UUID: CheckedContinuation<Void, Never>] = [:]
+
+        private func signal() {
+
+            self.lock.lock()
+            self.currentGeneration += 1
+            let waiters = self.waiters.values
+            self.waiters.removeAll()
+            self.lock.unlock()
+
+            waiters.forEach({ $0.resume() })
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,232 @@
+//
+//  DataStack+Expiry.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Declares entities whose objects expire after a maximum age, and how often the `DataStack` purges them in the background. Defaults to `nil`, where nothing is purged.
+     ```
+     dataStack.expiryPolicy = DataStack.ExpiryPolicy(
+         rules: [
+             .entity(From<CachedImage>(), expiresAfter: 7 * 24 * 60 * 60, since: #keyPath(CachedImage.lastFetchedAt))
+         ],
+         interval: 60 * 60,
+         reportHandler: { (report) in
+
+             print("Purged \(report.purgedObjectCount) expired object(s)")
+         }
+     )
+     ```
+     Expired objects are found by their object IDs in batches of `batchSize`, and each batch is deleted from `SQLiteStore`s with an `NSBatchDeleteRequest` without loading the objects into memory. The deletions are then merged into the `DataStack`'s contexts, so `ObjectPublisher`s and `ListPublisher`s are notified as if the objects were deleted in a transaction.
+
+     For thread safety, this property needs to be accessed from the main thread. Setting a new policy restarts the schedule, with the first purge running after `interval`. Call `purgeExpiredObjects(completion:)` to purge immediately, such as right after storages are added.
+     - Important: Batch deletes bypass the context, so relationship delete rules other than `.cascade` and `.nullify`, as well as validation, are not evaluated for purged objects.
+     */
+    public var expiryPolicy: ExpiryPolicy? {
+
+        get {
+
+            Internals.assert(
+                Thread.isMainThread,
+                "Attempted to access the \(Internals.typeName(self)).expiryPolicy outside the main thread."
+            )
+            return self.expiryScheduler.policy
+        }
+        set {
+
+            Internals.assert(
+                Thread.isMainThread,
+                "Attempted to set the \(Internals.typeName(self)).expiryPolicy outside the main thread."
+            )
+            self.expiryScheduler.policy = newValue
+        }
+    }
+
+    /**
+     Purges the objects that expired according to the `expiryPolicy` without waiting for its next scheduled purge. Purges never run concurrently, so if a scheduled purge is in progress this purge starts after it finishes.
+
+     For thread safety, this method needs to be called from the main thread.
+     - parameter completion: the closure to execute on the main queue after the purge completes. The `expiryPolicy`'s `reportHandler` is also notified.
+     */
+    public func purgeExpiredObjects(completion: ((ExpiryPolicy.Report) -> Void)? = nil) {
+
+        Internals.assert(
+            Thread.isMainThread,
+            "Attempted to purge expired objects outside the main thread."
+        )
+        self.expiryScheduler.purge(completion: completion)
+    }
+
+
+    // MARK: - ExpiryPolicy
+
+    /**
+     The configuration for `DataStack.expiryPolicy`.
+     */
+    public struct ExpiryPolicy {
+
+        /**
+         The entities to purge, in order
+         */
+        public var rules: [Rule]
+
+        /**
+         The number of seconds between background purges
+         */
+        public var interval: TimeInterval
+
+        /**
+         The maximum number of objects deleted by a single batch delete request. Smaller batches keep the store's write lock for shorter periods.
+         */
+        public var batchSize: Int
+
+        /**
+         The closure to execute on the main queue after each purge, including purges started with `DataStack.purgeExpiredObjects(completion:)`
+         */
+        public var reportHandler: ((Report) -> Void)?
+
+        /**
+         Initializes an `ExpiryPolicy`.
+
+         - parameter rules: the entities to purge, in order
+         - parameter interval: the number of seconds between background purges. Defaults to one hour.
+         - parameter batchSize: the maximum number of objects deleted by a single batch delete request. Defaults to `500`.
+         - parameter reportHandler: the closure to execute on the main queue after each purge
+         */
+        public init(rules: [Rule], interval: TimeInterval = 60 * 60, batchSize: Int = 500, reportHandler: ((Report) -> Void)? = nil) {
+
+            self.rules = rules
+            self.interval = Swift.max(1, interval)
+            self.batchSize = Swift.max(1, batchSize)
+            self.reportHandler = reportHandler
+        }
+
+
+        // MARK: - Rule
+
+        /**
+         An entity whose objects expire after a maximum age.
+         */
+        public struct Rule {
+
+            /**
+             Declares that objects of an entity expire once the date at a key path is older than `maximumAge`. Objects where the key path is `nil` never expire.
+
+             - parameter from: a `From` clause indicating the entity type
+             - parameter maximumAge: the number of seconds after which an object expires
+             - parameter keyPath: the key path of a `Date` attribute, such as the time the object was last fetched or accessed
+             */
+            public static func entity<O>(_ from: From<O>, expiresAfter maximumAge: TimeInterval, since keyPath: KeyPathString) -> Rule {
+
+                return Rule(
+                    typeName: Internals.typeName(O.self),
+                    purge: { (context, now, batchSize) in
+
+                        let entityName = context.parentStack?
+                            .entityDescription(for: Internals.EntityIdentifier(O.self))?
+                            .name ?? String(describing: O.self)
+                        let cutoffDate = now.addingTimeInterval(-maximumAge)
+                        var purgedObjectCount = 0
+                        var batchCount = 0
+                        while true {
+
+                            let objectIDs: [NSManagedObjectID] = try autoreleasepool {
+
+                                let fetchRequest = Internals.CoreStoreFetchRequest<NSManagedObjectID>()
+                                try from.applyToFetchRequest(fetchRequest, context: context)
+                                fetchRequest.predicate = NSPredicate(format: "%K < %@", keyPath, cutoffDate as NSDate)
+                                fetchRequest.resultType = .managedObjectIDResultType
+                                fetchRequest.fetchLimit = batchSize
+                                fetchRequest.includesPendingChanges = false
+                                return try context.fetchObjectIDs(fetchRequest)
+                            }
+                            guard !objectIDs.isEmpty else {
+
+                                break
+                            }
+                            let deletedObjectCount = try context.batchDeleteObjects(objectIDs)
+                            purgedObjectCount += deletedObjectCount
+                            batchCount += 1
+                            if deletedObjectCount == 0 || objectIDs.count < batchSize {
+
+                                break
+                            }
+                        }
+                        return (entityName, purgedObjectCount, batchCount)
+                    }
+                )
+            }
+
+
+            // MARK: Internal
+
+            internal let typeName: String
+            internal let purge: (_ context: NSManagedObjectContext, _ now: Date, _ batchSize: Int) throws -> (entityName: EntityName, purgedObjectCount: Int, batchCount: Int)
+        }
+
+
+        // MARK: - Report
+
+        /**
+         Describes the result of a purge. Passed to the `ExpiryPolicy`'s `reportHandler`.
+         */
+        public struct Report {
+
+            /**
+             The number of purged objects, keyed by entity name
+             */
+            public let purgedObjectCounts: [EntityName: Int]
+
+            /**
+             The total number of purged objects
+             */
+            public var purgedObjectCount: Int {
+
+                return self.purgedObjectCounts.values.reduce(0, +)
+            }
+
+            /**
+             The number of batch delete requests executed
+             */
+            public let batchCount: Int
+
+            /**
+             The number of seconds the purge took
+             */
+            public let duration: TimeInterval
+
+            /**
+             The errors encountered while purging. Rules that failed are skipped, and the rest are still purged.
+             */
+            public let errors: [CoreStoreError]
+        }
+    }
+}
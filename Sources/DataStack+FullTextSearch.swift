@@ -0,0 +1,122 @@
+//
+//  DataStack+FullTextSearch.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Searches an entity's full-text index and returns the `NSManagedObjectID`s of the matching objects, best matches first. The entity needs to be declared in the `fullTextIndexes` of the `SQLiteStore`s it is saved in.
+     ```
+     let noteIDs = try dataStack.fetchFullTextMatchIDs(From<Note>(), matching: "grocery list")
+     ```
+     Each whitespace-separated term in `searchText` is matched as a case- and diacritic-insensitive word prefix, and an object matches only if all terms appear in its indexed attributes. Matches are ranked with SQLite's BM25 function. While an index is being rebuilt, such as after its key paths change or after saves were missed, objects that were not indexed yet are not matched. This method can be called from any queue.
+     - parameter from: a `From` clause indicating the entity type
+     - parameter searchText: the terms to search for
+     - parameter limit: the maximum number of results. Defaults to `100`.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema, or a `CoreStoreError` value if the index could not be read.
+     - returns: the `NSManagedObjectID`s of the matching objects, ordered by relevance
+     */
+    public func fetchFullTextMatchIDs<O>(_ from: From<O>, matching searchText: String, limit: Int = 100) throws -> [NSManagedObjectID] {
+
+        let fetchRequest = Internals.CoreStoreFetchRequest<NSManagedObjectID>()
+        try from.applyToFetchRequest(fetchRequest, context: self.rootSavingContext)
+        do {
+
+            return try self.fullTextIndexer.search(
+                fetchRequest.entity!,
+                in: fetchRequest.affectedStores ?? self.coordinator.persistentStores,
+                matching: searchText,
+                limit: Swift.max(1, limit)
+            )
+        }
+        catch {
+
+            let coreStoreError = CoreStoreError(error)
+            Internals.log(
+                coreStoreError,
+                "Failed to search the full-text index of \(Internals.typeName(O.self))."
+            )
+            throw coreStoreError
+        }
+    }
+
+    /**
+     Searches an entity's full-text index and returns the matching objects from the `DataStack`'s main context, best matches first. The entity needs to be declared in the `fullTextIndexes` of the `SQLiteStore`s it is saved in.
+     ```
+     let notes = try dataStack.fetchFullTextMatches(From<Note>(), matching: "grocery list")
+     ```
+     Each whitespace-separated term in `searchText` is matched as a case- and diacritic-insensitive word prefix, and an object matches only if all terms appear in its indexed attributes.
+     - parameter from: a `From` clause indicating the entity type
+     - parameter searchText: the terms to search for
+     - parameter limit: the maximum number of results. Defaults to `100`.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema, or a `CoreStoreError` value if the index could not be read.
+     - returns: the matching objects, ordered by relevance
+     */
+    public func fetchFullTextMatches<O>(_ from: From<O>, matching searchText: String, limit: Int = 100) throws -> [O] {
+
+        Internals.assert(
+            Thread.isMainThread,
+            "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
+        )
+        return self.mainContext.fetchExisting(
+            try self.fetchFullTextMatchIDs(from, matching: searchText, limit: limit)
+        )
+    }
+}
+
+
+// MARK: - Where
+
+extension Where {
+
+    /**
+     Creates a `Where` clause that matches the results of a full-text search, so the search can be combined with other clauses or passed to `publishList(...)`:
+     ```
+     let listPublisher = dataStack.publishList(
+         From<Note>()
+             .where(try .matches(fullText: searchText, in: dataStack))
+             .orderBy(.descending(\.$updatedAt))
+     )
+     ```
+     The search runs once when the clause is created. Use `DataStack.fetchFullTextMatches(_:matching:limit:)` to get the results ordered by relevance instead.
+     - parameter searchText: the terms to search for
+     - parameter dataStack: the `DataStack` whose full-text index to search
+     - parameter limit: the maximum number of matches. Defaults to `1_000`.
+     - throws: `CoreStoreError.persistentStoreNotFound` if the specified entity could not be found in any store's schema, or a `CoreStoreError` value if the index could not be read.
+     - returns: a `Where` clause that matches the objects found by the search
+     */
+    public static func matches(fullText searchText: String, in dataStack: DataStack, limit: Int = 1_000) throws -> Where<O> {
+
+        return Where<O>(
+            "SELF IN %@",
+            try dataStack.fetchFullTextMatchIDs(From<O>(), matching: searchText, limit: limit)
+        )
+    }
+}
@@ -0,0 +1,146 @@
+//
+//  DataStack+MemoryPolicy.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Controls how the `DataStack` trims the objects that its contexts and `ObjectPublisher`s keep in memory. Defaults to `nil`, where nothing is trimmed automatically.
+     ```
+     dataStack.memoryPolicy = DataStack.MemoryPolicy(
+         maximumRegisteredObjects: 5_000
+     )
+     ```
+     Objects are only turned back into faults if they have no unsaved changes and are not observed through an `ObjectPublisher` of the main context, so any object that is accessed again is simply re-fetched from the store or the row cache. With a `recyclingInterval`, stale objects in the main context are also recycled periodically, and their counts are reported by `memoryStatistics()`.
+
+     For thread safety, this property needs to be set from the main thread.
+     */
+    public var memoryPolicy: MemoryPolicy? {
+
+        get {
+
+            return self.memoryPolicyMonitor.policy
+        }
+        set {
+
+            Internals.assert(
+                Thread.isMainThread,
+                "Attempted to set the \(Internals.typeName(self)).memoryPolicy outside the main thread."
+            )
+            self.memoryPolicyMonitor.policy = newValue
+            self.faultRecycler.policy = newValue
+        }
+    }
+
+    /**
+     Purges memory as if the system signaled memory pressure, regardless of whether `memoryPolicy` observes the system's signal. This can be used to forward other memory warnings (such as `UIApplication.didReceiveMemoryWarningNotification`), or to drive purges deterministically from tests.
+     ```
+     dataStack.handleMemoryPressure(.warning)
+     ```
+     For thread safety, this method needs to be called from the main thread.
+     - parameter pressure: the severity of the memory pressure. `.critical` purges everything that `.warning` does, and more.
+     */
+    public func handleMemoryPressure(_ pressure: MemoryPressure) {
+
+        Internals.assert(
+            Thread.isMainThread,
+            "Attempted to handle memory pressure outside the main thread."
+        )
+        self.memoryPolicyMonitor.purge(pressure)
+    }
+
+
+    // MARK: - MemoryPolicy
+
+    /**
+     The configuration for `DataStack.memoryPolicy`.
+     */
+    public struct MemoryPolicy: Hashable {
+
+        /**
+         The maximum number of objects registered in each of the `DataStack`'s main context and root saving context before their unobserved objects are turned back into faults. The count is checked after objects are fetched into or merged into a context. Faults that are no longer referenced are released by Core Data, so this mainly bounds the objects that are not held by the app. Set to `nil` to only purge on memory pressure.
+         */
+        public var maximumRegisteredObjects: Int?
+
+        /**
+         If `true`, the `DataStack` purges memory when the system signals memory pressure. Set to `false` to purge only when `DataStack.handleMemoryPressure(_:)` is called.
+         */
+        public var observesSystemMemoryPressure: Bool
+
+        /**
+         The number of seconds between passes that turn stale objects in the main context back into faults. An object is stale if it stayed materialized for a whole interval without unsaved changes, and without being referenced by an `ObjectPublisher` with observers or by a live `ListPublisher`, `ListMonitor`, or `ObjectMonitor`. Set to `nil` to disable recycling.
+         */
+        public var recyclingInterval: TimeInterval?
+
+        /**
+         The maximum number of objects refreshed in a single turn of the main queue during a recycling pass. Larger passes are split across multiple turns so they don't block the main queue.
+         */
+        public var recyclingBatchSize: Int
+
+        /**
+         Initializes a `MemoryPolicy`.
+         - parameter maximumRegisteredObjects: the maximum number of objects registered in each context before unobserved objects are turned back into faults. Defaults to `10_000`. Set to `nil` to only purge on memory pressure.
+         - parameter observesSystemMemoryPressure: if `true`, the `DataStack` purges memory when the system signals memory pressure. Defaults to `true`.
+         - parameter recyclingInterval: the number of seconds between passes that turn stale objects in the main context back into faults. Defaults to `nil`, which disables recycling.
+         - parameter recyclingBatchSize: the maximum number of objects refreshed in a single turn of the main queue during a recycling pass. Defaults to `500`.
+         */
+        public init(maximumRegisteredObjects: Int? = 10_000, observesSystemMemoryPressure: Bool = true, recyclingInterval: TimeInterval? = nil, recyclingBatchSize: Int = 500) {
+
+            self.maximumRegisteredObjects = maximumRegisteredObjects.map({ Swift.max(0, $0) })
+            self.observesSystemMemoryPressure = observesSystemMemoryPressure
+            self.recyclingInterval = recyclingInterval.map({ Swift.max(0.1, $0) })
+            self.recyclingBatchSize = Swift.max(1, recyclingBatchSize)
+        }
+
+
+        // MARK: Internal
+
+        internal static let defaultRecyclingBatchSize = 500
+    }
+
+
+    // MARK: - MemoryPressure
+
+    /**
+     The stages of memory purges performed by the `DataStack`.
+     */
+    public enum MemoryPressure: Hashable {
+
+        /**
+         Drops the cached `snapshot`s of `ObjectPublisher`s that have no observers, and turns unobserved objects in the main context back into faults.
+         */
+        case warning
+
+        /**
+         Purges everything that `.warning` does, then turns unchanged objects in the root saving context back into faults and closes idle reader connections.
+         */
+        case critical
+    }
+}
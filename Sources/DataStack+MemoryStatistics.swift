@@ -0,0 +1,122 @@
+//
+//  DataStack+MemoryStatistics.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Collects the number of objects registered in the `DataStack`'s contexts, along with the live publisher and snapshot counts from the debug registry.
+     ```
+     CoreStoreDefaults.tracksLiveObjects = true
+     // ...
+     let statistics = dataStack.memoryStatistics()
+     print(statistics.registeredObjectsInMainContext, statistics.liveObjectPublishers)
+     ```
+     This method blocks until both contexts' queues are available, so avoid calling it in performance-sensitive code.
+     - Important: The `live*` counts are process-wide and only include instances created while `CoreStoreDefaults.tracksLiveObjects` is `true`.
+     - returns: a `DataStack.MemoryStatistics` value describing the current memory footprint
+     */
+    public func memoryStatistics() -> MemoryStatistics {
+
+        let mainContext = self.mainContext
+        let rootSavingContext = self.rootSavingContext
+
+        var registeredObjectsInMainContext = 0
+        mainContext.performAndWait {
+
+            registeredObjectsInMainContext = mainContext.registeredObjects.count
+        }
+        var registeredObjectsInRootContext = 0
+        rootSavingContext.performAndWait {
+
+            registeredObjectsInRootContext = rootSavingContext.registeredObjects.count
+        }
+        let recyclingStatistics = self.faultRecycler.statistics
+        return MemoryStatistics(
+            registeredObjectsInMainContext: registeredObjectsInMainContext,
+            registeredObjectsInRootContext: registeredObjectsInRootContext,
+            liveObjectPublishers: Internals.LiveObjectRegistry.count(of: .objectPublisher),
+            liveObjectSnapshots: Internals.LiveObjectRegistry.count(of: .objectSnapshot),
+            liveListPublishers: Internals.LiveObjectRegistry.count(of: .listPublisher),
+            liveListSnapshots: Internals.LiveObjectRegistry.count(of: .listSnapshot),
+            recycledObjects: recyclingStatistics.recycledObjectCount,
+            recyclingPasses: recyclingStatistics.passCount
+        )
+    }
+
+
+    // MARK: - MemoryStatistics
+
+    /**
+     A point-in-time summary of the objects kept alive by a `DataStack`. Returned by `DataStack.memoryStatistics()`.
+     */
+    public struct MemoryStatistics: Hashable {
+
+        /**
+         The number of `NSManagedObject`s (including faults) currently registered in the `DataStack`'s main context.
+         */
+        public let registeredObjectsInMainContext: Int
+
+        /**
+         The number of `NSManagedObject`s (including faults) currently registered in the `DataStack`'s root saving context.
+         */
+        public let registeredObjectsInRootContext: Int
+
+        /**
+         The number of live `ObjectPublisher` instances. Always `0` unless `CoreStoreDefaults.tracksLiveObjects` is enabled.
+         */
+        public let liveObjectPublishers: Int
+
+        /**
+         The number of live `ObjectSnapshot` values. Copies of the same snapshot are counted once. Always `0` unless `CoreStoreDefaults.tracksLiveObjects` is enabled.
+         */
+        public let liveObjectSnapshots: Int
+
+        /**
+         The number of live `ListPublisher` instances. Always `0` unless `CoreStoreDefaults.tracksLiveObjects` is enabled.
+         */
+        public let liveListPublishers: Int
+
+        /**
+         The number of live `ListSnapshot` values. Copies of the same snapshot are counted once. Always `0` unless `CoreStoreDefaults.tracksLiveObjects` is enabled.
+         */
+        public let liveListSnapshots: Int
+
+        /**
+         The total number of stale objects that the `MemoryPolicy`'s recycling passes turned back into faults in the main context.
+         */
+        public let recycledObjects: Int
+
+        /**
+         The number of completed recycling passes. Always `0` unless the `MemoryPolicy` has a `recyclingInterval`.
+         */
+        public let recyclingPasses: Int
+    }
+}
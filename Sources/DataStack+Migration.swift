@@ -148,71 +148,10 @@ extension DataStack {
                 return nil
             }
             
+            let metadata: [String: Any]
             do {
                 
-                try FileManager.default.createDirectory(
-                    at: fileURL.deletingLastPathComponent(),
-                    withIntermediateDirectories: true,
-                    attributes: nil
-                )
-                
-                let metadata = try NSPersistentStoreCoordinator.metadataForPersistentStore(
-                    ofType: type(of: storage).storeType,
-                    at: fileURL as URL,
-                    options: storage.storeOptions
-                )
-                
-                return self.upgradeStorageIfNeeded(
-                    storage,
-                    metadata: metadata,
-                    completion: { (result) -> Void in
-                        
-                        if case .failure(.internalError(let error)) = result {
-                            
-                            if storage.localStorageOptions.contains(.recreateStoreOnModelMismatch) && error.isCoreDataMigrationError {
-                                
-                                do {
-                                    
-                                    try storage.cs_eraseStorageAndWait(
-                                        metadata: metadata,
-                                        soureModelHint: self.schemaHistory.schema(for: metadata)?.rawModel()
-                                    )
-                                    _ = try self.addStorageAndWait(storage)
-                                    
-                                    DispatchQueue.main.async {
-                                        
-                                        completion(.success(storage))
-                                    }
-                                }
-                                catch {
-                                    
-                                    completion(.failure(CoreStoreError(error)))
-                                }
-                                return
-                            }
-                            
-                            completion(.failure(CoreStoreError(error)))
-                            return
-                        }
-                        
-                        do {
-                            
-                            _ = try self.addStorageAndWait(storage)
-                            
-                            DispatchQueue.main.async {
-                                
-                                completion(.success(storage))
-                            }
-                        }
-                        catch {
-                            
-                            completion(.failure(CoreStoreError(error)))
-                        }
-                    }
-                )
-            }
-            catch let error as NSError
-                where error.code == NSFileReadNoSuchFileError && error.domain == NSCocoaErrorDomain {
+                guard let existingMetadata = try self.metadataForAddingStorage(storage) else {
                     
                     do {
                         
@@ -231,23 +170,144 @@ extension DataStack {
                         }
                     }
                     return nil
+                }
+                metadata = existingMetadata
             }
             catch {
                 
                 let storeError = CoreStoreError(error)
-                Internals.log(
-                    storeError,
-                    "Failed to load SQLite \(Internals.typeName(NSPersistentStore.self)) metadata."
-                )
                 DispatchQueue.main.async {
                     
                     completion(.failure(storeError))
                 }
                 return nil
             }
+            
+            return self.upgradeStorageIfNeeded(
+                storage,
+                metadata: metadata,
+                completion: { (result) -> Void in
+                    
+                    do {
+                        
+                        if case .failure(let error) = result {
+                            
+                            try self.recreateStorageOnModelMismatch(storage, metadata: metadata, error: error)
+                        }
+                        _ = try self.addStorageAndWait(storage)
+                        
+                        DispatchQueue.main.async {
+                            
+                            completion(.success(storage))
+                        }
+                    }
+                    catch {
+                        
+                        completion(.failure(CoreStoreError(error)))
+                    }
+                }
+            )
         }
     }
     
+    /**
+     Asynchronously adds multiple `LocalStorage`s to the stack. Prefer this over calling `addStorage(_:completion:)` for each storage when setting up several stores at once, such as one `SQLiteStore` per account:
+     ```
+     dataStack.addStorages(
+         accountIDs.map({ SQLiteStore(fileName: "\($0).sqlite", configuration: "Account") }),
+         completion: { (results) in
+             
+             // results[i] is the SetupResult for the i-th storage
+         }
+     )
+     ```
+     The storages' metadata are read and checked against the stack's model in parallel, and storages that need migration are migrated concurrently, each on its own `NSPersistentStoreCoordinator`. The `DataStack`'s coordinator is only locked once all storages are ready, to add them in one pass, so fetches from the stack are not blocked while metadata are read or while storages are migrated.
+     
+     - parameter storages: the local storages
+     - parameter completion: the closure to be executed on the main queue when all storages were either added or failed. The closure's `SetupResult`s are in the same order as `storages`. Note that the `LocalStorage` associated to a `SetupResult.success` may not always be the same instance as the parameter argument if a previous `LocalStorage` was already added at the same URL and with the same configuration.
+     - returns: a `Progress` instance that tracks the setup of all storages, including their migrations
+     */
+    @discardableResult
+    public func addStorages<T: LocalStorage>(_ storages: [T], completion: @escaping ([SetupResult<T>]) -> Void) -> Progress {
+        
+        for storage in storages {
+            
+            Internals.assert(
+                storage.fileURL.isFileURL,
+                "The specified URL for the \(Internals.typeName(storage)) is invalid: \"\(storage.fileURL)\""
+            )
+        }
+        let progress = Progress(parent: nil, userInfo: nil)
+        progress.totalUnitCount = Int64(storages.count)
+        
+        let storageProgresses: [Progress] = storages.map { _ in
+            
+            let storageProgress = Progress(totalUnitCount: 1)
+            progress.addChild(storageProgress, withPendingUnitCount: 1)
+            return storageProgress
+        }
+        
+        // Storages that share a URL are resolved when added to the coordinator, so only the first one is prepared
+        var preparedURLs: Set<URL> = []
+        let preparedIndices = storages.indices.filter({ preparedURLs.insert(storages[$0].fileURL).inserted })
+        
+        DispatchQueue.global(qos: .userInitiated).async {
+            
+            // Schemas create their models lazily, so load them all before reading from multiple threads
+            self.schemaHistory.schemaByVersion.values.forEach({ _ = $0.rawModel() })
+            
+            var errors: [Int: CoreStoreError] = [:]
+            let errorsLock = NSLock()
+            DispatchQueue.concurrentPerform(iterations: preparedIndices.count) { (iteration) in
+                
+                let index = preparedIndices[iteration]
+                autoreleasepool {
+                    
+                    do {
+                        
+                        try self.prepareStorageForAdding(
+                            storages[index],
+                            progress: storageProgresses[index]
+                        )
+                    }
+                    catch {
+                        
+                        errorsLock.lock()
+                        errors[index] = CoreStoreError(error)
+                        errorsLock.unlock()
+                    }
+                }
+            }
+            let results: [SetupResult<T>] = self.coordinator.performSynchronously {
+                
+                return storages.indices.map { (index) in
+                    
+                    defer {
+                        
+                        storageProgresses[index].completedUnitCount = storageProgresses[index].totalUnitCount
+                    }
+                    if let error = errors[index] {
+                        
+                        return .failure(error)
+                    }
+                    do {
+                        
+                        return .success(try self.addStorageAndWait(storages[index]))
+                    }
+                    catch {
+                        
+                        return .failure(CoreStoreError(error))
+                    }
+                }
+            }
+            DispatchQueue.main.async {
+                
+                completion(results)
+            }
+        }
+        return progress
+    }
+    
     /**
      Migrates a local storage to match the `DataStack`'s managed object model version. This method does NOT add the migrated store to the data stack.
      
@@ -315,32 +375,12 @@ extension DataStack {
                     at: fileURL as URL,
                     options: storage.storeOptions
                 )
+                return try self.migrationStepsForStorage(storage, metadata: metadata)
+                    .map { $0.migrationType }
+            }
+            catch let error as CoreStoreError {
                 
-                guard let migrationSteps = self.computeMigrationFromStorage(storage, metadata: metadata) else {
-                    
-                    let error = CoreStoreError.mappingModelNotFound(
-                        localStoreURL: fileURL,
-                        targetModel: self.schemaHistory.rawModel,
-                        targetModelVersion: self.modelVersion
-                    )
-                    Internals.log(
-                        error,
-                        "Failed to find migration steps from the \(Internals.typeName(storage)) at URL \"\(fileURL)\" to version model \"\(self.modelVersion)\"."
-                    )
-                    throw error
-                }
-                
-                if migrationSteps.count > 1 && storage.localStorageOptions.contains(.preventProgressiveMigration) {
-                    
-                    let error = CoreStoreError.progressiveMigrationRequired(localStoreURL: fileURL)
-                    Internals.log(
-                        error,
-                        "Failed to find migration mapping from the \(Internals.typeName(storage)) at URL \"\(fileURL)\" to version model \"\(self.modelVersion)\" without requiring progessive migrations."
-                    )
-                    throw error
-                }
-                
-                return migrationSteps.map { $0.migrationType }
+                throw error
             }
             catch let error as NSError
                 where error.code == NSFileReadNoSuchFileError && error.domain == NSCocoaErrorDomain {
@@ -362,23 +402,21 @@ extension DataStack {
     
     // MARK: Private
     
+    private typealias MigrationStep = (sourceModel: NSManagedObjectModel, destinationModel: NSManagedObjectModel, mappingModel: NSMappingModel, migrationType: MigrationType)
+    
     private func upgradeStorageIfNeeded<T: LocalStorage>(_ storage: T, metadata: [String: Any], completion: @escaping (MigrationResult) -> Void) -> Progress? {
         
-        guard let migrationSteps = self.computeMigrationFromStorage(storage, metadata: metadata) else {
+        let migrationSteps: [MigrationStep]
+        do {
             
-            let error = CoreStoreError.mappingModelNotFound(
-                localStoreURL: storage.fileURL,
-                targetModel: self.schemaHistory.rawModel,
-                targetModelVersion: self.modelVersion
-            )
-            Internals.log(
-                error,
-                "Failed to find migration steps from \(Internals.typeName(storage)) at URL \"\(storage.fileURL)\" to version model \"\(self.schemaHistory.rawModel)\"."
-            )
+            migrationSteps = try self.migrationStepsForStorage(storage, metadata: metadata)
+        }
+        catch {
             
+            let migrationError = CoreStoreError(error)
             DispatchQueue.main.async {
                 
-                completion(.failure(error))
+                completion(.failure(migrationError))
             }
             return nil
         }
@@ -393,19 +431,6 @@ extension DataStack {
             }
             return nil
         }
-        else if numberOfMigrations > 1 && storage.localStorageOptions.contains(.preventProgressiveMigration) {
-            
-            let error = CoreStoreError.progressiveMigrationRequired(localStoreURL: storage.fileURL)
-            Internals.log(
-                error,
-                "Failed to find migration mapping from the \(Internals.typeName(storage)) at URL \"\(storage.fileURL)\" to version model \"\(self.modelVersion)\" without requiring progessive migrations."
-            )
-            DispatchQueue.main.async {
-                
-                completion(.failure(error))
-            }
-            return nil
-        }
         
         let migrationTypes = migrationSteps.map { $0.migrationType }
         var migrationResult: MigrationResult?
@@ -485,7 +510,92 @@ extension DataStack {
         return progress
     }
     
-    private func computeMigrationFromStorage<T: LocalStorage>(_ storage: T, metadata: [String: Any]) -> [(sourceModel: NSManagedObjectModel, destinationModel: NSManagedObjectModel, mappingModel: NSMappingModel, migrationType: MigrationType)]? {
+    private func metadataForAddingStorage<T: LocalStorage>(_ storage: T) throws -> [String: Any]? {
+        
+        let fileURL = storage.fileURL
+        do {
+            
+            try FileManager.default.createDirectory(
+                at: fileURL.deletingLastPathComponent(),
+                withIntermediateDirectories: true,
+                attributes: nil
+            )
+            return try NSPersistentStoreCoordinator.metadataForPersistentStore(
+                ofType: type(of: storage).storeType,
+                at: fileURL,
+                options: storage.storeOptions
+            )
+        }
+        catch let error as NSError
+            where error.code == NSFileReadNoSuchFileError && error.domain == NSCocoaErrorDomain {
+                
+                return nil
+        }
+        catch {
+            
+            let storeError = CoreStoreError(error)
+            Internals.log(
+                storeError,
+                "Failed to load SQLite \(Internals.typeName(NSPersistentStore.self)) metadata."
+            )
+            throw storeError
+        }
+    }
+    
+    private func migrationStepsForStorage<T: LocalStorage>(_ storage: T, metadata: [String: Any]) throws -> [MigrationStep] {
+        
+        guard let migrationSteps = self.computeMigrationFromStorage(storage, metadata: metadata) else {
+            
+            let error = CoreStoreError.mappingModelNotFound(
+                localStoreURL: storage.fileURL,
+                targetModel: self.schemaHistory.rawModel,
+                targetModelVersion: self.modelVersion
+            )
+            Internals.log(
+                error,
+                "Failed to find migration steps from \(Internals.typeName(storage)) at URL \"\(storage.fileURL)\" to version model \"\(self.modelVersion)\"."
+            )
+            throw error
+        }
+        if migrationSteps.count > 1 && storage.localStorageOptions.contains(.preventProgressiveMigration) {
+            
+            let error = CoreStoreError.progressiveMigrationRequired(localStoreURL: storage.fileURL)
+            Internals.log(
+                error,
+                "Failed to find migration mapping from the \(Internals.typeName(storage)) at URL \"\(storage.fileURL)\" to version model \"\(self.modelVersion)\" without requiring progessive migrations."
+            )
+            throw error
+        }
+        return migrationSteps
+    }
+    
+    /**
+     Erases a storage that failed to migrate if it has the `.recreateStoreOnModelMismatch` option and the failure was a model mismatch, either because no migration path to the current model exists or because Core Data could not migrate the store. Otherwise, the `error` is rethrown.
+     */
+    private func recreateStorageOnModelMismatch<T: LocalStorage>(_ storage: T, metadata: [String: Any], error: CoreStoreError) throws {
+        
+        guard storage.localStorageOptions.contains(.recreateStoreOnModelMismatch) else {
+            
+            throw error
+        }
+        switch error {
+            
+        case .mappingModelNotFound:
+            break
+            
+        case .internalError(let internalError) where internalError.isCoreDataMigrationError:
+            break
+            
+        default:
+            throw error
+        }
+        try storage.cs_eraseStorageAndWait(
+            metadata: metadata,
+            soureModelHint: self.schemaHistory.schema(for: metadata)?.rawModel()
+        )
+    }
+    
+    private func computeMigrationFromStorage<T: LocalStorage>(_ storage: T, metadata: [String: Any]) -> [MigrationStep]? {
         
         let schemaHistory = self.schemaHistory
         if schemaHistory.rawModel.isConfiguration(withName: storage.configuration, compatibleWithStoreMetadata: metadata) {
@@ -696,6 +806,54 @@ extension DataStack {
             throw CoreStoreError(error)
         }
     }
+    
+    private func prepareStorageForAdding<T: LocalStorage>(_ storage: T, progress: Progress) throws {
+        
+        let fileURL = storage.fileURL
+        if let _ = self.coordinator.persistentStore(for: fileURL) {
+            
+            return
+        }
+        
+        guard let metadata = try self.metadataForAddingStorage(storage) else {
+            
+            return
+        }
+        do {
+            
+            let migrationSteps = try self.migrationStepsForStorage(storage, metadata: metadata)
+            progress.totalUnitCount = Int64(Swift.max(1, migrationSteps.count))
+            for (sourceModel, destinationModel, mappingModel, migrationType) in migrationSteps {
+                
+                let childProgress = Progress(totalUnitCount: 100)
+                progress.addChild(childProgress, withPendingUnitCount: 1)
+                do {
+                    
+                    try self.startMigrationForStorage(
+                        storage,
+                        sourceModel: sourceModel,
+                        destinationModel: destinationModel,
+                        mappingModel: mappingModel,
+                        migrationType: migrationType,
+                        progress: childProgress
+                    )
+                }
+                catch {
+                    
+                    let migrationError = CoreStoreError(error)
+                    Internals.log(
+                        migrationError,
+                        "Failed to migrate version model \"\(migrationType.sourceVersion)\" to version \"\(migrationType.destinationVersion)\"."
+                    )
+                    throw migrationError
+                }
+            }
+        }
+        catch {
+            
+            try self.recreateStorageOnModelMismatch(storage, metadata: metadata, error: CoreStoreError(error))
+        }
+    }
 }
 
 
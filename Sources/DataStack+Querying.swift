@@ -199,6 +199,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchCount<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> Int {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchCount(from, fetchClauses) })
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -216,6 +220,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchCount<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> Int {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchCount(from, fetchClauses) })
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -238,6 +246,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchCount<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> Int {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchCount(clauseChain) })
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -255,6 +267,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectID<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> NSManagedObjectID? {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchObjectID(from, fetchClauses) }).flatMap(readerPool.importedObjectID(_:))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -272,6 +288,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectID<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> NSManagedObjectID? {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchObjectID(from, fetchClauses) }).flatMap(readerPool.importedObjectID(_:))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -294,6 +314,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectID<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> NSManagedObjectID? {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.read({ try $0.fetchObjectID(clauseChain) }).flatMap(readerPool.importedObjectID(_:))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -311,6 +335,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectIDs<O>(_ from: From<O>, _ fetchClauses: FetchClause...) throws -> [NSManagedObjectID] {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedObjectIDs(readerPool.read({ try $0.fetchObjectIDs(from, fetchClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -328,6 +356,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectIDs<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) throws -> [NSManagedObjectID] {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedObjectIDs(readerPool.read({ try $0.fetchObjectIDs(from, fetchClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -350,6 +382,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func fetchObjectIDs<B: FetchChainableBuilderType>(_ clauseChain: B) throws -> [NSManagedObjectID] {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedObjectIDs(readerPool.read({ try $0.fetchObjectIDs(clauseChain) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to fetch from a \(Internals.typeName(self)) outside the main thread."
@@ -373,6 +409,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryValue<O, U: QueryableAttributeType>(_ from: From<O>, _ selectClause: Select<O, U>, _ queryClauses: QueryClause...) throws -> U? {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedValue(readerPool.read({ try $0.queryValue(from, selectClause, queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -393,6 +433,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryValue<O, U: QueryableAttributeType>(_ from: From<O>, _ selectClause: Select<O, U>, _ queryClauses: [QueryClause]) throws -> U? {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedValue(readerPool.read({ try $0.queryValue(from, selectClause, queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -417,6 +461,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryValue<B: QueryChainableBuilderType>(_ clauseChain: B) throws -> B.ResultType? where B.ResultType: QueryableAttributeType {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedValue(readerPool.read({ try $0.queryValue(clauseChain.from, clauseChain.select, clauseChain.queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -437,6 +485,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryAttributes<O>(_ from: From<O>, _ selectClause: Select<O, NSDictionary>, _ queryClauses: QueryClause...) throws -> [[String: Any]] {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedAttributes(readerPool.read({ try $0.queryAttributes(from, selectClause, queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -457,6 +509,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryAttributes<O>(_ from: From<O>, _ selectClause: Select<O, NSDictionary>, _ queryClauses: [QueryClause]) throws -> [[String: Any]] {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedAttributes(readerPool.read({ try $0.queryAttributes(from, selectClause, queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -490,6 +546,10 @@ extension DataStack: FetchableSource, QueryableSource {
      */
     public func queryAttributes<B: QueryChainableBuilderType>(_ clauseChain: B) throws -> [[String: Any]] where B.ResultType == NSDictionary {
         
+        if let readerPool = self.readerPoolForBackgroundReads() {
+            
+            return try readerPool.importedAttributes(readerPool.read({ try $0.queryAttributes(clauseChain.from, clauseChain.select, clauseChain.queryClauses) }))
+        }
         Internals.assert(
             Thread.isMainThread,
             "Attempted to query from a \(Internals.typeName(self)) outside the main thread."
@@ -507,4 +567,16 @@ extension DataStack: FetchableSource, QueryableSource {
         
         return self.mainContext
     }
+    
+    
+    // MARK: Private
+    
+    private func readerPoolForBackgroundReads() -> Internals.ReaderPool? {
+        
+        guard !Thread.isMainThread, self.readerPool.canRead else {
+            
+            return nil
+        }
+        return self.readerPool
+    }
 }
@@ -0,0 +1,112 @@
+//
+//  DataStack+Reading.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Performs fetches and queries synchronously on a background `DataReader`, without going through the main context. The `DataReader` is only valid within `task`, so return `NSManagedObjectID`s, queried values, or `ObjectSnapshot`s created with `DataReader.snapshot(of:)` instead of the fetched objects themselves.
+     ```
+     let adultIDs = try dataStack.read { (reader) in
+
+         return try reader.fetchObjectIDs(From<Person>().where(\.age >= 18))
+     }
+     ```
+     Readers use the connections configured with `maximumConcurrentReaders`, and wait for one to become available if all of them are in use. If reader connections are disabled (the default) or the stack has non-SQLite storages, `task` runs on a temporary context on the stack's own coordinator instead.
+     - Important: Readers only see changes that were already saved to the persistent store.
+     - parameter task: the synchronous non-escaping closure where fetches and queries can be made
+     - throws: a `CoreStoreError` value indicating the failure. Custom errors thrown by the user will be wrapped in `CoreStoreError.userError(error: Error)`.
+     - returns: the value returned from `task`
+     */
+    public func read<T>(_ task: (_ reader: DataReader) throws -> T) throws -> T {
+
+        let readerPool = self.readerPool
+        if readerPool.canRead {
+
+            return try readerPool.read { (context) in
+
+                return try DataReader(context: context, dataStack: self).run(task)
+            }
+        }
+        let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+        context.persistentStoreCoordinator = self.coordinator
+        context.undoManager = nil
+        context.name = "com.coreStore.readerContext"
+        context.parentStack = self
+
+        var result: Result<T, Error>!
+        context.performAndWait {
+
+            result = Result(catching: { try DataReader(context: context, dataStack: self).run(task) })
+            context.reset()
+        }
+        return try result.get()
+    }
+
+    /**
+     Performs fetches and queries asynchronously on a background `DataReader`, without going through the main context. The `DataReader` is only valid within `task`, so return `NSManagedObjectID`s, queried values, or `ObjectSnapshot`s created with `DataReader.snapshot(of:)` instead of the fetched objects themselves.
+     ```
+     dataStack.read(
+         { (reader) in
+
+             let people = try reader.fetchAll(From<Person>().where(\.age >= 18))
+             return reader.snapshots(of: people)
+         },
+         completion: { (result) in
+
+             // ...
+         }
+     )
+     ```
+     - Important: Readers only see changes that were already saved to the persistent store.
+     - parameter task: the asynchronous closure where fetches and queries can be made
+     - parameter queue: the queue where `completion` is executed. Defaults to the main queue. Pass a background queue to keep the read entirely off the main thread.
+     - parameter completion: the closure executed after `task` completes. The `Result` argument of the closure will either wrap the return value of `task`, or any uncaught errors thrown from within `task`. Custom errors thrown by the user will be wrapped in `CoreStoreError.userError(error: Error)`.
+     */
+    public func read<T>(_ task: @escaping (_ reader: DataReader) throws -> T, queue: DispatchQueue = .main, completion: @escaping (Result<T, CoreStoreError>) -> Void) {
+
+        self.readerQueue.async {
+
+            let result: Result<T, CoreStoreError>
+            do {
+
+                result = .success(try self.read(task))
+            }
+            catch {
+
+                result = .failure(CoreStoreError(error))
+            }
+            queue.async {
+
+                completion(result)
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//
+//  DataStack+Sharding.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - DataStack
+
+extension DataStack {
+
+    /**
+     Adds all shards of a `ShardedSQLiteStore` to the stack and blocks until completion. Once added, objects of the sharded entity are routed to their shards when saved, and fetches with a `Where` clause that pins the shard key only read the matching shards.
+     ```
+     try dataStack.addStorageAndWait(
+         ShardedSQLiteStore<Message>(
+             shardKey: #keyPath(Message.conversationID),
+             configuration: "Messages",
+             shardCount: 8,
+             fileURL: { SQLiteStore.defaultRootDirectory.appendingPathComponent("Messages-\($0).sqlite") }
+         )
+     )
+     ```
+     - parameter shardedStore: the `ShardedSQLiteStore`
+     - throws: a `CoreStoreError` value indicating the failure. Shards that were added before the failure remain in the stack.
+     - returns: the `ShardedSQLiteStore` added to the stack
+     */
+    @discardableResult
+    public func addStorageAndWait<O>(_ shardedStore: ShardedSQLiteStore<O>) throws -> ShardedSQLiteStore<O> {
+
+        self.validateShardedStore(shardedStore)
+        for storage in shardedStore.storages {
+
+            try self.addStorageAndWait(storage)
+        }
+        self.registerShardRouter(Internals.ShardRouter(shardedStore))
+        return shardedStore
+    }
+
+    /**
+     Asynchronously adds all shards of a `ShardedSQLiteStore` to the stack. Shards are set up in parallel with `addStorages(_:completion:)`, including any migrations. Once added, objects of the sharded entity are routed to their shards when saved, and fetches with a `Where` clause that pins the shard key only read the matching shards.
+
+     - parameter shardedStore: the `ShardedSQLiteStore`
+     - parameter completion: the closure to be executed on the main queue when all shards were either added or failed. The closure's `Result` argument either wraps the `ShardedSQLiteStore`, or the error of the first shard that failed. Shards that were added successfully remain in the stack even if other shards failed.
+     - returns: a `Progress` instance that tracks the setup of all shards, including their migrations
+     */
+    @discardableResult
+    public func addStorage<O>(_ shardedStore: ShardedSQLiteStore<O>, completion: @escaping (Result<ShardedSQLiteStore<O>, CoreStoreError>) -> Void) -> Progress {
+
+        self.validateShardedStore(shardedStore)
+        return self.addStorages(shardedStore.storages) { (results) in
+
+            for result in results {
+
+                if case .failure(let error) = result {
+
+                    completion(.failure(error))
+                    return
+                }
+            }
+            self.registerShardRouter(Internals.ShardRouter(shardedStore))
+            completion(.success(shardedStore))
+        }
+    }
+
+
+    // MARK: Private
+
+    private func validateShardedStore<O>(_ shardedStore: ShardedSQLiteStore<O>) {
+
+        let configurationName = shardedStore.configuration ?? DataStack.defaultConfigurationName
+        let entityDescription = self.entityDescription(for: Internals.EntityIdentifier(O.self))
+        Internals.assert(
+            entityDescription.map({ self.schemaHistory.rawModel.entities(forConfigurationName: configurationName)?.contains($0) == true }) == true,
+            "The entity \(Internals.typeName(O.self)) does not belong to the configuration \"\(configurationName)\" of the \(Internals.typeName(shardedStore))."
+        )
+        Internals.assert(
+            entityDescription?.attributesByName[shardedStore.shardKey] != nil,
+            "The shard key \"\(shardedStore.shardKey)\" is not an attribute of the entity \(Internals.typeName(O.self))."
+        )
+    }
+}
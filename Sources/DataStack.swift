@@ -114,8 +114,17 @@ public final class DataStack: Equatable {
         self.rootSavingContext = NSManagedObjectContext.rootSavingContextForCoordinator(self.coordinator)
         self.mainContext = NSManagedObjectContext.mainContextForRootContext(self.rootSavingContext)
         self.schemaHistory = schemaHistory
+        self.readerPool = Internals.ReaderPool(
+            coordinator: self.coordinator,
+            maximumReaderCount: 0
+        )
         
         self.rootSavingContext.parentStack = self
+        self.readerPool.parentStack = self
+        self.memoryPolicyMonitor.parentStack = self
+        self.faultRecycler.parentStack = self
+        self.expiryScheduler.parentStack = self
+        self.fullTextIndexer.parentStack = self
         
         self.mainContext.isDataStackContext = true
     }
@@ -212,6 +221,28 @@ public final class DataStack: Equatable {
         return self.coordinator.managedObjectID(forURIRepresentation: url)
     }
     
+    /**
+     The maximum number of read-only connections used to serve `fetchCount(...)`, `fetchObjectID(...)`, `fetchObjectIDs(...)`, `queryValue(...)`, and `queryAttributes(...)` calls made outside the main thread. Each connection opens the stack's `SQLiteStore` files with its own `NSPersistentStoreCoordinator`, so background reads run in parallel with each other and with transactions instead of queueing behind the stack's single coordinator. Connections are opened lazily, and are closed whenever storages are added or removed.
+     
+     Defaults to `0`, which disables the reader connections so that background reads go through the main context. To opt in, set a positive value after creating the stack, typically the number of threads expected to read at the same time:
+     ```
+     dataStack.maximumConcurrentReaders = min(4, ProcessInfo.processInfo.activeProcessorCount)
+     ```
+     Stacks with non-SQLite storages (such as `InMemoryStore`) always read through the main context.
+     - Important: Reader connections have their own row caches and only see changes that were already saved to the persistent store, so only opt in if background reads don't need to see unsaved changes of the main context.
+     */
+    public var maximumConcurrentReaders: Int {
+        
+        get {
+            
+            return self.readerPool.maximumReaderCount
+        }
+        set {
+            
+            self.readerPool.maximumReaderCount = newValue
+        }
+    }
+    
     /**
      Creates an `SQLiteStore` with default parameters and adds it to the stack. This method blocks until completion.
      ```
@@ -377,6 +408,7 @@ public final class DataStack: Equatable {
     public func unsafeRemoveAllPersistentStores(completion: @escaping () -> Void = {}) {
         
         let coordinator = self.coordinator
+        let readerPool = self.readerPool
         coordinator.performAsynchronously {
             
             withExtendedLifetime(coordinator) { coordinator in
@@ -386,6 +418,7 @@ public final class DataStack: Equatable {
                     _ = try? coordinator.remove($0)
                 }
             }
+            readerPool.invalidate()
             DispatchQueue.main.async(execute: completion)
         }
     }
@@ -396,6 +429,7 @@ public final class DataStack: Equatable {
     public func unsafeRemoveAllPersistentStoresAndWait() {
         
         let coordinator = self.coordinator
+        let readerPool = self.readerPool
         coordinator.performSynchronously {
             
             withExtendedLifetime(coordinator) { coordinator in
@@ -405,6 +439,7 @@ public final class DataStack: Equatable {
                     _ = try? coordinator.remove($0)
                 }
             }
+            readerPool.invalidate()
         }
     }
     
@@ -440,7 +475,13 @@ public final class DataStack: Equatable {
     internal let rootSavingContext: NSManagedObjectContext
     internal let mainContext: NSManagedObjectContext
     internal let schemaHistory: SchemaHistory
+    internal let readerPool: Internals.ReaderPool
+    internal let memoryPolicyMonitor = Internals.MemoryPolicyMonitor()
+    internal let faultRecycler = Internals.FaultRecycler()
+    internal let expiryScheduler = Internals.ExpiryScheduler()
+    internal let fullTextIndexer = Internals.FullTextIndexer()
     internal let childTransactionQueue = DispatchQueue.serial("com.coreStore.dataStack.childTransactionQueue", qos: .utility)
+    internal let readerQueue = DispatchQueue.concurrent("com.coreStore.dataStack.readerQueue", qos: .userInitiated)
     internal let storeMetadataUpdateQueue = DispatchQueue.concurrent("com.coreStore.persistentStoreBarrierQueue", qos: .userInteractive)
     internal let migrationQueue: OperationQueue = Internals.with {
         
@@ -465,7 +506,7 @@ public final class DataStack: Equatable {
         self.storeMetadataUpdateQueue.sync(flags: .barrier) {
             
             returnValue = self.finalConfigurationsByEntityIdentifier[entityIdentifier]?
-                .map({ self.persistentStoresByFinalConfiguration[$0]! }) ?? []
+                .flatMap({ self.persistentStoresByFinalConfiguration[$0]! }) ?? []
         }
         return returnValue
     }
@@ -479,7 +520,7 @@ public final class DataStack: Equatable {
                 
                 if configurationsForEntity.contains(configuration) {
                     
-                    return (store: self.persistentStoresByFinalConfiguration[configuration], isAmbiguous: false)
+                    return (store: self.persistentStoresByFinalConfiguration[configuration]?.first, isAmbiguous: false)
                 }
                 else if !inferStoreIfPossible {
                     
@@ -493,7 +534,7 @@ public final class DataStack: Equatable {
                 return (store: nil, isAmbiguous: false)
                 
             case 1 where inferStoreIfPossible:
-                return (store: self.persistentStoresByFinalConfiguration[configurationsForEntity.first!], isAmbiguous: false)
+                return (store: self.persistentStoresByFinalConfiguration[configurationsForEntity.first!]?.first, isAmbiguous: false)
                 
             default:
                 return (store: nil, isAmbiguous: true)
@@ -503,18 +544,30 @@ public final class DataStack: Equatable {
     
     internal func createPersistentStoreFromStorage(_ storage: StorageInterface, finalURL: URL?, finalStoreOptions: [AnyHashable: Any]?) throws -> NSPersistentStore {
         
-        let persistentStore = try self.coordinator.addPersistentStore(
-            ofType: type(of: storage).storeType,
-            configurationName: storage.configuration,
-            at: finalURL,
-            options: finalStoreOptions
-        )
+        let persistentStore: NSPersistentStore
+        if let storage = storage as? InMemoryStore {
+            
+            persistentStore = try storage.restorePersistentStore(in: self.coordinator)
+        }
+        else {
+            
+            persistentStore = try self.coordinator.addPersistentStore(
+                ofType: type(of: storage).storeType,
+                configurationName: storage.configuration,
+                at: finalURL,
+                options: finalStoreOptions
+            )
+        }
         persistentStore.storageInterface = storage
+        self.readerPool.invalidate()
         
         self.storeMetadataUpdateQueue.async(flags: .barrier) {
             
             let configurationName = persistentStore.configurationName
-            self.persistentStoresByFinalConfiguration[configurationName] = persistentStore
+            let attachedStores = self.coordinator.persistentStores
+            self.persistentStoresByFinalConfiguration[configurationName] = (self.persistentStoresByFinalConfiguration[configurationName] ?? [])
+                .filter({ (store) in attachedStores.contains(where: { $0 === store }) && store !== persistentStore })
+                + [persistentStore]
             for entityDescription in (self.coordinator.managedObjectModel.entities(forConfigurationName: configurationName) ?? []) {
                 
                 let managedObjectClassName = entityDescription.managedObjectClassName!
@@ -534,6 +587,29 @@ public final class DataStack: Equatable {
         return persistentStore
     }
     
+    internal func shardRouters() -> [Internals.EntityIdentifier: Internals.ShardRouter] {
+        
+        // Called on every fetch and save, so this only copies out the current immutable snapshot
+        self.shardRoutersLock.lock()
+        defer {
+            
+            self.shardRoutersLock.unlock()
+        }
+        return self.shardRoutersByEntityIdentifier
+    }
+    
+    internal func registerShardRouter(_ shardRouter: Internals.ShardRouter) {
+        
+        self.shardRoutersLock.lock()
+        defer {
+            
+            self.shardRoutersLock.unlock()
+        }
+        var shardRoutersByEntityIdentifier = self.shardRoutersByEntityIdentifier
+        shardRoutersByEntityIdentifier[shardRouter.entityIdentifier] = shardRouter
+        self.shardRoutersByEntityIdentifier = shardRoutersByEntityIdentifier
+    }
+    
     internal func entityDescription(for entityIdentifier: Internals.EntityIdentifier) -> NSEntityDescription? {
         
         return self.schemaHistory.entityDescriptionsByEntityIdentifier[entityIdentifier]
@@ -542,8 +618,10 @@ public final class DataStack: Equatable {
     
     // MARK: Private
     
-    private var persistentStoresByFinalConfiguration = [String: NSPersistentStore]()
+    private var persistentStoresByFinalConfiguration = [String: [NSPersistentStore]]()
     private var finalConfigurationsByEntityIdentifier = [Internals.EntityIdentifier: Set<String>]()
+    private let shardRoutersLock = NSLock()
+    private var shardRoutersByEntityIdentifier = [Internals.EntityIdentifier: Internals.ShardRouter]()
     
     deinit {
         
@@ -102,6 +102,21 @@ extension DiffableDataSource {
             self.dispatcher = Internals.DiffableDataUIDispatcher<O>(dataStack: dataStack)
         }
 
+        /**
+         Decides when `apply(_:animatingDifferences:completion:)` and `purge(animatingDifferences:completion:)` should reload the target instead of animating a large changeset. Defaults to `DiffableDataSource.LargeChangesetPolicy.disabled`, which always animates; set it to `.default` or a custom policy to opt in.
+         */
+        public var largeChangesetPolicy: DiffableDataSource.LargeChangesetPolicy = .disabled
+
+        /**
+         The changeset estimate from the most recent update, including whether the target was reloaded instead of animated. This is `nil` before the first update and while `largeChangesetPolicy` is `.disabled`.
+         */
+        public private(set) var lastChangesetEstimate: DiffableDataSource.LargeChangesetPolicy.Estimate?
+
+        /**
+         The maximum number of objects kept warm by `prefetchItems(at:)`. Objects beyond this count are released in the order they were prefetched. Set to `0` to disable prefetching. Defaults to `100`.
+         */
+        public var prefetchCapacity: Int = 100
+
         /**
          Clears the target.
          - parameter animatingDifferences: if `true`, animations may be applied accordingly. Defaults to `true`.
@@ -111,6 +126,8 @@ extension DiffableDataSource {
             self.dispatcher.purge(
                 target: self.target,
                 animatingDifferences: animatingDifferences,
+                largeChangesetPolicy: self.largeChangesetPolicy,
+                didEstimateChangeset: { [weak self] in self?.lastChangesetEstimate = $0 },
                 performUpdates: { target, changeset, setSections in
 
                     target.reload(
@@ -143,6 +160,8 @@ extension DiffableDataSource {
                 diffableSnapshot,
                 target: self.target,
                 animatingDifferences: animatingDifferences,
+                largeChangesetPolicy: self.largeChangesetPolicy,
+                didEstimateChangeset: { [weak self] in self?.lastChangesetEstimate = $0 },
                 performUpdates: { target, changeset, setSections in
 
                     target.reload(
@@ -241,9 +260,35 @@ extension DiffableDataSource {
         }
 
 
+        /**
+         Loads the objects for the items at the specified `IndexPath`s ahead of their cells being requested. The objects are fetched in batches on a background context, and their `ObjectPublisher`s from the `dataStack` are pre-loaded with `ObjectSnapshot`s so their first access doesn't fire faults on the main queue. This is typically called from the target's prefetching data source.
+         - parameter indexPaths: the `IndexPath`s of the items about to be displayed
+         */
+        open func prefetchItems(at indexPaths: [IndexPath]) {
+
+            self.prefetcher.prefetch(
+                indexPaths.compactMap(self.itemID(for:)),
+                capacity: self.prefetchCapacity
+            )
+        }
+
+        /**
+         Releases objects previously loaded by `prefetchItems(at:)` that are no longer expected to be displayed.
+         - parameter indexPaths: the `IndexPath`s of the items no longer expected to be displayed
+         */
+        open func cancelPrefetchingItems(at indexPaths: [IndexPath]) {
+
+            self.prefetcher.cancelPrefetching(
+                indexPaths.compactMap(self.itemID(for:))
+            )
+        }
+
+
         // MARK: Internal
 
         internal let dispatcher: Internals.DiffableDataUIDispatcher<O>
+
+        internal private(set) lazy var prefetcher: Internals.ObjectPrefetcher<O> = .init(dataStack: self.dataStack)
     }
 }
 
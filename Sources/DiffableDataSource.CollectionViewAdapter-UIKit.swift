@@ -61,7 +61,7 @@ extension DiffableDataSource {
      `DiffableDataSource.CollectionViewAdapter` fully handles the reload animations.
      - SeeAlso: CoreStore's DiffableDataSource implementation is based on https://github.com/ra1028/DiffableDataSources     
      */
-    open class CollectionViewAdapter<O: DynamicObject>: BaseAdapter<O, DefaultCollectionViewTarget<UICollectionView>>, UICollectionViewDataSource {
+    open class CollectionViewAdapter<O: DynamicObject>: BaseAdapter<O, DefaultCollectionViewTarget<UICollectionView>>, UICollectionViewDataSource, UICollectionViewDataSourcePrefetching {
 
         // MARK: Public
         
@@ -91,6 +91,7 @@ extension DiffableDataSource {
             super.init(target: .init(collectionView), dataStack: dataStack)
 
             collectionView.dataSource = self
+            collectionView.prefetchDataSource = self
         }
 
 
@@ -137,6 +138,21 @@ extension DiffableDataSource {
         }
 
 
+
+        // MARK: - UICollectionViewDataSourcePrefetching
+
+        @objc
+        open dynamic func collectionView(_ collectionView: UICollectionView, prefetchItemsAt indexPaths: [IndexPath]) {
+
+            self.prefetchItems(at: indexPaths)
+        }
+
+        @objc
+        open dynamic func collectionView(_ collectionView: UICollectionView, cancelPrefetchingForItemsAt indexPaths: [IndexPath]) {
+
+            self.cancelPrefetchingItems(at: indexPaths)
+        }
+
         // MARK: Private
 
         private let cellProvider: (UICollectionView, IndexPath, O) -> UICollectionViewCell?
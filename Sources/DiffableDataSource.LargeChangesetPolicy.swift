@@ -0,0 +1,230 @@
+//
+//  DiffableDataSource.LargeChangesetPolicy.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+#if canImport(UIKit) || canImport(AppKit)
+
+import Foundation
+import CoreData
+
+
+// MARK: - DiffableDataSource
+
+extension DiffableDataSource {
+
+    // MARK: - LargeChangesetPolicy
+
+    /**
+     Decides when a `DiffableDataSource.BaseAdapter` should skip computing animated batch updates and reload its target instead. Changesets that replace most of a list take longer to stage and animate than a plain `reloadData()`.
+     Before diffing, the adapter estimates the number of inserted and deleted items and sections from the difference between the old and new identifiers. The target is reloaded if either:
+     - the estimated change count exceeds `maximumChangeCount`, or
+     - the estimated change count is at least `minimumChangeCount` and the `changeRatio` exceeds `maximumChangeRatio`
+     ```
+     adapter.largeChangesetPolicy = .init(
+         maximumChangeCount: 500,
+         maximumChangeRatio: 0.3
+     )
+     ```
+     */
+    public struct LargeChangesetPolicy: Hashable {
+
+        // MARK: Public
+
+        /**
+         The recommended policy for adapters that opt in. Reloads when more than 2,000 items and sections were inserted or deleted, or when more than half of the list changed with at least 100 insertions and deletions.
+         */
+        public static let `default`: LargeChangesetPolicy = .init(
+            maximumChangeCount: 2_000,
+            maximumChangeRatio: 0.5,
+            minimumChangeCount: 100
+        )
+
+        /**
+         A policy that always computes the animated batch updates. This is the initial `DiffableDataSource.BaseAdapter.largeChangesetPolicy`. Changes are not estimated at all under this policy, so `DiffableDataSource.BaseAdapter.lastChangesetEstimate` stays `nil`.
+         */
+        public static let disabled: LargeChangesetPolicy = .init(
+            maximumChangeCount: nil,
+            maximumChangeRatio: nil
+        )
+
+        /**
+         The maximum number of inserted and deleted items and sections before the target is reloaded, or `nil` for no limit.
+         */
+        public var maximumChangeCount: Int?
+
+        /**
+         The maximum `changeRatio`, between `0` and `1`, before the target is reloaded, or `nil` for no limit.
+         */
+        public var maximumChangeRatio: Double?
+
+        /**
+         The minimum number of inserted and deleted items and sections before `maximumChangeRatio` applies. This keeps small lists animating even when most of their items change.
+         */
+        public var minimumChangeCount: Int
+
+        /**
+         Initializes a `LargeChangesetPolicy`.
+         - parameter maximumChangeCount: the maximum number of inserted and deleted items and sections before the target is reloaded, or `nil` for no limit
+         - parameter maximumChangeRatio: the maximum `changeRatio`, between `0` and `1`, before the target is reloaded, or `nil` for no limit
+         - parameter minimumChangeCount: the minimum number of inserted and deleted items and sections before `maximumChangeRatio` applies. Defaults to `100`.
+         */
+        public init(maximumChangeCount: Int?, maximumChangeRatio: Double?, minimumChangeCount: Int = 100) {
+
+            self.maximumChangeCount = maximumChangeCount
+            self.maximumChangeRatio = maximumChangeRatio
+            self.minimumChangeCount = minimumChangeCount
+        }
+
+
+        // MARK: Internal
+
+        internal var isDisabled: Bool {
+
+            return self.maximumChangeCount == nil && self.maximumChangeRatio == nil
+        }
+
+        internal func estimate(
+            source: [Internals.DiffableDataSourceSnapshot.Section],
+            target: [Internals.DiffableDataSourceSnapshot.Section]
+        ) -> Estimate {
+
+            let sourceSectionIDs = Set(source.lazy.map({ $0.differenceIdentifier }))
+            let targetSectionIDs = Set(target.lazy.map({ $0.differenceIdentifier }))
+
+            var sourceItemIDs: Set<NSManagedObjectID> = []
+            sourceItemIDs.reserveCapacity(source.reduce(0, { $0 + $1.elements.count }))
+            for section in source {
+
+                sourceItemIDs.formUnion(section.elements.lazy.map({ $0.differenceIdentifier }))
+            }
+            var targetItemCount = 0
+            var insertedItemCount = 0
+            for section in target {
+
+                targetItemCount += section.elements.count
+                for item in section.elements where !sourceItemIDs.contains(item.differenceIdentifier) {
+
+                    insertedItemCount += 1
+                }
+            }
+            // Items are unique across sections, so whatever wasn't carried over was deleted
+            let deletedItemCount = sourceItemIDs.count - (targetItemCount - insertedItemCount)
+            let insertedSectionCount = targetSectionIDs.subtracting(sourceSectionIDs).count
+            let deletedSectionCount = sourceSectionIDs.subtracting(targetSectionIDs).count
+
+            let changeCount = insertedItemCount + deletedItemCount + insertedSectionCount + deletedSectionCount
+            let totalCount = sourceItemIDs.count + targetItemCount + sourceSectionIDs.count + targetSectionIDs.count
+            let changeRatio = totalCount > 0 ? Double(changeCount) / Double(totalCount) : 0
+
+            let reloadsData: Bool
+            if let maximumChangeCount = self.maximumChangeCount,
+                changeCount > maximumChangeCount {
+
+                reloadsData = true
+            }
+            else if let maximumChangeRatio = self.maximumChangeRatio,
+                changeCount >= self.minimumChangeCount,
+                changeRatio > maximumChangeRatio {
+
+                reloadsData = true
+            }
+            else {
+
+                reloadsData = false
+            }
+            return Estimate(
+                sourceItemCount: sourceItemIDs.count,
+                targetItemCount: targetItemCount,
+                insertedItemCount: insertedItemCount,
+                deletedItemCount: deletedItemCount,
+                insertedSectionCount: insertedSectionCount,
+                deletedSectionCount: deletedSectionCount,
+                changeRatio: changeRatio,
+                reloadsData: reloadsData
+            )
+        }
+
+
+        // MARK: - Estimate
+
+        /**
+         The estimated size of a changeset, along with the `LargeChangesetPolicy`'s decision for it. Moves and item reloads are not included in the estimate.
+         */
+        public struct Estimate: Hashable {
+
+            /**
+             The number of items before the update
+             */
+            public let sourceItemCount: Int
+
+            /**
+             The number of items after the update
+             */
+            public let targetItemCount: Int
+
+            /**
+             The number of items that were not in the list before the update
+             */
+            public let insertedItemCount: Int
+
+            /**
+             The number of items that are no longer in the list after the update
+             */
+            public let deletedItemCount: Int
+
+            /**
+             The number of sections that were not in the list before the update
+             */
+            public let insertedSectionCount: Int
+
+            /**
+             The number of sections that are no longer in the list after the update
+             */
+            public let deletedSectionCount: Int
+
+            /**
+             The number of inserted and deleted items and sections, relative to the total number of items and sections before and after the update. A ratio of `1` means the list was entirely replaced.
+             */
+            public let changeRatio: Double
+
+            /**
+             `true` if the target was reloaded instead of animating the changeset
+             */
+            public let reloadsData: Bool
+
+            /**
+             The total number of inserted and deleted items and sections
+             */
+            public var changeCount: Int {
+
+                return self.insertedItemCount
+                    + self.deletedItemCount
+                    + self.insertedSectionCount
+                    + self.deletedSectionCount
+            }
+        }
+    }
+}
+
+#endif
@@ -61,7 +61,7 @@ extension DiffableDataSource {
      `DiffableDataSource.TableViewAdapter` fully handles the reload animations.
      - SeeAlso: CoreStore's DiffableDataSource implementation is based on https://github.com/ra1028/DiffableDataSources
      */
-    open class TableViewAdapter<O: DynamicObject>: BaseAdapter<O, DefaultTableViewTarget<UITableView>>, UITableViewDataSource {
+    open class TableViewAdapter<O: DynamicObject>: BaseAdapter<O, DefaultTableViewTarget<UITableView>>, UITableViewDataSource, UITableViewDataSourcePrefetching {
 
         // MARK: Public
 
@@ -88,6 +88,7 @@ extension DiffableDataSource {
             super.init(target: .init(tableView), dataStack: dataStack)
 
             tableView.dataSource = self
+            tableView.prefetchDataSource = self
         }
 
         /**
@@ -170,6 +171,21 @@ extension DiffableDataSource {
             return index
         }
 
+        
+        
+        // MARK: - UITableViewDataSourcePrefetching
+
+        @objc
+        open dynamic func tableView(_ tableView: UITableView, prefetchRowsAt indexPaths: [IndexPath]) {
+
+            self.prefetchItems(at: indexPaths)
+        }
+
+        @objc
+        open dynamic func tableView(_ tableView: UITableView, cancelPrefetchingForRowsAt indexPaths: [IndexPath]) {
+
+            self.cancelPrefetchingItems(at: indexPaths)
+        }
 
         // MARK: Private
         
@@ -318,7 +318,7 @@ extension From where O: NSManagedObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, T>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            sectionKeyPath._kvcKeyPathString!,
+            Internals.kvcKeyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -337,7 +337,7 @@ extension From where O: NSManagedObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            sectionKeyPath._kvcKeyPathString!,
+            Internals.kvcKeyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -352,7 +352,7 @@ extension From where O: NSManagedObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            sectionKeyPath._kvcKeyPathString!,
+            Internals.kvcKeyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -427,7 +427,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, FieldContainer<O>.Stored<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -441,7 +441,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, FieldContainer<O>.Virtual<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -455,7 +455,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, FieldContainer<O>.Coded<T>>) -> SectionMonitorChainBuilder<O> {
 
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -469,7 +469,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, ValueContainer<O>.Required<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -483,7 +483,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, ValueContainer<O>.Optional<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -497,7 +497,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, TransformableContainer<O>.Required<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -511,7 +511,7 @@ extension From where O: CoreStoreObject {
     public func sectionBy<T>(_ sectionKeyPath: KeyPath<O, TransformableContainer<O>.Optional<T>>) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: { _ in nil }
         )
     }
@@ -530,7 +530,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
 
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -549,7 +549,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
 
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -568,7 +568,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
 
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -587,7 +587,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -606,7 +606,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -625,7 +625,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -644,7 +644,7 @@ extension From where O: CoreStoreObject {
     ) -> SectionMonitorChainBuilder<O> {
         
         return self.sectionBy(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -174,7 +174,7 @@ public struct From<O: DynamicObject> {
     
     internal func applyAffectedStoresForFetchedRequest<U>(_ fetchRequest: Internals.CoreStoreFetchRequest<U>, context: NSManagedObjectContext) throws {
         
-        let stores = self.findPersistentStores(context)
+        let stores = self.findPersistentStores(context).map(context.persistentStoresInCoordinator(_:))
         fetchRequest.affectedStores = stores
         if stores?.isEmpty == false {
 
@@ -118,7 +118,7 @@ extension GroupBy where O: NSManagedObject {
      */
     public init<T>(_ keyPath: KeyPath<O, T>) {
         
-        self.init([keyPath._kvcKeyPathString!])
+        self.init([Internals.kvcKeyPathString(keyPath)])
     }
 }
 
@@ -131,7 +131,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -141,7 +141,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, FieldContainer<O>.Virtual<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -151,7 +151,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, FieldContainer<O>.Coded<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -161,7 +161,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -171,7 +171,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -181,7 +181,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, TransformableContainer<O>.Required<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
     
     /**
@@ -191,7 +191,7 @@ extension GroupBy where O: CoreStoreObject {
      */
     public init<T>(_ keyPath: KeyPath<O, TransformableContainer<O>.Optional<T>>) {
         
-        self.init([O.meta[keyPath: keyPath].keyPath])
+        self.init([Internals.keyPathString(keyPath)])
     }
 }
 
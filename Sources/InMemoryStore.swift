@@ -40,6 +40,7 @@ public final class InMemoryStore: StorageInterface {
     public init(configuration: ModelConfiguration) {
     
         self.configuration = configuration
+        self.snapshotFileURL = nil
     }
     
     /**
@@ -48,6 +49,56 @@ public final class InMemoryStore: StorageInterface {
     public init() {
         
         self.configuration = nil
+        self.snapshotFileURL = nil
+    }
+    
+    /**
+     Initializes an `InMemoryStore` that starts with the contents of a snapshot file. When added to a `DataStack`, the snapshot is opened as read-only and migrated into memory by the `NSPersistentStoreCoordinator`, without importing or inserting objects through any context. Changes saved to the store are kept only in memory, and the snapshot file is never modified.
+     ```
+     if !FileManager.default.fileExists(atPath: fixtureURL.path) {
+     
+         try InMemoryStore.generateSnapshot(
+             fileURL: fixtureURL,
+             schema: schema,
+             importSource: { (transaction) in
+     
+                 // import fixtures
+             }
+         )
+     }
+     try dataStack.addStorageAndWait(InMemoryStore(snapshotFileURL: fixtureURL))
+     ```
+     - parameter configuration: an optional configuration name from the model file. If not specified, defaults to `nil`, the "Default" configuration. This should be the same configuration used to generate the snapshot.
+     - parameter snapshotFileURL: the local file URL of a snapshot created with `InMemoryStore.generateSnapshot(...)`
+     */
+    public init(configuration: ModelConfiguration = nil, snapshotFileURL: URL) {
+        
+        self.configuration = configuration
+        self.snapshotFileURL = snapshotFileURL
+    }
+    
+    /**
+     The local file URL of the snapshot that the store starts with, or `nil` if the store starts empty
+     */
+    public let snapshotFileURL: URL?
+    
+    /**
+     Generates a snapshot file for use with `InMemoryStore.init(configuration:snapshotFileURL:)`. The snapshot is a compacted SQLite file, so it can be generated once and reused by every test or launch that needs the same initial data.
+     
+     - parameter fileURL: the local file URL where the snapshot will be written. Any existing file at this URL is replaced.
+     - parameter schema: the schema to generate the snapshot with. This should be the same as the current schema of the `DataStack` that will add the `InMemoryStore`.
+     - parameter configuration: an optional configuration name from the schema. If not specified, defaults to `nil`, the "Default" configuration.
+     - parameter importSource: the closure where objects are created or imported into the snapshot. The transaction is committed after the closure returns.
+     - throws: a `CoreStoreError` value indicating the failure. Custom errors thrown by the user will be wrapped in `CoreStoreError.userError(error: Error)`.
+     */
+    public static func generateSnapshot(fileURL: URL, schema: DynamicSchema, configuration: ModelConfiguration = nil, importSource: (_ transaction: SynchronousDataTransaction) throws -> Void) throws {
+        
+        try ReadOnlySQLiteStore.generate(
+            fileURL: fileURL,
+            schema: schema,
+            configuration: configuration,
+            importSource: importSource
+        )
     }
     
     
@@ -85,6 +136,44 @@ public final class InMemoryStore: StorageInterface {
     }
     
     
+    // MARK: Internal
+    
+    internal func restorePersistentStore(in coordinator: NSPersistentStoreCoordinator) throws -> NSPersistentStore {
+        
+        guard let snapshotFileURL = self.snapshotFileURL else {
+            
+            return try coordinator.addPersistentStore(
+                ofType: InMemoryStore.storeType,
+                configurationName: self.configuration,
+                at: nil,
+                options: self.storeOptions
+            )
+        }
+        let snapshotStore = try coordinator.addPersistentStore(
+            ofType: ReadOnlySQLiteStore.storeType,
+            configurationName: self.configuration,
+            at: snapshotFileURL,
+            options: ReadOnlySQLiteStore(fileURL: snapshotFileURL, configuration: self.configuration).storeOptions
+        )
+        do {
+            
+            // The in-memory store never reads or writes its URL, but migration requires one
+            return try coordinator.migratePersistentStore(
+                snapshotStore,
+                to: FileManager.default.temporaryDirectory
+                    .appendingPathComponent(ProcessInfo().globallyUniqueString, isDirectory: false),
+                options: self.storeOptions,
+                withType: InMemoryStore.storeType
+            )
+        }
+        catch {
+            
+            _ = try? coordinator.remove(snapshotStore)
+            throw error
+        }
+    }
+    
+    
     // MARK: Private
     
     private weak var dataStack: DataStack?
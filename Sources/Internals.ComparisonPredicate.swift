@@ -0,0 +1,201 @@
+//
+//  Internals.ComparisonPredicate.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: Internal
+
+    /**
+     Creates the predicate `keyPath <operatorType> value` directly as an `NSComparisonPredicate`, without formatting and parsing a predicate string. The key path's expression is shared between predicates, and an `ANY`, `ALL`, `SOME`, or `NONE` prefix (such as the ones added by `Where.Expression.any()`) is applied as the predicate's modifier.
+
+     Key paths that are not plain dot-separated key names are still parsed with `NSPredicate(format:)`, so the resulting predicate is always the same as the format string `"\(keyPath) <operatorType> %@"`. `operatorType` cannot be `.customSelector`, which has no format string symbol.
+     */
+    internal static func comparisonPredicate(_ keyPath: KeyPathString, _ operatorType: NSComparisonPredicate.Operator, _ value: Any?) -> NSPredicate {
+
+        guard let leftExpression = ComparisonExpressionCache.shared.leftExpression(for: keyPath) else {
+
+            let symbol = Self.formatSymbol(for: operatorType)
+            switch value {
+
+            case nil:
+                return NSPredicate(format: "\(keyPath) \(symbol) nil")
+
+            case let value?:
+                return NSPredicate(format: "\(keyPath) \(symbol) %@", argumentArray: [value])
+            }
+        }
+        let predicate = NSComparisonPredicate(
+            leftExpression: leftExpression.expression,
+            rightExpression: value.map({ NSExpression(forConstantValue: $0) }) ?? Self.nilExpression,
+            modifier: leftExpression.modifier,
+            type: operatorType,
+            options: []
+        )
+        guard leftExpression.isNegated else {
+
+            return predicate
+        }
+        return NSCompoundPredicate(type: .not, subpredicates: [predicate])
+    }
+
+
+    // MARK: - ComparisonExpressionCache
+
+    /**
+     A thread-safe, process-wide cache of the left-hand `NSExpression`s parsed from `KeyPathString`s. `NSExpression`s are immutable, so the same instance can be shared by every predicate for a key path.
+     */
+    internal final class ComparisonExpressionCache {
+
+        // MARK: Internal
+
+        internal static let shared = ComparisonExpressionCache()
+
+        internal func leftExpression(for keyPath: KeyPathString) -> LeftExpression? {
+
+            self.lock.lock()
+            let cachedLeftExpression = self.leftExpressions[keyPath]
+            self.lock.unlock()
+            if let cachedLeftExpression = cachedLeftExpression {
+
+                return cachedLeftExpression
+            }
+            let leftExpression = LeftExpression(keyPath)
+            self.lock.lock()
+            self.leftExpressions[keyPath] = .some(leftExpression)
+            self.lock.unlock()
+            return leftExpression
+        }
+
+
+        // MARK: - LeftExpression
+
+        internal struct LeftExpression {
+
+            // MARK: Internal
+
+            internal let expression: NSExpression
+            internal let modifier: NSComparisonPredicate.Modifier
+            internal let isNegated: Bool
+
+            internal init?(_ keyPath: KeyPathString) {
+
+                var components = keyPath.split(separator: " ", omittingEmptySubsequences: false)
+                switch (components.count, components.first?.uppercased()) {
+
+                case (1, _):
+                    self.modifier = .direct
+                    self.isNegated = false
+
+                case (2, "ANY"?),
+                     (2, "SOME"?):
+                    self.modifier = .any
+                    self.isNegated = false
+
+                case (2, "ALL"?):
+                    self.modifier = .all
+                    self.isNegated = false
+
+                case (2, "NONE"?):
+                    self.modifier = .any
+                    self.isNegated = true
+
+                default:
+                    return nil
+                }
+                let path = components.removeLast()
+                if path.uppercased() == "SELF" {
+
+                    self.expression = .expressionForEvaluatedObject()
+                    return
+                }
+                let keyNames = path.split(separator: ".", omittingEmptySubsequences: false)
+                guard keyNames.allSatisfy(Self.isPlainKeyName) else {
+
+                    return nil
+                }
+                self.expression = NSExpression(forKeyPath: String(path))
+            }
+
+
+            // MARK: Private
+
+            private static let keyNameCharacters = CharacterSet.alphanumerics.union(CharacterSet(charactersIn: "_@"))
+
+            private static func isPlainKeyName(_ keyName: Substring) -> Bool {
+
+                guard let first = keyName.unicodeScalars.first,
+                    !CharacterSet.decimalDigits.contains(first),
+                    keyName.uppercased() != "SELF" else {
+
+                    return false
+                }
+                return keyName.unicodeScalars.allSatisfy(Self.keyNameCharacters.contains)
+            }
+        }
+
+
+        // MARK: Private
+
+        private let lock = NSLock()
+        private var leftExpressions: [KeyPathString: LeftExpression?] = [:]
+    }
+
+
+    // MARK: Private
+
+    private static let nilExpression = NSExpression(forConstantValue: nil)
+
+    private static func formatSymbol(for operatorType: NSComparisonPredicate.Operator) -> String {
+
+        switch operatorType {
+
+        case .lessThan:             return "<"
+        case .lessThanOrEqualTo:    return "<="
+        case .greaterThan:          return ">"
+        case .greaterThanOrEqualTo: return ">="
+        case .equalTo:              return "=="
+        case .notEqualTo:           return "!="
+        case .matches:              return "MATCHES"
+        case .like:                 return "LIKE"
+        case .beginsWith:           return "BEGINSWITH"
+        case .endsWith:             return "ENDSWITH"
+        case .in:                   return "IN"
+        case .contains:             return "CONTAINS"
+        case .between:              return "BETWEEN"
+
+        case .customSelector:
+            Internals.abort("Custom selector comparisons cannot be created from a key path and a value.")
+
+        @unknown default:
+            Internals.abort("Unsupported \(Internals.typeName(NSComparisonPredicate.Operator.self)) raw value \(operatorType.rawValue).")
+        }
+    }
+}
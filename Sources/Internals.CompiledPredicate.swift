@@ -0,0 +1,325 @@
+//
+//  Internals.CompiledPredicate.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - CompiledPredicate
+
+    /**
+     An `NSPredicate` lowered into a tree of closures. Comparisons between a key path and constant values (`==`, `!=`, `<`, `<=`, `>`, `>=`, `IN`) and `AND`/`OR`/`NOT` compounds are evaluated natively, reading each key path component with a single `value(forKey:)` call. Any other subpredicate, and any key path that passes through a to-many relationship, is evaluated by its own `NSPredicate` so results always match `NSPredicate.evaluate(with:)`.
+     */
+    internal struct CompiledPredicate {
+
+        // MARK: Internal
+
+        /**
+         `true` if no part of the predicate falls back to `NSPredicate.evaluate(with:)`, other than key paths that turn out to pass through a to-many relationship.
+         */
+        internal let isNative: Bool
+
+        internal init(_ predicate: NSPredicate) {
+
+            (self.evaluateNode, self.isNative) = CompiledPredicate.compile(predicate)
+        }
+
+        /**
+         Evaluates the predicate against an `NSManagedObject`, or an `NSDictionary` of attribute values.
+         */
+        internal func evaluate(with object: NSObject) -> Bool {
+
+            return self.evaluateNode(object)
+        }
+
+
+        // MARK: Private
+
+        private let evaluateNode: (NSObject) -> Bool
+
+        private static func compile(_ predicate: NSPredicate) -> (evaluate: (NSObject) -> Bool, isNative: Bool) {
+
+            let fallback: (evaluate: (NSObject) -> Bool, isNative: Bool) = (
+                { predicate.evaluate(with: $0) },
+                false
+            )
+            switch predicate {
+
+            case let predicate as NSCompoundPredicate:
+                guard let subpredicates = predicate.subpredicates as? [NSPredicate] else {
+
+                    return fallback
+                }
+                let compiled = subpredicates.map(self.compile(_:))
+                let evaluators = compiled.map({ $0.evaluate })
+                let isNative = compiled.allSatisfy({ $0.isNative })
+                switch predicate.compoundPredicateType {
+
+                case .and:
+                    return ({ (object) in evaluators.allSatisfy({ $0(object) }) }, isNative)
+
+                case .or:
+                    return ({ (object) in evaluators.contains(where: { $0(object) }) }, isNative)
+
+                case .not where evaluators.count == 1:
+                    let evaluator = evaluators[0]
+                    return ({ (object) in !evaluator(object) }, isNative)
+
+                case .not:
+                    return fallback
+
+                @unknown default:
+                    return fallback
+                }
+
+            case let predicate as NSComparisonPredicate:
+                return self.compile(predicate) ?? fallback
+
+            default:
+                switch predicate.predicateFormat {
+
+                case "TRUEPREDICATE":
+                    return ({ _ in true }, true)
+
+                case "FALSEPREDICATE":
+                    return ({ _ in false }, true)
+
+                default:
+                    return fallback
+                }
+            }
+        }
+
+        private static func compile(_ predicate: NSComparisonPredicate) -> (evaluate: (NSObject) -> Bool, isNative: Bool)? {
+
+            guard predicate.comparisonPredicateModifier == .direct,
+                predicate.options.isEmpty else {
+
+                return nil
+            }
+            let operatorType = predicate.predicateOperatorType
+            var keyPathExpression = predicate.leftExpression
+            var constantExpression = predicate.rightExpression
+            if keyPathExpression.expressionType == .constantValue,
+                [.equalTo, .notEqualTo].contains(operatorType) {
+
+                swap(&keyPathExpression, &constantExpression)
+            }
+            guard keyPathExpression.expressionType == .keyPath,
+                constantExpression.expressionType == .constantValue,
+                !keyPathExpression.keyPath.contains("@") else {
+
+                return nil
+            }
+            let keyPath = KeyPathAccessor(keyPathExpression.keyPath)
+            let constant = constantExpression.constantValue.flatMap({ $0 is NSNull ? nil : $0 as AnyObject })
+            let evaluate: (_ object: NSObject, _ compare: (AnyObject?) -> Bool) -> Bool = { (object, compare) in
+
+                guard case .value(let value) = keyPath.value(in: object) else {
+
+                    return predicate.evaluate(with: object)
+                }
+                return compare(value)
+            }
+            switch operatorType {
+
+            case .equalTo,
+                 .notEqualTo:
+                guard constant.map(CompiledPredicate.isSupportedConstant(_:)) ?? true else {
+
+                    return nil
+                }
+                let isEqualTo = operatorType == .equalTo
+                return ({ (object) in
+
+                    evaluate(object) { (value) in
+
+                        switch (value, constant) {
+
+                        case (nil, nil):
+                            return isEqualTo
+
+                        case (let value?, let constant?):
+                            return value.isEqual(constant) == isEqualTo
+
+                        default:
+                            return !isEqualTo
+                        }
+                    }
+                }, true)
+
+            case .lessThan,
+                 .lessThanOrEqualTo,
+                 .greaterThan,
+                 .greaterThanOrEqualTo:
+                guard let constant = constant,
+                    constant is NSNumber || constant is NSString || constant is NSDate else {
+
+                    return nil
+                }
+                let isIncluded: (ComparisonResult) -> Bool
+                switch operatorType {
+
+                case .lessThan:
+                    isIncluded = { $0 == .orderedAscending }
+
+                case .lessThanOrEqualTo:
+                    isIncluded = { $0 != .orderedDescending }
+
+                case .greaterThan:
+                    isIncluded = { $0 == .orderedDescending }
+
+                default:
+                    isIncluded = { $0 != .orderedAscending }
+                }
+                return ({ (object) in
+
+                    evaluate(object) { (value) in
+
+                        guard let result = CompiledPredicate.compare(value, constant) else {
+
+                            return predicate.evaluate(with: object)
+                        }
+                        return isIncluded(result)
+                    }
+                }, true)
+
+            case .in:
+                let elements: [Any]
+                switch constant {
+
+                case let array as NSArray:
+                    elements = Array(array)
+
+                case let set as NSSet:
+                    elements = set.allObjects
+
+                case let orderedSet as NSOrderedSet:
+                    elements = orderedSet.array
+
+                default:
+                    return nil
+                }
+                guard elements.allSatisfy({ CompiledPredicate.isSupportedConstant($0 as AnyObject) }) else {
+
+                    return nil
+                }
+                let members = NSSet(array: elements)
+                return ({ (object) in
+
+                    evaluate(object) { (value) in
+
+                        value.map(members.contains(_:)) ?? false
+                    }
+                }, true)
+
+            default:
+                return nil
+            }
+        }
+
+        private static func isSupportedConstant(_ constant: AnyObject) -> Bool {
+
+            switch constant {
+
+            case is NSNumber, is NSString, is NSDate, is NSData, is NSUUID, is NSURL:
+                return true
+
+            default:
+                return false
+            }
+        }
+
+        private static func compare(_ value: AnyObject?, _ constant: AnyObject) -> ComparisonResult? {
+
+            switch (value, constant) {
+
+            case (let value as NSNumber, let constant as NSNumber):
+                return value.compare(constant)
+
+            case (let value as NSString, let constant as NSString):
+                return value.compare(constant as String)
+
+            case (let value as NSDate, let constant as NSDate):
+                return value.compare(constant as Date)
+
+            default:
+                return nil
+            }
+        }
+
+
+        // MARK: - KeyPathAccessor
+
+        private struct KeyPathAccessor {
+
+            // MARK: Internal
+
+            enum Result {
+
+                case value(AnyObject?)
+                case unsupported
+            }
+
+            init(_ keyPath: String) {
+
+                self.components = keyPath.components(separatedBy: ".")
+            }
+
+            func value(in object: NSObject) -> Result {
+
+                var current: AnyObject? = object
+                for (index, component) in self.components.enumerated() {
+
+                    switch current {
+
+                    case nil:
+                        return .value(nil)
+
+                    case let managedObject as NSManagedObject:
+                        current = managedObject.value(forKey: component) as AnyObject?
+
+                    case let dictionary as NSDictionary where index == 0:
+                        current = dictionary.object(forKey: component) as AnyObject?
+
+                    default:
+                        // To-many relationships are aggregated by NSPredicate
+                        return .unsupported
+                    }
+                }
+                return .value(current is NSNull ? nil : current)
+            }
+
+
+            // MARK: Private
+
+            private let components: [String]
+        }
+    }
+}
@@ -74,6 +74,10 @@ extension Internals {
                 sectionNameKeyPath: sectionBy?.sectionKeyPath,
                 cacheName: nil
             )
+            if let parentStack = context.parentStack, context === parentStack.mainContext {
+                
+                context.registerObservingFetchedResultsController(self)
+            }
         }
         
         @nonobjc
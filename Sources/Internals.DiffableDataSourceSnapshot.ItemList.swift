@@ -0,0 +1,737 @@
+//
+//  Internals.DiffableDataSourceSnapshot.ItemList.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+#if canImport(UIKit) || canImport(AppKit)
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals.DiffableDataSourceSnapshot
+
+extension Internals.DiffableDataSourceSnapshot {
+
+    // MARK: - ItemList
+
+    /**
+     The storage for a `Section`'s items: a persistent B-tree whose nodes keep the item counts of their subtrees.
+     Copies share all nodes, so copying a snapshot is O(1). Mutations copy only the nodes along the path to the edited position, so single-item edits, index lookups, and insertions/removals by index are O(log n) regardless of whether the storage is shared with other snapshots. Replacing a range of k items splits the tree around the range and joins the remaining halves with a tree built from the new items, which is O(k + log n).
+     */
+    internal struct ItemList: RandomAccessCollection, MutableCollection, RangeReplaceableCollection, Equatable {
+
+        // MARK: Internal
+
+        init<S: Sequence>(_ items: S) where S.Element == Item {
+
+            self.root = Node.build(ContiguousArray(items))
+        }
+
+
+        // MARK: Equatable
+
+        static func == (_ lhs: ItemList, _ rhs: ItemList) -> Bool {
+
+            return lhs.root === rhs.root
+                || (lhs.count == rhs.count && lhs.elementsEqual(rhs))
+        }
+
+
+        // MARK: Sequence
+
+        func makeIterator() -> Iterator {
+
+            var leaves: [ContiguousArray<Item>] = []
+            self.root.collectLeaves(into: &leaves)
+            return Iterator(leaves: leaves)
+        }
+
+
+        // MARK: Collection
+
+        typealias Index = Int
+        typealias Indices = Range<Int>
+        typealias SubSequence = Slice<ItemList>
+
+        var startIndex: Int {
+
+            return 0
+        }
+
+        var endIndex: Int {
+
+            return self.root.count
+        }
+
+        var count: Int {
+
+            return self.root.count
+        }
+
+        func index(after i: Int) -> Int {
+
+            return i + 1
+        }
+
+        func index(before i: Int) -> Int {
+
+            return i - 1
+        }
+
+
+        // MARK: MutableCollection
+
+        subscript(position: Int) -> Item {
+
+            get {
+
+                Internals.assert(self.indices.contains(position), "Index \(position) is out of bounds")
+                return self.root.item(at: position)
+            }
+            set {
+
+                Internals.assert(self.indices.contains(position), "Index \(position) is out of bounds")
+                let oldItemID = self.root.item(at: position).differenceIdentifier
+                Node.setItem(newValue, at: position, in: &self.root)
+                if oldItemID != newValue.differenceIdentifier {
+
+                    self.reindexItems(replacing: [oldItemID], in: position ..< (position + 1), shiftsFollowingItems: false)
+                }
+            }
+        }
+
+
+        // MARK: RangeReplaceableCollection
+
+        init() {
+
+            self.root = Node(items: [])
+        }
+
+        mutating func replaceSubrange<C: Collection>(_ subrange: Range<Int>, with newElements: C) where C.Element == Item {
+
+            Internals.assert(
+                subrange.lowerBound >= 0 && subrange.upperBound <= self.count,
+                "Range \(subrange) is out of bounds"
+            )
+            let newCount = newElements.count
+            if subrange.count > 0 && subrange.count == self.count {
+
+                self.root = Node.build(ContiguousArray(newElements))
+                self.itemIndices = .init()
+                return
+            }
+            let removedItemIDs = self.itemIndices.isIndexed
+                ? self.items(in: subrange).map({ $0.differenceIdentifier })
+                : []
+            switch (subrange.count, newCount) {
+
+            case (0, 0):
+                return
+
+            case (0, 1):
+                self.insertItem(newElements.first!, at: subrange.lowerBound)
+
+            case (1, 0):
+                self.removeItem(at: subrange.lowerBound)
+
+            default:
+                let (prefix, remainder) = Node.split(self.root, at: subrange.lowerBound)
+                let (_, suffix) = Node.split(remainder, at: subrange.count)
+                let middle = Node.build(ContiguousArray(newElements))
+                self.root = Node.trimmed(Node.join(Node.join(prefix, middle), suffix))
+            }
+            self.reindexItems(
+                replacing: removedItemIDs,
+                in: subrange.lowerBound ..< (subrange.lowerBound + newCount),
+                shiftsFollowingItems: newCount != subrange.count
+            )
+        }
+
+
+        // MARK: Internal
+
+        /**
+         Returns the position of the item with the specified identifier. The positions of all items are indexed on the first lookup, so repeated lookups are O(1). Mutations update the index in place, re-recording only the positions of the replaced items and, if the count changed, of the items after them.
+         */
+        func index(ofItem itemID: NSManagedObjectID) -> Int? {
+
+            return self.itemIndices.index(of: itemID, in: self)
+        }
+
+
+        // MARK: - Iterator
+
+        internal struct Iterator: IteratorProtocol {
+
+            // MARK: IteratorProtocol
+
+            mutating func next() -> Item? {
+
+                while self.leafIndex < self.leaves.count {
+
+                    let leaf = self.leaves[self.leafIndex]
+                    if self.itemIndex < leaf.count {
+
+                        defer {
+
+                            self.itemIndex += 1
+                        }
+                        return leaf[self.itemIndex]
+                    }
+                    self.leafIndex += 1
+                    self.itemIndex = 0
+                }
+                return nil
+            }
+
+
+            // MARK: FilePrivate
+
+            fileprivate init(leaves: [ContiguousArray<Item>]) {
+
+                self.leaves = leaves
+            }
+
+
+            // MARK: Private
+
+            private let leaves: [ContiguousArray<Item>]
+            private var leafIndex: Int = 0
+            private var itemIndex: Int = 0
+        }
+
+
+        // MARK: Private
+
+        private var root: Node
+        private var itemIndices: ItemIndices = .init()
+
+        private mutating func insertItem(_ item: Item, at index: Int) {
+
+            if let sibling = Node.insert(item, at: index, into: &self.root) {
+
+                self.root = Node(children: [self.root, sibling])
+            }
+        }
+
+        @discardableResult
+        private mutating func removeItem(at index: Int) -> Item {
+
+            let item = Node.remove(at: index, from: &self.root)
+            self.root = Node.trimmed(self.root)
+            return item
+        }
+
+        private func items(in range: Range<Int>) -> ContiguousArray<Item> {
+
+            var items: ContiguousArray<Item> = []
+            items.reserveCapacity(range.count)
+            self.root.forEachItem(in: range, { items.append($0) })
+            return items
+        }
+
+        /**
+         Updates the item index after `removedItemIDs` were replaced with the items now in `range`. If `shiftsFollowingItems` is `true`, the positions of the items after `range` are re-recorded as well.
+         */
+        private mutating func reindexItems(replacing removedItemIDs: [NSManagedObjectID], in range: Range<Int>, shiftsFollowingItems: Bool) {
+
+            if !isKnownUniquelyReferenced(&self.itemIndices) {
+
+                // The index is shared with copies of this list, which still need their own positions
+                self.itemIndices = self.itemIndices.copy()
+            }
+            guard self.itemIndices.isIndexed else {
+
+                return
+            }
+            let reindexedRange = shiftsFollowingItems
+                ? range.lowerBound ..< self.count
+                : range
+            let itemIndices = self.itemIndices
+            itemIndices.update { (indices) in
+
+                for (offset, itemID) in removedItemIDs.enumerated() where indices[itemID] == range.lowerBound + offset {
+
+                    indices[itemID] = nil
+                }
+                var position = reindexedRange.lowerBound
+                self.root.forEachItem(in: reindexedRange) { (item) in
+
+                    indices[item.differenceIdentifier] = position
+                    position += 1
+                }
+            }
+        }
+
+
+        // MARK: - ItemIndices
+
+        private final class ItemIndices {
+
+            // MARK: FilePrivate
+
+            fileprivate var isIndexed: Bool {
+
+                self.lock.lock()
+                defer {
+
+                    self.lock.unlock()
+                }
+                return self.indices != nil
+            }
+
+            fileprivate func copy() -> ItemIndices {
+
+                let copy = ItemIndices()
+                self.lock.lock()
+                copy.indices = self.indices
+                self.lock.unlock()
+                return copy
+            }
+
+            fileprivate func update(_ body: (_ indices: inout [NSManagedObjectID: Int]) -> Void) {
+
+                self.lock.lock()
+                defer {
+
+                    self.lock.unlock()
+                }
+                guard var indices = self.indices else {
+
+                    return
+                }
+                self.indices = nil
+                body(&indices)
+                self.indices = indices
+            }
+
+            fileprivate func index(of itemID: NSManagedObjectID, in itemList: ItemList) -> Int? {
+
+                self.lock.lock()
+                defer {
+
+                    self.lock.unlock()
+                }
+                if let indices = self.indices {
+
+                    return indices[itemID]
+                }
+                var indices: [NSManagedObjectID: Int] = [:]
+                indices.reserveCapacity(itemList.count)
+                for (index, item) in itemList.enumerated() where indices[item.differenceIdentifier] == nil {
+
+                    indices[item.differenceIdentifier] = index
+                }
+                self.indices = indices
+                return indices[itemID]
+            }
+
+
+            // MARK: Private
+
+            private let lock: NSLock = .init()
+            private var indices: [NSManagedObjectID: Int]?
+        }
+
+
+        // MARK: - Node
+
+        private final class Node {
+
+            // MARK: FilePrivate
+
+            fileprivate static let maximumLeafWidth = 64
+            fileprivate static let maximumBranchWidth = 32
+
+            fileprivate let isLeaf: Bool
+            fileprivate let height: Int
+            fileprivate var count: Int
+            fileprivate var items: ContiguousArray<Item>
+            fileprivate var children: ContiguousArray<Node>
+
+            fileprivate init(items: ContiguousArray<Item>) {
+
+                self.isLeaf = true
+                self.height = 0
+                self.count = items.count
+                self.items = items
+                self.children = []
+            }
+
+            fileprivate init(children: ContiguousArray<Node>) {
+
+                self.isLeaf = false
+                self.height = (children.first?.height ?? 0) + 1
+                self.count = children.reduce(into: 0, { $0 += $1.count })
+                self.items = []
+                self.children = children
+            }
+
+            fileprivate static func build(_ items: ContiguousArray<Item>) -> Node {
+
+                guard items.count > Node.maximumLeafWidth else {
+
+                    return Node(items: items)
+                }
+                // Fill nodes to 3/4 so that the first few insertions don't split every node
+                let leafWidth = Node.maximumLeafWidth * 3 / 4
+                var level: ContiguousArray<Node> = []
+                for start in stride(from: 0, to: items.count, by: leafWidth) {
+
+                    level.append(Node(items: ContiguousArray(items[start ..< Swift.min(start + leafWidth, items.count)])))
+                }
+                let branchWidth = Node.maximumBranchWidth * 3 / 4
+                while level.count > 1 {
+
+                    var parentLevel: ContiguousArray<Node> = []
+                    for start in stride(from: 0, to: level.count, by: branchWidth) {
+
+                        parentLevel.append(Node(children: ContiguousArray(level[start ..< Swift.min(start + branchWidth, level.count)])))
+                    }
+                    level = parentLevel
+                }
+                return level[0]
+            }
+
+            /**
+             Splits a tree into the trees for the items before and after `index`. Only the nodes along the path to `index` are recreated; all other nodes are shared with `node`.
+             */
+            fileprivate static func split(_ node: Node, at index: Int) -> (prefix: Node, suffix: Node) {
+
+                if index == 0 {
+
+                    return (Node(items: []), node)
+                }
+                if index == node.count {
+
+                    return (node, Node(items: []))
+                }
+                if node.isLeaf {
+
+                    return (
+                        Node(items: ContiguousArray(node.items[..<index])),
+                        Node(items: ContiguousArray(node.items[index...]))
+                    )
+                }
+                let (childIndex, offset) = node.child(containing: index)
+                let (childPrefix, childSuffix) = self.split(node.children[childIndex], at: offset)
+                return (
+                    self.join(self.branch(node.children[..<childIndex]), childPrefix),
+                    self.join(childSuffix, self.branch(node.children[(childIndex + 1)...]))
+                )
+            }
+
+            /**
+             Concatenates two trees, whose leaves may be at different depths. The shorter tree is attached along the taller tree's facing edge, so only the nodes along that edge are recreated.
+             */
+            fileprivate static func join(_ left: Node, _ right: Node) -> Node {
+
+                if left.count == 0 {
+
+                    return right
+                }
+                if right.count == 0 {
+
+                    return left
+                }
+                if left.height == right.height {
+
+                    guard left.width + right.width <= left.maximumWidth else {
+
+                        return Node(children: [left, right])
+                    }
+                    return left.isLeaf
+                        ? Node(items: left.items + right.items)
+                        : Node(children: left.children + right.children)
+                }
+                if left.height > right.height {
+
+                    var children = left.children
+                    let joined = self.join(children.removeLast(), right)
+                    if joined.height == left.height {
+
+                        children.append(contentsOf: joined.children)
+                    }
+                    else {
+
+                        children.append(joined)
+                    }
+                    return self.branch(splitting: children)
+                }
+                var children = right.children
+                let joined = self.join(left, children.removeFirst())
+                if joined.height == right.height {
+
+                    children.insert(contentsOf: joined.children, at: 0)
+                }
+                else {
+
+                    children.insert(joined, at: 0)
+                }
+                return self.branch(splitting: children)
+            }
+
+            fileprivate static func trimmed(_ node: Node) -> Node {
+
+                var node = node
+                while !node.isLeaf && node.children.count == 1 {
+
+                    node = node.children[0]
+                }
+                if !node.isLeaf && node.children.isEmpty {
+
+                    return Node(items: [])
+                }
+                return node
+            }
+
+            fileprivate static func setItem(_ item: Item, at index: Int, in node: inout Node) {
+
+                self.makeUnique(&node)
+                if node.isLeaf {
+
+                    node.items[index] = item
+                    return
+                }
+                let (childIndex, offset) = node.child(containing: index)
+                self.setItem(item, at: offset, in: &node.children[childIndex])
+            }
+
+            fileprivate static func insert(_ item: Item, at index: Int, into node: inout Node) -> Node? {
+
+                self.makeUnique(&node)
+                node.count += 1
+                if node.isLeaf {
+
+                    node.items.insert(item, at: index)
+                    guard node.items.count > Node.maximumLeafWidth else {
+
+                        return nil
+                    }
+                    let sibling = Node(items: ContiguousArray(node.items[(node.items.count / 2)...]))
+                    node.items.removeLast(sibling.items.count)
+                    node.count -= sibling.count
+                    return sibling
+                }
+                let (childIndex, offset) = node.child(forInsertingAt: index)
+                guard let childSibling = self.insert(item, at: offset, into: &node.children[childIndex]) else {
+
+                    return nil
+                }
+                node.children.insert(childSibling, at: childIndex + 1)
+                guard node.children.count > Node.maximumBranchWidth else {
+
+                    return nil
+                }
+                let sibling = Node(children: ContiguousArray(node.children[(node.children.count / 2)...]))
+                node.children.removeLast(sibling.children.count)
+                node.count -= sibling.count
+                return sibling
+            }
+
+            fileprivate static func remove(at index: Int, from node: inout Node) -> Item {
+
+                self.makeUnique(&node)
+                node.count -= 1
+                if node.isLeaf {
+
+                    return node.items.remove(at: index)
+                }
+                let (childIndex, offset) = node.child(containing: index)
+                let item = self.remove(at: offset, from: &node.children[childIndex])
+                node.rebalanceChild(at: childIndex)
+                return item
+            }
+
+            fileprivate func item(at index: Int) -> Item {
+
+                var node = self
+                var offset = index
+                while !node.isLeaf {
+
+                    let (childIndex, childOffset) = node.child(containing: offset)
+                    node = node.children[childIndex]
+                    offset = childOffset
+                }
+                return node.items[offset]
+            }
+
+            fileprivate func forEachItem(in range: Range<Int>, _ body: (Item) -> Void) {
+
+                if self.isLeaf {
+
+                    self.items[range].forEach(body)
+                    return
+                }
+                var childStart = 0
+                for child in self.children {
+
+                    let childRange = childStart ..< (childStart + child.count)
+                    childStart = childRange.upperBound
+                    if childRange.lowerBound >= range.upperBound {
+
+                        return
+                    }
+                    let overlap = range.clamped(to: childRange)
+                    guard !overlap.isEmpty else {
+
+                        continue
+                    }
+                    child.forEachItem(
+                        in: (overlap.lowerBound - childRange.lowerBound) ..< (overlap.upperBound - childRange.lowerBound),
+                        body
+                    )
+                }
+            }
+
+            fileprivate func collectLeaves(into leaves: inout [ContiguousArray<Item>]) {
+
+                if self.isLeaf {
+
+                    leaves.append(self.items)
+                    return
+                }
+                for child in self.children {
+
+                    child.collectLeaves(into: &leaves)
+                }
+            }
+
+
+            // MARK: Private
+
+            private var width: Int {
+
+                return self.isLeaf ? self.items.count : self.children.count
+            }
+
+            private var maximumWidth: Int {
+
+                return self.isLeaf ? Node.maximumLeafWidth : Node.maximumBranchWidth
+            }
+
+            private static func branch(_ children: ArraySlice<Node>) -> Node {
+
+                switch children.count {
+
+                case 0:
+                    return Node(items: [])
+
+                case 1:
+                    return children[children.startIndex]
+
+                default:
+                    return Node(children: ContiguousArray(children))
+                }
+            }
+
+            private static func branch(splitting children: ContiguousArray<Node>) -> Node {
+
+                guard children.count > Node.maximumBranchWidth else {
+
+                    return Node(children: children)
+                }
+                let middle = children.count / 2
+                return Node(
+                    children: [
+                        Node(children: ContiguousArray(children[..<middle])),
+                        Node(children: ContiguousArray(children[middle...]))
+                    ]
+                )
+            }
+
+            private static func makeUnique(_ node: inout Node) {
+
+                guard !isKnownUniquelyReferenced(&node) else {
+
+                    return
+                }
+                node = node.isLeaf
+                    ? Node(items: node.items)
+                    : Node(children: node.children)
+            }
+
+            private func child(containing index: Int) -> (childIndex: Int, offset: Int) {
+
+                var offset = index
+                var childIndex = 0
+                while offset >= self.children[childIndex].count {
+
+                    offset -= self.children[childIndex].count
+                    childIndex += 1
+                }
+                return (childIndex, offset)
+            }
+
+            private func child(forInsertingAt index: Int) -> (childIndex: Int, offset: Int) {
+
+                var offset = index
+                var childIndex = 0
+                while childIndex < self.children.count - 1 && offset > self.children[childIndex].count {
+
+                    offset -= self.children[childIndex].count
+                    childIndex += 1
+                }
+                return (childIndex, offset)
+            }
+
+            private func rebalanceChild(at childIndex: Int) {
+
+                let child = self.children[childIndex]
+                if child.count == 0 {
+
+                    self.children.remove(at: childIndex)
+                    return
+                }
+                // Merge underfull nodes with a neighbor so that removals don't leave the tree sparse
+                guard child.width < child.maximumWidth / 4, self.children.count > 1 else {
+
+                    return
+                }
+                let leftIndex = childIndex > 0 ? childIndex - 1 : childIndex
+                let rightIndex = leftIndex + 1
+                guard self.children[leftIndex].width + self.children[rightIndex].width <= child.maximumWidth else {
+
+                    return
+                }
+                let right = self.children.remove(at: rightIndex)
+                Node.makeUnique(&self.children[leftIndex])
+
+                let left = self.children[leftIndex]
+                if left.isLeaf {
+
+                    left.items.append(contentsOf: right.items)
+                }
+                else {
+
+                    left.children.append(contentsOf: right.children)
+                }
+                left.count += right.count
+            }
+        }
+    }
+}
+
+#endif
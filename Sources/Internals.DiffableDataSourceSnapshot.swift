@@ -74,6 +74,30 @@ extension Internals {
             }
         }
 
+        func hasSameStructure(as other: DiffableDataSourceSnapshot) -> Bool {
+
+            let sections = self.structure.sections
+            let otherSections = other.structure.sections
+            guard sections.count == otherSections.count else {
+
+                return false
+            }
+            for (section, otherSection) in zip(sections, otherSections) {
+
+                guard
+                    section.differenceIdentifier == otherSection.differenceIdentifier,
+                    section.indexTitle == otherSection.indexTitle,
+                    section.elements.count == otherSection.elements.count,
+                    zip(section.elements, otherSection.elements)
+                        .allSatisfy({ $0.differenceIdentifier == $1.differenceIdentifier })
+                else {
+
+                    return false
+                }
+            }
+            return true
+        }
+
 
         // MARK: DiffableDataSourceSnapshotProtocol
 
@@ -89,7 +113,7 @@ extension Internals {
 
         var numberOfSections: Int {
 
-            return self.structure.allSectionIDs.count
+            return self.structure.sections.count
         }
 
         var sectionIdentifiers: [String] {
@@ -109,7 +133,42 @@ extension Internals {
 
         func numberOfItems(inSection identifier: String) -> Int {
 
-            return self.itemIdentifiers(inSection: identifier).count
+            return self.structure.numberOfItems(in: identifier)
+        }
+
+        func sectionIdentifier(atSectionIndex sectionIndex: Int) -> String? {
+
+            let sections = self.structure.sections
+            guard sections.indices.contains(sectionIndex) else {
+
+                return nil
+            }
+            return sections[sectionIndex].differenceIdentifier
+        }
+
+        func numberOfItems(atSectionIndex sectionIndex: Int) -> Int? {
+
+            let sections = self.structure.sections
+            guard sections.indices.contains(sectionIndex) else {
+
+                return nil
+            }
+            return sections[sectionIndex].elements.count
+        }
+
+        func itemIdentifier(atSectionIndex sectionIndex: Int, itemIndex: Int) -> NSManagedObjectID? {
+
+            let sections = self.structure.sections
+            guard sections.indices.contains(sectionIndex) else {
+
+                return nil
+            }
+            let elements = sections[sectionIndex].elements
+            guard elements.indices.contains(itemIndex) else {
+
+                return nil
+            }
+            return elements[itemIndex].differenceIdentifier
         }
 
         func itemIdentifier(atAllItemsIndex index: Int) -> NSManagedObjectID? {
@@ -177,12 +236,12 @@ extension Internals {
 
         func indexOfItem(_ identifier: NSManagedObjectID) -> Int? {
 
-            return self.structure.allItemIDs.firstIndex(of: identifier)
+            return self.structure.allItemsIndex(of: identifier)
         }
 
         func indexOfSection(_ identifier: String) -> Int? {
 
-            return self.structure.allSectionIDs.firstIndex(of: identifier)
+            return self.structure.sectionIndex(of: identifier)
         }
 
         mutating func appendItems<C: Collection>(_ identifiers: C, toSection sectionIdentifier: String?) where C.Element == NSManagedObjectID {
@@ -325,10 +384,12 @@ extension Internals {
                 isReloaded: Bool = false
             ) {
                 
-                self.differenceIdentifier = differenceIdentifier
-                self.indexTitle = indexTitle
-                self.elements = items
-                self.isReloaded = isReloaded
+                self.init(
+                    differenceIdentifier: differenceIdentifier,
+                    indexTitle: indexTitle,
+                    elements: ItemList(items),
+                    isReloaded: isReloaded
+                )
             }
 
             // MARK: Differentiable
@@ -344,17 +405,33 @@ extension Internals {
             
             // MARK: DifferentiableSection
             
-            var elements: [Item] = []
+            var elements: ItemList
 
             init<S: Sequence>(source: Section, elements: S) where S.Element == Item {
 
                 self.init(
                     differenceIdentifier: source.differenceIdentifier,
                     indexTitle: source.indexTitle,
-                    items: Array(elements),
+                    elements: ItemList(elements),
                     isReloaded: source.isReloaded
                 )
             }
+
+
+            // MARK: Private
+
+            private init(
+                differenceIdentifier: String,
+                indexTitle: String?,
+                elements: ItemList,
+                isReloaded: Bool
+            ) {
+
+                self.differenceIdentifier = differenceIdentifier
+                self.indexTitle = indexTitle
+                self.elements = elements
+                self.isReloaded = isReloaded
+            }
         }
 
 
@@ -389,9 +466,16 @@ extension Internals {
             // MARK: Internal
 
             let sectionIndexTransformer: (_ sectionName: String?) -> String?
-            var sections: [Section]
             private(set) var reloadedItems: Set<NSManagedObjectID>
 
+            var sections: [Section] {
+
+                didSet {
+
+                    self.sectionIndices = .init()
+                }
+            }
+
             init() {
 
                 self.sectionIndexTransformer = { _ in nil }
@@ -469,6 +553,20 @@ extension Internals {
                 return self.sections.lazy.flatMap({ $0.elements }).map({ $0.differenceIdentifier })
             }
 
+            func allItemsIndex(of itemID: NSManagedObjectID) -> Int? {
+
+                var offset = 0
+                for section in self.sections {
+
+                    if let itemRelativeIndex = section.elements.index(ofItem: itemID) {
+
+                        return offset + itemRelativeIndex
+                    }
+                    offset += section.elements.count
+                }
+                return nil
+            }
+
             func items(in sectionID: String) -> [NSManagedObjectID] {
 
                 guard let sectionIndex = self.sectionIndex(of: sectionID) else {
@@ -477,6 +575,20 @@ extension Internals {
                 }
                 return self.sections[sectionIndex].elements.map({ $0.differenceIdentifier })
             }
+
+            func numberOfItems(in sectionID: String) -> Int {
+
+                guard let sectionIndex = self.sectionIndex(of: sectionID) else {
+
+                    Internals.abort("Section \"\(sectionID)\" does not exist")
+                }
+                return self.sections[sectionIndex].elements.count
+            }
+
+            func sectionIndex(of sectionID: String) -> Array<Section>.Index? {
+
+                return self.sectionIndices.index(of: sectionID, in: self.sections)
+            }
             
             func unsafeItem(at indexPath: IndexPath) -> NSManagedObjectID {
                 
@@ -858,10 +970,8 @@ extension Internals {
 
             // MARK: Private
 
-            private func sectionIndex(of sectionID: String) -> Array<Section>.Index? {
-
-                return self.sections.firstIndex(where: { $0.differenceIdentifier == sectionID })
-            }
+            // Shared between copies until `sections` is mutated, after which the mutated copy gets a fresh one
+            private var sectionIndices: SectionIndices = .init()
 
             @discardableResult
             private mutating func remove(itemID: NSManagedObjectID) -> Item? {
@@ -889,19 +999,16 @@ extension Internals {
                 let sections = self.sections
                 for (sectionIndex, section) in sections.enumerated() {
 
-                    for (itemRelativeIndex, item) in section.elements.enumerated() {
+                    guard let itemRelativeIndex = section.elements.index(ofItem: itemID) else {
 
-                        guard item.differenceIdentifier == itemID else {
-
-                            continue
-                        }
-                        return ItemPosition(
-                            item: item,
-                            itemRelativeIndex: itemRelativeIndex,
-                            section: section,
-                            sectionIndex: sectionIndex
-                        )
+                        continue
                     }
+                    return ItemPosition(
+                        item: section.elements[itemRelativeIndex],
+                        itemRelativeIndex: itemRelativeIndex,
+                        section: section,
+                        sectionIndex: sectionIndex
+                    )
                 }
                 return nil
             }
@@ -932,6 +1039,41 @@ extension Internals {
                 let section: Section
                 let sectionIndex: Int
             }
+
+
+            // MARK: - SectionIndices
+
+            fileprivate final class SectionIndices {
+
+                // MARK: FilePrivate
+
+                fileprivate func index(of sectionID: String, in sections: [Section]) -> Int? {
+
+                    self.lock.lock()
+                    defer {
+
+                        self.lock.unlock()
+                    }
+                    if let indices = self.indices {
+
+                        return indices[sectionID]
+                    }
+                    var indices: [String: Int] = [:]
+                    indices.reserveCapacity(sections.count)
+                    for (index, section) in sections.enumerated() where indices[section.differenceIdentifier] == nil {
+
+                        indices[section.differenceIdentifier] = index
+                    }
+                    self.indices = indices
+                    return indices[sectionID]
+                }
+
+
+                // MARK: Private
+
+                private let lock: NSLock = .init()
+                private var indices: [String: Int]?
+            }
         }
     }
 }
@@ -55,6 +55,8 @@ extension Internals {
         func purge<Target: DiffableDataSource.Target>(
             target: Target?,
             animatingDifferences: Bool,
+            largeChangesetPolicy: DiffableDataSource.LargeChangesetPolicy = .disabled,
+            didEstimateChangeset: @escaping (DiffableDataSource.LargeChangesetPolicy.Estimate?) -> Void = { _ in },
             performUpdates: @escaping (
                 Target,
                 StagedChangeset<[Internals.DiffableDataSourceSnapshot.Section]>,
@@ -67,6 +69,8 @@ extension Internals {
                 .init(),
                 target: target,
                 animatingDifferences: animatingDifferences,
+                largeChangesetPolicy: largeChangesetPolicy,
+                didEstimateChangeset: didEstimateChangeset,
                 performUpdates: performUpdates,
                 completion: completion
             )
@@ -76,6 +80,8 @@ extension Internals {
             _ snapshot: DiffableDataSourceSnapshot,
             target: Target?,
             animatingDifferences: Bool,
+            largeChangesetPolicy: DiffableDataSource.LargeChangesetPolicy = .disabled,
+            didEstimateChangeset: @escaping (DiffableDataSource.LargeChangesetPolicy.Estimate?) -> Void = { _ in },
             performUpdates: @escaping (
                 Target,
                 StagedChangeset<[Internals.DiffableDataSourceSnapshot.Section]>,
@@ -100,8 +106,19 @@ extension Internals {
                     return
                 }
 
+                let estimate = largeChangesetPolicy.isDisabled
+                    ? nil
+                    : largeChangesetPolicy.estimate(source: self.sections, target: newSections)
+                didEstimateChangeset(estimate)
+
                 let performDiffingUpdates: () -> Void = {
-                    
+
+                    if estimate?.reloadsData == true {
+
+                        self.sections = newSections
+                        target.reloadData()
+                        return
+                    }
                     let changeset = StagedChangeset(source: self.sections, target: newSections)
                     performUpdates(target, changeset) { sections in
                         
@@ -0,0 +1,225 @@
+//
+//  Internals.ExpiryScheduler.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - ExpiryScheduler
+
+    /**
+     Runs a `DataStack`'s `ExpiryPolicy` on a repeating timer. Purges run one at a time on a serial utility queue, each with its own private-queue context attached directly to the `DataStack`'s coordinator.
+     */
+    internal final class ExpiryScheduler {
+
+        // MARK: Internal
+
+        internal weak var parentStack: DataStack?
+
+        internal var policy: DataStack.ExpiryPolicy? {
+
+            didSet {
+
+                self.timer?.cancel()
+                self.timer = nil
+                guard let policy = self.policy else {
+
+                    return
+                }
+                let interval = DispatchTimeInterval.milliseconds(Int(policy.interval * 1000))
+                let timer = DispatchSource.makeTimerSource(queue: self.queue)
+                timer.schedule(
+                    deadline: .now() + interval,
+                    repeating: interval,
+                    leeway: .milliseconds(Int(policy.interval * 100))
+                )
+                timer.setEventHandler { [weak self] in
+
+                    self?.purgeAndWait(policy, completion: nil)
+                }
+                timer.resume()
+                self.timer = timer
+            }
+        }
+
+        deinit {
+
+            self.timer?.cancel()
+        }
+
+        internal func purge(completion: ((DataStack.ExpiryPolicy.Report) -> Void)?) {
+
+            guard let policy = self.policy else {
+
+                completion?(
+                    DataStack.ExpiryPolicy.Report(
+                        purgedObjectCounts: [:],
+                        batchCount: 0,
+                        duration: 0,
+                        errors: []
+                    )
+                )
+                return
+            }
+            self.queue.async { [weak self] in
+
+                self?.purgeAndWait(policy, completion: completion)
+            }
+        }
+
+
+        // MARK: Private
+
+        private let queue = DispatchQueue.serial("com.coreStore.dataStack.expiryQueue", qos: .utility)
+        private var timer: DispatchSourceTimer?
+
+        private func purgeAndWait(_ policy: DataStack.ExpiryPolicy, completion: ((DataStack.ExpiryPolicy.Report) -> Void)?) {
+
+            guard let dataStack = self.parentStack else {
+
+                return
+            }
+            let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+            context.persistentStoreCoordinator = dataStack.coordinator
+            context.undoManager = nil
+            context.name = "com.coreStore.expiryContext"
+            context.parentStack = dataStack
+
+            var purgedObjectCounts: [EntityName: Int] = [:]
+            var batchCount = 0
+            var errors: [CoreStoreError] = []
+
+            let start = Date()
+            for rule in policy.rules {
+
+                do {
+
+                    let result = try rule.purge(context, start, policy.batchSize)
+                    purgedObjectCounts[result.entityName, default: 0] += result.purgedObjectCount
+                    batchCount += result.batchCount
+                }
+                catch {
+
+                    let purgeError = CoreStoreError(error)
+                    Internals.log(
+                        purgeError,
+                        "Failed to purge expired \(rule.typeName) objects."
+                    )
+                    errors.append(purgeError)
+                }
+            }
+            let report = DataStack.ExpiryPolicy.Report(
+                purgedObjectCounts: purgedObjectCounts,
+                batchCount: batchCount,
+                duration: Date().timeIntervalSince(start),
+                errors: errors
+            )
+            DispatchQueue.main.async {
+
+                policy.reportHandler?(report)
+                completion?(report)
+            }
+        }
+    }
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    /**
+     Deletes objects directly from their persistent stores, then merges the deletions into the `DataStack`'s root saving context and main context. Objects in `SQLiteStore`s are deleted with an `NSBatchDeleteRequest`; objects in other stores are deleted through this context. The context should be attached directly to the `DataStack`'s coordinator.
+     */
+    @nonobjc
+    internal func batchDeleteObjects(_ objectIDs: [NSManagedObjectID]) throws -> Int {
+
+        var deletedObjectIDs: [NSManagedObjectID] = []
+        var deleteError: Error?
+        self.performAndWait {
+
+            do {
+
+                let sqliteObjectIDs = objectIDs.filter({ $0.persistentStore?.type == NSSQLiteStoreType })
+                if !sqliteObjectIDs.isEmpty {
+
+                    let deleteRequest = NSBatchDeleteRequest(objectIDs: sqliteObjectIDs)
+                    deleteRequest.resultType = .resultTypeObjectIDs
+                    let result = try self.execute(deleteRequest) as? NSBatchDeleteResult
+                    deletedObjectIDs.append(contentsOf: (result?.result as? [NSManagedObjectID]) ?? [])
+                }
+                let otherObjectIDs = objectIDs.filter({ $0.persistentStore?.type != NSSQLiteStoreType })
+                if !otherObjectIDs.isEmpty {
+
+                    defer {
+
+                        self.reset()
+                    }
+                    for objectID in otherObjectIDs {
+
+                        self.delete(self.object(with: objectID))
+                    }
+                    try self.save()
+                    deletedObjectIDs.append(contentsOf: otherObjectIDs)
+                }
+            }
+            catch {
+
+                deleteError = error
+            }
+        }
+        if !deletedObjectIDs.isEmpty, let parentStack = self.parentStack {
+
+            NSManagedObjectContext.mergeChanges(
+                fromRemoteContextSave: [NSDeletedObjectsKey: deletedObjectIDs],
+                into: [parentStack.rootSavingContext, parentStack.mainContext]
+            )
+            parentStack.fullTextIndexer.removeObjects(deletedObjectIDs)
+            NotificationCenter.default.post(
+                name: .dataStackDidBatchDeleteObjects,
+                object: parentStack
+            )
+        }
+        if let deleteError = deleteError {
+
+            throw CoreStoreError(deleteError)
+        }
+        return deletedObjectIDs.count
+    }
+}
+
+
+// MARK: - Notification Keys
+
+extension Notification.Name {
+
+    internal static let dataStackDidBatchDeleteObjects = Notification.Name(rawValue: "dataStackDidBatchDeleteObjects")
+}
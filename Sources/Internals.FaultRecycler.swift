@@ -0,0 +1,188 @@
+//
+//  Internals.FaultRecycler.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - FaultRecycler
+
+    /**
+     Periodically turns stale objects in a `DataStack`'s main context back into faults, as configured by `MemoryPolicy.recyclingInterval`. An object is stale if it stayed materialized and unobserved for a whole interval, where observed objects are those referenced by an `ObjectPublisher` with observers, or by a live `ListPublisher`, `ListMonitor`, or `ObjectMonitor` of the main context. The timer runs on a utility queue, and each pass refreshes objects in slices of `recyclingBatchSize` so that the main queue can process other work between slices.
+     */
+    internal final class FaultRecycler {
+
+        // MARK: Internal
+
+        internal weak var parentStack: DataStack?
+
+        internal var policy: DataStack.MemoryPolicy? {
+
+            get {
+
+                self.lock.lock()
+                defer {
+
+                    self.lock.unlock()
+                }
+                return self.currentPolicy
+            }
+            set {
+
+                self.lock.lock()
+                let oldValue = self.currentPolicy
+                self.currentPolicy = newValue
+                self.lock.unlock()
+
+                guard newValue?.recyclingInterval != oldValue?.recyclingInterval else {
+
+                    return
+                }
+                self.timer?.cancel()
+                self.timer = nil
+                self.mainContext?.perform {
+
+                    self.idleObjectIDs = []
+                }
+                guard let interval = newValue?.recyclingInterval else {
+
+                    return
+                }
+                let dispatchInterval = DispatchTimeInterval.milliseconds(Int(interval * 1000))
+                let timer = DispatchSource.makeTimerSource(queue: self.queue)
+                timer.schedule(
+                    deadline: .now() + dispatchInterval,
+                    repeating: dispatchInterval,
+                    leeway: .milliseconds(Int(interval * 100))
+                )
+                timer.setEventHandler { [weak self] in
+
+                    self?.recycle(completion: nil)
+                }
+                timer.resume()
+                self.timer = timer
+            }
+        }
+
+        internal var statistics: (recycledObjectCount: Int, passCount: Int) {
+
+            self.lock.lock()
+            defer {
+
+                self.lock.unlock()
+            }
+            return (self.recycledObjectCount, self.passCount)
+        }
+
+        deinit {
+
+            self.timer?.cancel()
+        }
+
+        /**
+         Runs a recycling pass. Objects first seen idle in this pass are only recycled by the next one. The completion closure is executed on the main context's queue after the last slice.
+         */
+        internal func recycle(completion: ((_ recycledObjectCount: Int) -> Void)?) {
+
+            guard let mainContext = self.mainContext else {
+
+                return
+            }
+            let batchSize = self.policy?.recyclingBatchSize ?? DataStack.MemoryPolicy.defaultRecyclingBatchSize
+            mainContext.perform { [weak self] in
+
+                guard let self = self else {
+
+                    return
+                }
+                let observedObjectIDs = mainContext.observedObjectIDs()
+                var idleObjectIDs: Set<NSManagedObjectID> = []
+                for object in mainContext.registeredObjects where !object.isFault && !object.hasChanges {
+
+                    if !observedObjectIDs.contains(object.objectID) {
+
+                        idleObjectIDs.insert(object.objectID)
+                    }
+                }
+                let staleObjectIDs = Array(idleObjectIDs.intersection(self.idleObjectIDs))
+                self.idleObjectIDs = idleObjectIDs.subtracting(staleObjectIDs)
+                self.refreshSlices(of: staleObjectIDs[...], in: mainContext, batchSize: batchSize, recycledObjectCount: 0, completion: completion)
+            }
+        }
+
+
+        // MARK: Private
+
+        private let queue = DispatchQueue.serial("com.coreStore.dataStack.faultRecyclerQueue", qos: .utility)
+        private let lock = NSLock()
+        private var currentPolicy: DataStack.MemoryPolicy?
+        private var timer: DispatchSourceTimer?
+        private var recycledObjectCount = 0
+        private var passCount = 0
+
+        // Only accessed from the main context's queue
+        private var idleObjectIDs: Set<NSManagedObjectID> = []
+
+        private var mainContext: NSManagedObjectContext? {
+
+            return self.parentStack?.mainContext
+        }
+
+        private func refreshSlices(of objectIDs: ArraySlice<NSManagedObjectID>, in context: NSManagedObjectContext, batchSize: Int, recycledObjectCount: Int, completion: ((_ recycledObjectCount: Int) -> Void)?) {
+
+            var recycledObjectCount = recycledObjectCount
+            for objectID in objectIDs.prefix(batchSize) {
+
+                guard let object = context.registeredObject(for: objectID),
+                    !object.isFault,
+                    !object.hasChanges else {
+
+                    continue
+                }
+                context.refresh(object, mergeChanges: false)
+                recycledObjectCount += 1
+            }
+            let remainingObjectIDs = objectIDs.dropFirst(batchSize)
+            guard remainingObjectIDs.isEmpty else {
+
+                context.perform { [weak self] in
+
+                    self?.refreshSlices(of: remainingObjectIDs, in: context, batchSize: batchSize, recycledObjectCount: recycledObjectCount, completion: completion)
+                }
+                return
+            }
+            self.lock.lock()
+            self.recycledObjectCount += recycledObjectCount
+            self.passCount += 1
+            self.lock.unlock()
+
+            completion?(recycledObjectCount)
+        }
+    }
+}
@@ -0,0 +1,834 @@
+//
+//  Internals.FullTextIndexer.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+import SQLite3
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - FullTextIndexer
+
+    /**
+     Maintains the FTS5 indexes declared by `SQLiteStore.fullTextIndexes`. Each indexed `SQLiteStore` gets its own SQLite database next to the store's file, with one FTS5 table per indexed entity whose `rowid`s are the objects' primary keys. Rows are updated from the root saving context's did-save notifications, and all database access is serialized on a utility queue.
+     */
+    internal final class FullTextIndexer {
+
+        // MARK: Internal
+
+        internal weak var parentStack: DataStack?
+
+        internal func attach(_ storage: SQLiteStore, persistentStore: NSPersistentStore, in dataStack: DataStack) {
+
+            guard let storeIdentifier = persistentStore.identifier else {
+
+                return
+            }
+            var tables: [Table] = []
+            for index in storage.fullTextIndexes {
+
+                guard let entityDescription = dataStack.entityDescription(for: index.entityIdentifier),
+                    let entityName = entityDescription.name else {
+
+                    Internals.abort("Attempted to declare a full-text index for the class \(Internals.typeName(index.entityIdentifier.interfacedClassName)), which is not an entity in the \(Internals.typeName(dataStack))'s model.")
+                }
+                tables.append(Table(entityName: entityName, keyPaths: index.keyPaths))
+            }
+            let generation = FullTextIndexer.generation(in: dataStack.coordinator.metadata(for: persistentStore))
+            self.lock.lock()
+            self.tablesByStoreIdentifier[storeIdentifier] = Dictionary(tables.map({ ($0.entityName, $0) }), uniquingKeysWith: { $1 })
+            self.lock.unlock()
+
+            let databaseURL = URL(fileURLWithPath: storage.fileURL.path.appending(FullTextIndexer.fileSuffix))
+            self.rebuildGroup.enter()
+            self.queue.async {
+
+                do {
+
+                    let database = try Database(url: databaseURL, storeIdentifier: storeIdentifier, tables: tables)
+                    self.lock.lock()
+                    self.databasesByStoreIdentifier[storeIdentifier] = database
+                    self.lock.unlock()
+
+                    // A different generation means that the store was saved without the index being updated, such as when the app was terminated in between
+                    let isStale = try database.generation() != generation
+                    let staleTables = try tables.filter({ try database.prepareTable($0, isStale: isStale) })
+                    self.rebuild(
+                        staleTables,
+                        in: database,
+                        persistentStore: persistentStore,
+                        dataStack: dataStack,
+                        generation: generation
+                    )
+                }
+                catch {
+
+                    Internals.log(
+                        CoreStoreError(error),
+                        "Failed to open the full-text index at \"\(databaseURL.path)\"."
+                    )
+                    self.rebuildGroup.leave()
+                }
+            }
+            if self.saveObservers.isEmpty {
+
+                self.saveObservers = [
+                    Internals.NotificationObserver(
+                        notificationName: .NSManagedObjectContextWillSave,
+                        object: dataStack.rootSavingContext,
+                        closure: { [weak self] (note) in
+
+                            self?.handleWillSave(note)
+                        }
+                    ),
+                    Internals.NotificationObserver(
+                        notificationName: .NSManagedObjectContextDidSave,
+                        object: dataStack.rootSavingContext,
+                        closure: { [weak self] (note) in
+
+                            self?.handleDidSave(note)
+                        }
+                    )
+                ]
+            }
+        }
+
+        internal func removeObjects(_ objectIDs: [NSManagedObjectID]) {
+
+            self.enqueueChanges(
+                objectIDs.map({ Change(objectID: $0, values: nil) }),
+                generations: [:]
+            )
+        }
+
+        internal func search(_ entityDescription: NSEntityDescription, in persistentStores: [NSPersistentStore], matching searchText: String, limit: Int) throws -> [NSManagedObjectID] {
+
+            guard let matchExpression = FullTextIndexer.matchExpression(for: searchText),
+                let coordinator = self.parentStack?.coordinator else {
+
+                return []
+            }
+            self.lock.lock()
+            let indexedStoreIdentifiers = persistentStores.compactMap { (persistentStore) -> String? in
+
+                guard let storeIdentifier = persistentStore.identifier,
+                    let tablesByEntityName = self.tablesByStoreIdentifier[storeIdentifier],
+                    FullTextIndexer.table(for: entityDescription, in: tablesByEntityName) != nil else {
+
+                    return nil
+                }
+                return storeIdentifier
+            }
+            self.lock.unlock()
+            Internals.assert(
+                !indexedStoreIdentifiers.isEmpty,
+                "Attempted to search the entity \(Internals.typeName(entityDescription.name)) which has no full-text index. Declare one in SQLiteStore.fullTextIndexes."
+            )
+            let entityNames = FullTextIndexer.entityNames(of: entityDescription)
+
+            // Rebuilds are written in batches, so this only waits for pending updates and at most one batch. Objects that a rebuild has not reached yet are not matched.
+            return try self.queue.sync {
+
+                var results: [(objectID: NSManagedObjectID, score: Double)] = []
+                for storeIdentifier in indexedStoreIdentifiers {
+
+                    guard let database = self.database(for: storeIdentifier),
+                        let table = database.table(for: entityDescription) else {
+
+                        continue
+                    }
+                    for (entityName, primaryKey, score) in try database.search(table, matching: matchExpression, entityNames: entityNames, limit: limit) {
+
+                        guard let uri = URL(string: "x-coredata://\(storeIdentifier)/\(entityName)/p\(primaryKey)"),
+                            let objectID = coordinator.managedObjectID(forURIRepresentation: uri) else {
+
+                            continue
+                        }
+                        results.append((objectID, score))
+                    }
+                }
+                return results
+                    .sorted(by: { $0.score < $1.score })
+                    .prefix(limit)
+                    .map({ $0.objectID })
+            }
+        }
+
+        /**
+         Blocks until the indexes of all attached stores are opened and rebuilt
+         */
+        internal func waitUntilRebuilt() {
+
+            self.rebuildGroup.wait()
+        }
+
+
+        // MARK: Private
+
+        private static let fileSuffix = "-fts"
+        private static let generationMetadataKey = "CoreStoreFullTextIndexGeneration"
+        private static let rebuildBatchSize = 500
+
+        private let queue = DispatchQueue.serial("com.coreStore.dataStack.fullTextIndexQueue", qos: .utility)
+        private let rebuildGroup = DispatchGroup()
+        private let lock = NSLock()
+        private var databasesByStoreIdentifier: [String: Database] = [:]
+        private var tablesByStoreIdentifier: [String: [EntityName: Table]] = [:]
+        private var pendingGenerations: [String: Int64] = [:]
+        private var saveObservers: [Internals.NotificationObserver] = []
+
+        private static func matchExpression(for searchText: String) -> String? {
+
+            let terms = searchText
+                .components(separatedBy: .whitespacesAndNewlines)
+                .filter({ !$0.isEmpty })
+                .map({ "\"\($0.replacingOccurrences(of: "\"", with: "\"\""))\"*" })
+            return terms.isEmpty ? nil : terms.joined(separator: " ")
+        }
+
+        private static func entityNames(of entityDescription: NSEntityDescription) -> Set<EntityName> {
+
+            return entityDescription.subentities.reduce(into: [entityDescription.name ?? ""]) {
+
+                $0.formUnion(self.entityNames(of: $1))
+            }
+        }
+
+        private static func table(for entityDescription: NSEntityDescription, in tablesByEntityName: [EntityName: Table]) -> Table? {
+
+            var entityDescription: NSEntityDescription? = entityDescription
+            while let currentEntity = entityDescription {
+
+                if let table = currentEntity.name.flatMap({ tablesByEntityName[$0] }) {
+
+                    return table
+                }
+                entityDescription = currentEntity.superentity
+            }
+            return nil
+        }
+
+        private static func generation(in metadata: [String: Any]) -> Int64 {
+
+            return (metadata[FullTextIndexer.generationMetadataKey] as? NSNumber)?.int64Value ?? 0
+        }
+
+        private static func primaryKey(of objectID: NSManagedObjectID) -> Int64? {
+
+            let component = objectID.uriRepresentation().lastPathComponent
+            guard !objectID.isTemporaryID, component.hasPrefix("p") else {
+
+                return nil
+            }
+            return Int64(component.dropFirst())
+        }
+
+        private func database(for storeIdentifier: String) -> Database? {
+
+            self.lock.lock()
+            defer {
+
+                self.lock.unlock()
+            }
+            return self.databasesByStoreIdentifier[storeIdentifier]
+        }
+
+        /**
+         Increments the generation in the metadata of the indexed stores that the save changes. The metadata is written in the same transaction as the saved objects, and the index records the generation with its own updates, so a mismatch on the next launch means that some saves never reached the index.
+         */
+        private func handleWillSave(_ note: Notification) {
+
+            guard let context = note.object as? NSManagedObjectContext,
+                let coordinator = context.persistentStoreCoordinator else {
+
+                return
+            }
+            self.lock.lock()
+            let tablesByStoreIdentifier = self.tablesByStoreIdentifier
+            self.lock.unlock()
+
+            var changedStores: [String: NSPersistentStore] = [:]
+            for object in context.insertedObjects.union(context.updatedObjects).union(context.deletedObjects) {
+
+                // Objects with temporary IDs may be saved to any store of their entity
+                for persistentStore in object.objectID.persistentStore.map({ [$0] }) ?? coordinator.persistentStores {
+
+                    guard let storeIdentifier = persistentStore.identifier,
+                        let tablesByEntityName = tablesByStoreIdentifier[storeIdentifier],
+                        FullTextIndexer.table(for: object.entity, in: tablesByEntityName) != nil else {
+
+                        continue
+                    }
+                    changedStores[storeIdentifier] = persistentStore
+                }
+            }
+            var generations: [String: Int64] = [:]
+            for (storeIdentifier, persistentStore) in changedStores {
+
+                var metadata = coordinator.metadata(for: persistentStore)
+                let generation = FullTextIndexer.generation(in: metadata) + 1
+                metadata[FullTextIndexer.generationMetadataKey] = NSNumber(value: generation)
+                coordinator.setMetadata(metadata, for: persistentStore)
+                generations[storeIdentifier] = generation
+            }
+            self.lock.lock()
+            self.pendingGenerations = generations
+            self.lock.unlock()
+        }
+
+        private func handleDidSave(_ note: Notification) {
+
+            let userInfo = note.userInfo ?? [:]
+            var changes: [Change] = []
+            for key in [NSInsertedObjectsKey, NSUpdatedObjectsKey] {
+
+                for object in (userInfo[key] as? Set<NSManagedObject>) ?? [] {
+
+                    guard let storeIdentifier = object.objectID.persistentStore?.identifier,
+                        let table = self.database(for: storeIdentifier)?.table(for: object.entity) else {
+
+                        continue
+                    }
+                    changes.append(
+                        Change(
+                            objectID: object.objectID,
+                            values: table.keyPaths.map({ object.value(forKey: $0) as? String })
+                        )
+                    )
+                }
+            }
+            for object in (userInfo[NSDeletedObjectsKey] as? Set<NSManagedObject>) ?? [] {
+
+                changes.append(Change(objectID: object.objectID, values: nil))
+            }
+            self.lock.lock()
+            let generations = self.pendingGenerations
+            self.pendingGenerations = [:]
+            self.lock.unlock()
+            self.enqueueChanges(changes, generations: generations)
+        }
+
+        private func enqueueChanges(_ changes: [Change], generations: [String: Int64]) {
+
+            guard !changes.isEmpty || !generations.isEmpty else {
+
+                return
+            }
+            self.queue.async {
+
+                var changesByStoreIdentifier = generations.mapValues({ _ in [Change]() })
+                for change in changes {
+
+                    guard let storeIdentifier = change.objectID.persistentStore?.identifier else {
+
+                        continue
+                    }
+                    changesByStoreIdentifier[storeIdentifier, default: []].append(change)
+                }
+                for (storeIdentifier, changes) in changesByStoreIdentifier {
+
+                    guard let database = self.database(for: storeIdentifier) else {
+
+                        continue
+                    }
+                    var generation = generations[storeIdentifier]
+                    if database.rebuildingGeneration != nil, let savedGeneration = generation {
+
+                        // The generation is only recorded once the rebuild is complete
+                        database.rebuildingGeneration = savedGeneration
+                        generation = nil
+                    }
+                    do {
+
+                        try database.write(
+                            changes.compactMap { (change) in
+
+                                guard let table = database.table(for: change.objectID.entity),
+                                    let primaryKey = FullTextIndexer.primaryKey(of: change.objectID) else {
+
+                                    return nil
+                                }
+                                return (table, primaryKey, change.objectID.entity.name ?? "", change.values)
+                            },
+                            generation: generation
+                        )
+                    }
+                    catch {
+
+                        Internals.log(
+                            CoreStoreError(error),
+                            "Failed to update the full-text index for the store \"\(storeIdentifier)\"."
+                        )
+                    }
+                }
+            }
+        }
+
+        /**
+         Reads the objects of the `tables` from the store and writes them to the index. Must be called from the `queue`. The rows are read and written one batch per `queue` item, so that index updates and searches are not blocked for the whole rebuild.
+         */
+        private func rebuild(_ tables: [Table], in database: Database, persistentStore: NSPersistentStore, dataStack: DataStack, generation: Int64) {
+
+            let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+            context.persistentStoreCoordinator = dataStack.coordinator
+            context.undoManager = nil
+            context.name = "com.coreStore.fullTextIndexContext"
+
+            // Set before reading, so that saves during the rebuild don't record their generation
+            database.rebuildingGeneration = generation
+
+            self.writeRebuildBatches(tables[...], after: nil, in: database, persistentStore: persistentStore, context: context)
+        }
+
+        /**
+         Writes the next batch of objects of the first of the `tables`, starting after the object with `lastObjectID`. Objects are paged in primary key order with a `SELF > lastObjectID` predicate, so each batch is a bounded range scan of the store's table and the object IDs of the whole table are never held in memory. `includesPendingChanges` is off so that the sort and predicate are always evaluated by SQLite.
+         */
+        private func writeRebuildBatches(_ tables: ArraySlice<Table>, after lastObjectID: NSManagedObjectID?, in database: Database, persistentStore: NSPersistentStore, context: NSManagedObjectContext) {
+
+            var nextTables = tables
+            var nextObjectID: NSManagedObjectID?
+            do {
+
+                guard let table = tables.first else {
+
+                    try database.write([], generation: database.rebuildingGeneration)
+                    database.rebuildingGeneration = nil
+                    self.rebuildGroup.leave()
+                    return
+                }
+                var batchError: Error?
+                context.performAndWait {
+
+                    do {
+
+                        let objectIDExpression = NSExpressionDescription()
+                        objectIDExpression.name = "objectID"
+                        objectIDExpression.expression = NSExpression.expressionForEvaluatedObject()
+                        objectIDExpression.expressionResultType = .objectIDAttributeType
+
+                        let valuesRequest = NSFetchRequest<NSDictionary>(entityName: table.entityName)
+                        valuesRequest.affectedStores = [persistentStore]
+                        valuesRequest.resultType = .dictionaryResultType
+                        valuesRequest.includesPendingChanges = false
+                        valuesRequest.propertiesToFetch = [objectIDExpression] + table.keyPaths
+                        valuesRequest.sortDescriptors = [NSSortDescriptor(key: "self", ascending: true)]
+                        valuesRequest.fetchLimit = FullTextIndexer.rebuildBatchSize
+                        valuesRequest.predicate = lastObjectID.map({ NSPredicate(format: "SELF > %@", $0) })
+
+                        let batch = try context.fetch(valuesRequest)
+                        try database.write(
+                            batch.compactMap { (values) in
+
+                                guard let objectID = values["objectID"] as? NSManagedObjectID,
+                                    let primaryKey = FullTextIndexer.primaryKey(of: objectID) else {
+
+                                    return nil
+                                }
+                                return (table, primaryKey, objectID.entity.name ?? "", table.keyPaths.map({ values[$0] as? String }))
+                            },
+                            generation: nil
+                        )
+                        if batch.count == FullTextIndexer.rebuildBatchSize,
+                            let lastObjectID = batch.last?["objectID"] as? NSManagedObjectID {
+
+                            nextObjectID = lastObjectID
+                        }
+                        else {
+
+                            nextTables = tables.dropFirst()
+                        }
+                    }
+                    catch {
+
+                        batchError = error
+                    }
+                    context.reset()
+                }
+                if let batchError = batchError {
+
+                    throw batchError
+                }
+            }
+            catch {
+
+                // The generation is left unrecorded, so the next launch rebuilds the index again
+                Internals.log(
+                    CoreStoreError(error),
+                    "Failed to rebuild the full-text index for the store \"\(persistentStore.identifier ?? "")\"."
+                )
+                self.rebuildGroup.leave()
+                return
+            }
+            self.queue.async {
+
+                self.writeRebuildBatches(nextTables, after: nextObjectID, in: database, persistentStore: persistentStore, context: context)
+            }
+        }
+
+
+        // MARK: - Change
+
+        private struct Change {
+
+            let objectID: NSManagedObjectID
+            let values: [String?]?
+        }
+
+
+        // MARK: - Table
+
+        private struct Table {
+
+            let entityName: EntityName
+            let keyPaths: [KeyPathString]
+
+            var name: String {
+
+                return "ZCSFTS_\(self.entityName)"
+            }
+
+            var signature: String {
+
+                return self.keyPaths.joined(separator: ",")
+            }
+        }
+
+
+        // MARK: - Database
+
+        private final class Database {
+
+            let handle: OpaquePointer
+
+            /**
+             The store generation to record once a rebuild completes, or `nil` if no rebuild is running. Only accessed from the indexer's queue.
+             */
+            var rebuildingGeneration: Int64?
+
+            init(url: URL, storeIdentifier: String, tables: [Table]) throws {
+
+                var handle: OpaquePointer?
+                let resultCode = sqlite3_open_v2(
+                    url.path,
+                    &handle,
+                    SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX,
+                    nil
+                )
+                guard resultCode == SQLITE_OK, let openedHandle = handle else {
+
+                    sqlite3_close(handle)
+                    throw Database.error(code: resultCode, handle: nil)
+                }
+                self.handle = openedHandle
+                self.storeIdentifier = storeIdentifier
+                self.tablesByEntityName = Dictionary(tables.map({ ($0.entityName, $0) }), uniquingKeysWith: { $1 })
+                sqlite3_busy_timeout(openedHandle, 5_000)
+                try self.execute("CREATE TABLE IF NOT EXISTS ZCSFTS_METADATA (ZENTITY TEXT PRIMARY KEY, ZSTOREIDENTIFIER TEXT, ZSIGNATURE TEXT)")
+                try self.execute("CREATE TABLE IF NOT EXISTS ZCSFTS_GENERATION (ZSTOREIDENTIFIER TEXT PRIMARY KEY, ZGENERATION INTEGER)")
+            }
+
+            deinit {
+
+                sqlite3_close(self.handle)
+            }
+
+            func table(for entityDescription: NSEntityDescription) -> Table? {
+
+                return FullTextIndexer.table(for: entityDescription, in: self.tablesByEntityName)
+            }
+
+            /**
+             The store generation that the index was last updated to, or `nil` if none was recorded for the current store.
+             */
+            func generation() throws -> Int64? {
+
+                let statement = try self.prepare("SELECT ZGENERATION FROM ZCSFTS_GENERATION WHERE ZSTOREIDENTIFIER = ?")
+                defer {
+
+                    sqlite3_finalize(statement)
+                }
+                try self.bind(self.storeIdentifier, at: 1, in: statement)
+                guard sqlite3_step(statement) == SQLITE_ROW else {
+
+                    return nil
+                }
+                return sqlite3_column_int64(statement, 0)
+            }
+
+            /**
+             Creates the table if needed. Returns `true` if the table needs to be rebuilt from the store, because it is new, its key paths changed, the store file was replaced, or `isStale` is `true`.
+             */
+            func prepareTable(_ table: Table, isStale: Bool) throws -> Bool {
+
+                let statement = try self.prepare("SELECT ZSTOREIDENTIFIER, ZSIGNATURE FROM ZCSFTS_METADATA WHERE ZENTITY = ?")
+                defer {
+
+                    sqlite3_finalize(statement)
+                }
+                try self.bind(table.entityName, at: 1, in: statement)
+                if !isStale,
+                    sqlite3_step(statement) == SQLITE_ROW,
+                    Database.string(at: 0, in: statement) == self.storeIdentifier,
+                    Database.string(at: 1, in: statement) == table.signature {
+
+                    return false
+                }
+                let columns = table.keyPaths.map({ Database.quoted($0) }).joined(separator: ", ")
+                try self.execute("BEGIN IMMEDIATE")
+                do {
+
+                    try self.execute("DROP TABLE IF EXISTS \(Database.quoted(table.name))")
+                    try self.execute("CREATE VIRTUAL TABLE \(Database.quoted(table.name)) USING fts5(ZENTITY UNINDEXED, \(columns), tokenize = 'unicode61 remove_diacritics 2')")
+
+                    let updateStatement = try self.prepare("INSERT OR REPLACE INTO ZCSFTS_METADATA (ZENTITY, ZSTOREIDENTIFIER, ZSIGNATURE) VALUES (?, ?, ?)")
+                    defer {
+
+                        sqlite3_finalize(updateStatement)
+                    }
+                    try self.bind(table.entityName, at: 1, in: updateStatement)
+                    try self.bind(self.storeIdentifier, at: 2, in: updateStatement)
+                    try self.bind(table.signature, at: 3, in: updateStatement)
+                    try self.step(updateStatement)
+                    try self.execute("COMMIT")
+                }
+                catch {
+
+                    try? self.execute("ROLLBACK")
+                    throw error
+                }
+                return true
+            }
+
+            /**
+             Replaces the rows for objects with their new values, or deletes them if `values` is `nil`. If `generation` is not `nil`, it is recorded in the same transaction.
+             */
+            func write(_ rows: [(table: Table, primaryKey: Int64, entityName: EntityName, values: [String?]?)], generation: Int64?) throws {
+
+                guard !rows.isEmpty || generation != nil else {
+
+                    return
+                }
+                try self.execute("BEGIN IMMEDIATE")
+                do {
+
+                    do {
+
+                        // Prepared once per table and reset for each row, then finalized before the transaction ends
+                        var statementsByTableName: [String: (delete: OpaquePointer, insert: OpaquePointer)] = [:]
+                        defer {
+
+                            for (deleteStatement, insertStatement) in statementsByTableName.values {
+
+                                sqlite3_finalize(deleteStatement)
+                                sqlite3_finalize(insertStatement)
+                            }
+                        }
+                        for (table, primaryKey, entityName, values) in rows {
+
+                            let statements: (delete: OpaquePointer, insert: OpaquePointer)
+                            if let preparedStatements = statementsByTableName[table.name] {
+
+                                statements = preparedStatements
+                            }
+                            else {
+
+                                statements = try self.prepareWriteStatements(for: table)
+                                statementsByTableName[table.name] = statements
+                            }
+                            sqlite3_reset(statements.delete)
+                            sqlite3_bind_int64(statements.delete, 1, primaryKey)
+                            try self.step(statements.delete)
+
+                            guard let values = values else {
+
+                                continue
+                            }
+                            sqlite3_reset(statements.insert)
+                            sqlite3_clear_bindings(statements.insert)
+                            sqlite3_bind_int64(statements.insert, 1, primaryKey)
+                            try self.bind(entityName, at: 2, in: statements.insert)
+                            for (index, value) in values.enumerated() {
+
+                                try self.bind(value, at: Int32(index + 3), in: statements.insert)
+                            }
+                            try self.step(statements.insert)
+                        }
+                    }
+                    if let generation = generation {
+
+                        let generationStatement = try self.prepare("INSERT OR REPLACE INTO ZCSFTS_GENERATION (ZSTOREIDENTIFIER, ZGENERATION) VALUES (?, ?)")
+                        defer {
+
+                            sqlite3_finalize(generationStatement)
+                        }
+                        try self.bind(self.storeIdentifier, at: 1, in: generationStatement)
+                        sqlite3_bind_int64(generationStatement, 2, generation)
+                        try self.step(generationStatement)
+                    }
+                    try self.execute("COMMIT")
+                }
+                catch {
+
+                    try? self.execute("ROLLBACK")
+                    throw error
+                }
+            }
+
+            /**
+             Returns the best matches among the rows of the `entityNames`. The entities are filtered before the `limit` is applied, so rows of other subentities in the same table don't take up the results.
+             */
+            func search(_ table: Table, matching matchExpression: String, entityNames: Set<EntityName>, limit: Int) throws -> [(entityName: EntityName, primaryKey: Int64, score: Double)] {
+
+                let tableName = Database.quoted(table.name)
+                let entityNames = Array(entityNames)
+                let entityPlaceholders = Array(repeating: "?", count: entityNames.count).joined(separator: ", ")
+                let statement = try self.prepare("SELECT ZENTITY, rowid, bm25(\(tableName)) FROM \(tableName) WHERE \(tableName) MATCH ? AND ZENTITY IN (\(entityPlaceholders)) ORDER BY bm25(\(tableName)) LIMIT ?")
+                defer {
+
+                    sqlite3_finalize(statement)
+                }
+                try self.bind(matchExpression, at: 1, in: statement)
+                for (index, entityName) in entityNames.enumerated() {
+
+                    try self.bind(entityName, at: Int32(index + 2), in: statement)
+                }
+                sqlite3_bind_int64(statement, Int32(entityNames.count + 2), Int64(limit))
+
+                var results: [(entityName: EntityName, primaryKey: Int64, score: Double)] = []
+                while true {
+
+                    switch sqlite3_step(statement) {
+
+                    case SQLITE_ROW:
+                        results.append(
+                            (
+                                Database.string(at: 0, in: statement) ?? "",
+                                sqlite3_column_int64(statement, 1),
+                                sqlite3_column_double(statement, 2)
+                            )
+                        )
+
+                    case SQLITE_DONE:
+                        return results
+
+                    case let resultCode:
+                        throw Database.error(code: resultCode, handle: self.handle)
+                    }
+                }
+            }
+
+
+            // MARK: Private
+
+            private static let transient = unsafeBitCast(-1, to: sqlite3_destructor_type.self)
+
+            private let tablesByEntityName: [EntityName: Table]
+            private let storeIdentifier: String
+
+            private static func quoted(_ identifier: String) -> String {
+
+                return "\"\(identifier.replacingOccurrences(of: "\"", with: "\"\""))\""
+            }
+
+            private static func string(at column: Int32, in statement: OpaquePointer) -> String? {
+
+                return sqlite3_column_text(statement, column).map({ String(cString: $0) })
+            }
+
+            private static func error(code: Int32, handle: OpaquePointer?) -> CoreStoreError {
+
+                let message = handle.flatMap({ sqlite3_errmsg($0) }).map({ String(cString: $0) })
+                    ?? String(cString: sqlite3_errstr(code))
+                return .internalError(
+                    NSError: NSError(
+                        domain: NSSQLiteErrorDomain,
+                        code: Int(code),
+                        userInfo: [NSLocalizedDescriptionKey: message]
+                    )
+                )
+            }
+
+            private func execute(_ sql: String) throws {
+
+                let resultCode = sqlite3_exec(self.handle, sql, nil, nil, nil)
+                guard resultCode == SQLITE_OK else {
+
+                    throw Database.error(code: resultCode, handle: self.handle)
+                }
+            }
+
+            private func prepare(_ sql: String) throws -> OpaquePointer {
+
+                var statement: OpaquePointer?
+                let resultCode = sqlite3_prepare_v2(self.handle, sql, -1, &statement, nil)
+                guard resultCode == SQLITE_OK, let preparedStatement = statement else {
+
+                    sqlite3_finalize(statement)
+                    throw Database.error(code: resultCode, handle: self.handle)
+                }
+                return preparedStatement
+            }
+
+            private func prepareWriteStatements(for table: Table) throws -> (delete: OpaquePointer, insert: OpaquePointer) {
+
+                let deleteStatement = try self.prepare("DELETE FROM \(Database.quoted(table.name)) WHERE rowid = ?")
+                do {
+
+                    let columns = table.keyPaths.map({ Database.quoted($0) }).joined(separator: ", ")
+                    let placeholders = Array(repeating: "?", count: table.keyPaths.count).joined(separator: ", ")
+                    let insertStatement = try self.prepare("INSERT INTO \(Database.quoted(table.name)) (rowid, ZENTITY, \(columns)) VALUES (?, ?, \(placeholders))")
+                    return (deleteStatement, insertStatement)
+                }
+                catch {
+
+                    sqlite3_finalize(deleteStatement)
+                    throw error
+                }
+            }
+
+            private func bind(_ value: String?, at index: Int32, in statement: OpaquePointer) throws {
+
+                let resultCode = value.map({ sqlite3_bind_text(statement, index, $0, -1, Database.transient) })
+                    ?? sqlite3_bind_null(statement, index)
+                guard resultCode == SQLITE_OK else {
+
+                    throw Database.error(code: resultCode, handle: self.handle)
+                }
+            }
+
+            private func step(_ statement: OpaquePointer) throws {
+
+                let resultCode = sqlite3_step(statement)
+                guard resultCode == SQLITE_DONE else {
+
+                    throw Database.error(code: resultCode, handle: self.handle)
+                }
+            }
+        }
+    }
+}
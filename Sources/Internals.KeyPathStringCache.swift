@@ -0,0 +1,128 @@
+//
+//  Internals.KeyPathStringCache.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: Internal
+
+    /**
+     Returns the `KeyPathString` for a `CoreStoreObject` field's key path. The first lookup reads the field's `keyPath` from the type's meta object, and later lookups are served from the shared `KeyPathStringCache`.
+     */
+    internal static func keyPathString<O: CoreStoreObject, K: AnyKeyPathStringConvertible>(_ keyPath: KeyPath<O, K>) -> KeyPathString {
+
+        return KeyPathStringCache.shared.keyPathString(for: keyPath) {
+
+            return O.meta[keyPath: keyPath].cs_keyPathString
+        }
+    }
+
+    /**
+     Returns the `KeyPathString` for an Objective-C key path, such as an `@objc` property of an `NSManagedObject`. The first lookup asks the key path for its KVC string, and later lookups are served from the shared `KeyPathStringCache`.
+     */
+    internal static func kvcKeyPathString(_ keyPath: AnyKeyPath) -> KeyPathString {
+
+        return KeyPathStringCache.shared.keyPathString(for: keyPath) {
+
+            return keyPath._kvcKeyPathString!
+        }
+    }
+
+    /**
+     Returns the dot-separated `KeyPathString` for two chained key paths, such as those connected by the `~` operator. `resolve` is only called the first time the pair is looked up.
+     */
+    internal static func keyPathString(chaining lhs: AnyKeyPath, _ rhs: AnyKeyPath, _ resolve: () -> KeyPathString) -> KeyPathString {
+
+        return KeyPathStringCache.shared.keyPathString(for: .init(lhs: lhs, rhs: rhs), resolve)
+    }
+
+
+    // MARK: - KeyPathStringCache
+
+    /**
+     A thread-safe, process-wide cache of the `KeyPathString`s that typed clauses resolve from Swift key paths. Entries are never evicted, since an app only ever declares a finite set of key paths.
+     */
+    internal final class KeyPathStringCache {
+
+        // MARK: Internal
+
+        internal static let shared = KeyPathStringCache()
+
+        internal func keyPathString(for keyPath: AnyKeyPath, _ resolve: () -> KeyPathString) -> KeyPathString {
+
+            self.lock.lock()
+            let cachedKeyPathString = self.keyPathStrings[keyPath]
+            self.lock.unlock()
+            if let cachedKeyPathString = cachedKeyPathString {
+
+                return cachedKeyPathString
+            }
+            let keyPathString = resolve()
+            self.lock.lock()
+            self.keyPathStrings[keyPath] = keyPathString
+            self.lock.unlock()
+            return keyPathString
+        }
+
+        internal func keyPathString(for chain: Chain, _ resolve: () -> KeyPathString) -> KeyPathString {
+
+            self.lock.lock()
+            let cachedKeyPathString = self.chainedKeyPathStrings[chain]
+            self.lock.unlock()
+            if let cachedKeyPathString = cachedKeyPathString {
+
+                return cachedKeyPathString
+            }
+            let keyPathString = resolve()
+            self.lock.lock()
+            self.chainedKeyPathStrings[chain] = keyPathString
+            self.lock.unlock()
+            return keyPathString
+        }
+
+
+        // MARK: - Chain
+
+        internal struct Chain: Hashable {
+
+            // MARK: Internal
+
+            internal let lhs: AnyKeyPath
+            internal let rhs: AnyKeyPath
+        }
+
+
+        // MARK: Private
+
+        private let lock = NSLock()
+        private var keyPathStrings: [AnyKeyPath: KeyPathString] = [:]
+        private var chainedKeyPathStrings: [Chain: KeyPathString] = [:]
+    }
+}
@@ -47,6 +47,11 @@ extension Internals {
             self.initializer = { fatalError() }
         }
 
+        var isInitialized: Bool {
+
+            return self.initializedValue != nil
+        }
+
         func initialize(_ initializer: @escaping () -> Value) {
 
             self.initializer = initializer
@@ -0,0 +1,119 @@
+//
+//  Internals.LiveObjectRegistry.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - LiveObjectRegistry
+
+    /**
+     Debug counters for the publisher and snapshot types, enabled through `CoreStoreDefaults.tracksLiveObjects`. Tracked instances hold a `Token` that increments its `Kind`'s counter when created and decrements it when released. Value types share the `Token` between copies, so counts reflect distinct snapshots rather than copies.
+     */
+    internal enum LiveObjectRegistry {
+
+        // MARK: Internal
+
+        internal static var isEnabled: Bool {
+
+            get {
+
+                return self.queue.sync { self.enabled }
+            }
+            set {
+
+                self.queue.sync { self.enabled = newValue }
+            }
+        }
+
+        internal static func track(_ kind: Kind) -> Token? {
+
+            // Unsynchronized read so that untracked instances don't pay for the queue hop
+            guard self.enabled else {
+
+                return nil
+            }
+            return Token(kind)
+        }
+
+        internal static func count(of kind: Kind) -> Int {
+
+            return self.queue.sync { self.counts[kind] ?? 0 }
+        }
+
+
+        // MARK: - Kind
+
+        internal enum Kind: Hashable {
+
+            case objectPublisher
+            case objectSnapshot
+            case listPublisher
+            case listSnapshot
+        }
+
+
+        // MARK: - Token
+
+        internal final class Token {
+
+            // MARK: Internal
+
+            internal let kind: Kind
+
+            deinit {
+
+                let kind = self.kind
+                LiveObjectRegistry.queue.async {
+
+                    LiveObjectRegistry.counts[kind, default: 0] -= 1
+                }
+            }
+
+
+            // MARK: FilePrivate
+
+            fileprivate init(_ kind: Kind) {
+
+                self.kind = kind
+                LiveObjectRegistry.queue.async {
+
+                    LiveObjectRegistry.counts[kind, default: 0] += 1
+                }
+            }
+        }
+
+
+        // MARK: Private
+
+        private static let queue: DispatchQueue = .serial("com.coreStore.liveObjectRegistry", qos: .utility)
+
+        private static var enabled: Bool = false
+        private static var counts: [Kind: Int] = [:]
+    }
+}
@@ -0,0 +1,306 @@
+//
+//  Internals.MembershipChunker.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - MembershipChunker
+
+    /**
+     Splits a predicate that tests membership in a long list of values, such as those created by `Where(_:isMemberOf:)`, into predicates that each test membership in a slice of the list. Only `IN` comparisons that are reachable through `AND`s and that test a single-valued key path are split, so every object matches at most one of the resulting predicates.
+     */
+    internal struct MembershipChunker {
+
+        // MARK: Internal
+
+        internal let predicates: [NSPredicate]
+
+        internal init?(predicate: NSPredicate?, entity: NSEntityDescription?, maximumListCount: Int) {
+
+            guard let predicate = predicate,
+                let entity = entity,
+                let membershipTest = Self.largeMembershipTest(
+                    in: predicate,
+                    entity: entity,
+                    maximumListCount: maximumListCount
+                ) else {
+
+                return nil
+            }
+            let values = membershipTest.values
+            self.predicates = stride(from: 0, to: values.count, by: maximumListCount).map { (startIndex) in
+
+                let chunk = Array(values[startIndex ..< Swift.min(startIndex + maximumListCount, values.count)])
+                return Self.predicate(predicate, replacing: membershipTest.predicate, with: chunk)
+            }
+        }
+
+
+        // MARK: Private
+
+        private static func largeMembershipTest(in predicate: NSPredicate, entity: NSEntityDescription, maximumListCount: Int) -> (predicate: NSComparisonPredicate, values: [Any])? {
+
+            switch predicate {
+
+            case let predicate as NSCompoundPredicate:
+                guard predicate.compoundPredicateType == .and else {
+
+                    return nil
+                }
+                return predicate.subpredicates
+                    .lazy
+                    .compactMap({ $0 as? NSPredicate })
+                    .compactMap({ self.largeMembershipTest(in: $0, entity: entity, maximumListCount: maximumListCount) })
+                    .first
+
+            case let predicate as NSComparisonPredicate:
+                // Options like [c] can make values in different chunks match the same object
+                guard predicate.predicateOperatorType == .in,
+                    predicate.comparisonPredicateModifier == .direct,
+                    predicate.options.isEmpty,
+                    predicate.rightExpression.expressionType == .constantValue,
+                    self.isSingleValued(predicate.leftExpression, in: entity) else {
+
+                    return nil
+                }
+                let values: NSOrderedSet
+                switch predicate.rightExpression.constantValue {
+
+                case let array as NSArray:
+                    values = NSOrderedSet(array: array.map({ $0 }))
+
+                case let set as NSSet:
+                    values = NSOrderedSet(array: set.allObjects)
+
+                case let orderedSet as NSOrderedSet:
+                    values = NSOrderedSet(array: orderedSet.array)
+
+                default:
+                    return nil
+                }
+                guard values.count > maximumListCount else {
+
+                    return nil
+                }
+                return (predicate, values.array)
+
+            default:
+                return nil
+            }
+        }
+
+        private static func isSingleValued(_ expression: NSExpression, in entity: NSEntityDescription) -> Bool {
+
+            switch expression.expressionType {
+
+            case .evaluatedObject:
+                return true
+
+            case .keyPath:
+                switch entity.propertiesByName[expression.keyPath] {
+
+                case is NSAttributeDescription:
+                    return true
+
+                case let relationship as NSRelationshipDescription:
+                    return !relationship.isToMany
+
+                default:
+                    return expression.keyPath == "SELF"
+                }
+
+            default:
+                return false
+            }
+        }
+
+        private static func predicate(_ predicate: NSPredicate, replacing membershipTest: NSComparisonPredicate, with values: [Any]) -> NSPredicate {
+
+            switch predicate {
+
+            case let predicate as NSComparisonPredicate where predicate === membershipTest:
+                return NSComparisonPredicate(
+                    leftExpression: predicate.leftExpression,
+                    rightExpression: NSExpression(forConstantValue: values),
+                    modifier: .direct,
+                    type: .in,
+                    options: predicate.options
+                )
+
+            case let predicate as NSCompoundPredicate where predicate.compoundPredicateType == .and:
+                return NSCompoundPredicate(
+                    andPredicateWithSubpredicates: predicate.subpredicates
+                        .compactMap({ $0 as? NSPredicate })
+                        .map({ self.predicate($0, replacing: membershipTest, with: values) })
+                )
+
+            default:
+                return predicate
+            }
+        }
+    }
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    /**
+     Fetches objects with one fetch per slice of the membership list if the request's predicate tests membership in more than `CoreStoreDefaults.maximumMembershipListCount` values. Results are merged in memory, honoring the request's sort descriptors, fetch offset, and fetch limit. Returns `nil` if the request should be executed as is. Needs to be called from the context's queue.
+     */
+    @nonobjc
+    internal func fetchInMembershipChunks<O: NSManagedObject>(_ fetchRequest: Internals.CoreStoreFetchRequest<O>) throws -> [O]? {
+
+        let fetchLimit = fetchRequest.fetchLimit
+        let fetchOffset = fetchRequest.fetchOffset
+        let sortDescriptors = fetchRequest.sortDescriptors ?? []
+        return try self.withMembershipChunks(of: fetchRequest) { (predicates) in
+
+            // Each slice needs enough results to cover the requested page after merging
+            fetchRequest.fetchLimit = fetchLimit > 0 ? fetchLimit + fetchOffset : 0
+            fetchRequest.fetchOffset = 0
+
+            var fetchResults: [O] = []
+            for predicate in predicates {
+
+                fetchRequest.predicate = predicate
+                fetchResults.append(contentsOf: try self.fetch(fetchRequest.staticCast()))
+                if sortDescriptors.isEmpty && fetchLimit > 0 && fetchResults.count >= fetchLimit + fetchOffset {
+
+                    break
+                }
+            }
+            if predicates.count > 1 && !sortDescriptors.isEmpty {
+
+                fetchResults = (fetchResults as NSArray).sortedArray(using: sortDescriptors) as! [O]
+            }
+            let page = fetchResults.dropFirst(fetchOffset)
+            return Array(fetchLimit > 0 ? page.prefix(fetchLimit) : page)
+        }
+    }
+
+    /**
+     Fetches object IDs with one fetch per slice of the membership list if the request's predicate tests membership in more than `CoreStoreDefaults.maximumMembershipListCount` values. Returns `nil` if the request should be executed as is. Needs to be called from the context's queue.
+     */
+    @nonobjc
+    internal func fetchObjectIDsInMembershipChunks(_ fetchRequest: Internals.CoreStoreFetchRequest<NSManagedObjectID>) throws -> [NSManagedObjectID]? {
+
+        guard fetchRequest.sortDescriptors?.isEmpty ?? true else {
+
+            // Object IDs can't be sorted in memory, so fetch the (mostly cached) objects instead
+            let objectsRequest = Internals.CoreStoreFetchRequest<NSManagedObject>()
+            objectsRequest.entity = fetchRequest.entity
+            objectsRequest.predicate = fetchRequest.predicate
+            objectsRequest.sortDescriptors = fetchRequest.sortDescriptors
+            objectsRequest.affectedStores = fetchRequest.safeAffectedStores()
+            objectsRequest.fetchLimit = fetchRequest.fetchLimit
+            objectsRequest.fetchOffset = fetchRequest.fetchOffset
+            objectsRequest.includesSubentities = fetchRequest.includesSubentities
+            objectsRequest.includesPendingChanges = fetchRequest.includesPendingChanges
+            objectsRequest.resultType = .managedObjectResultType
+            return try self
+                .fetchInMembershipChunks(objectsRequest)?
+                .map({ $0.objectID })
+        }
+        let fetchLimit = fetchRequest.fetchLimit
+        let fetchOffset = fetchRequest.fetchOffset
+        return try self.withMembershipChunks(of: fetchRequest) { (predicates) in
+
+            fetchRequest.fetchLimit = fetchLimit > 0 ? fetchLimit + fetchOffset : 0
+            fetchRequest.fetchOffset = 0
+
+            var fetchResults: [NSManagedObjectID] = []
+            for predicate in predicates {
+
+                fetchRequest.predicate = predicate
+                fetchResults.append(contentsOf: try self.fetch(fetchRequest.staticCast()))
+                if fetchLimit > 0 && fetchResults.count >= fetchLimit + fetchOffset {
+
+                    break
+                }
+            }
+            let page = fetchResults.dropFirst(fetchOffset)
+            return Array(fetchLimit > 0 ? page.prefix(fetchLimit) : page)
+        }
+    }
+
+    /**
+     Counts objects with one count per slice of the membership list if the request's predicate tests membership in more than `CoreStoreDefaults.maximumMembershipListCount` values. Returns `nil` if the request should be executed as is. Needs to be called from the context's queue.
+     */
+    @nonobjc
+    internal func countInMembershipChunks(_ fetchRequest: Internals.CoreStoreFetchRequest<NSNumber>) throws -> Int? {
+
+        let fetchLimit = fetchRequest.fetchLimit
+        let fetchOffset = fetchRequest.fetchOffset
+        return try self.withMembershipChunks(of: fetchRequest) { (predicates) in
+
+            fetchRequest.fetchLimit = 0
+            fetchRequest.fetchOffset = 0
+
+            var count = 0
+            for predicate in predicates {
+
+                fetchRequest.predicate = predicate
+                count += try self.count(for: fetchRequest.staticCast())
+            }
+            count = Swift.max(0, count - fetchOffset)
+            return fetchLimit > 0 ? Swift.min(count, fetchLimit) : count
+        }
+    }
+
+
+    // MARK: Private
+
+    @nonobjc
+    private func withMembershipChunks<T, R>(of fetchRequest: Internals.CoreStoreFetchRequest<T>, _ body: (_ predicates: [NSPredicate]) throws -> R) rethrows -> R? {
+
+        guard let chunker = Internals.MembershipChunker(
+            predicate: fetchRequest.predicate,
+            entity: fetchRequest.entity,
+            maximumListCount: Swift.max(1, CoreStoreDefaults.maximumMembershipListCount)
+        ) else {
+
+            return nil
+        }
+        let predicate = fetchRequest.predicate
+        let fetchLimit = fetchRequest.fetchLimit
+        let fetchOffset = fetchRequest.fetchOffset
+        defer {
+
+            fetchRequest.predicate = predicate
+            fetchRequest.fetchLimit = fetchLimit
+            fetchRequest.fetchOffset = fetchOffset
+        }
+        return try body(chunker.predicates)
+    }
+}
@@ -0,0 +1,216 @@
+//
+//  Internals.MemoryPolicyMonitor.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - MemoryPolicyMonitor
+
+    /**
+     Applies a `DataStack`'s `MemoryPolicy`. Registered object counts are checked at most once per pass of each context's queue, after objects are fetched or merged into the context, and the system's memory pressure events are forwarded to `purge(_:)` while the policy observes them.
+     */
+    internal final class MemoryPolicyMonitor {
+
+        // MARK: Internal
+
+        internal weak var parentStack: DataStack?
+
+        internal var policy: DataStack.MemoryPolicy? {
+
+            get {
+
+                self.lock.lock()
+                defer {
+
+                    self.lock.unlock()
+                }
+                return self.currentPolicy
+            }
+            set {
+
+                self.lock.lock()
+                self.currentPolicy = newValue
+                self.lock.unlock()
+
+                self.observeSystemMemoryPressure(newValue?.observesSystemMemoryPressure == true)
+                if let dataStack = self.parentStack {
+
+                    self.setNeedsCheck(dataStack.mainContext)
+                    self.setNeedsCheck(dataStack.rootSavingContext)
+                }
+            }
+        }
+
+        deinit {
+
+            self.pressureSource?.cancel()
+        }
+
+        internal func setNeedsCheck(_ context: NSManagedObjectContext) {
+
+            let contextIdentifier = ObjectIdentifier(context)
+            self.lock.lock()
+            guard self.currentPolicy?.maximumRegisteredObjects != nil,
+                self.pendingContexts.insert(contextIdentifier).inserted else {
+
+                self.lock.unlock()
+                return
+            }
+            self.lock.unlock()
+
+            context.perform { [weak self, weak context] in
+
+                guard let self = self, let context = context else {
+
+                    return
+                }
+                self.lock.lock()
+                self.pendingContexts.remove(contextIdentifier)
+                let maximumRegisteredObjects = self.currentPolicy?.maximumRegisteredObjects
+                self.lock.unlock()
+
+                guard let maximum = maximumRegisteredObjects,
+                    context.registeredObjects.count > maximum else {
+
+                    return
+                }
+                context.refreshUnobservedObjects()
+            }
+        }
+
+        internal func purge(_ pressure: DataStack.MemoryPressure) {
+
+            guard let dataStack = self.parentStack else {
+
+                return
+            }
+            let mainContext = dataStack.mainContext
+            mainContext.performAndWait {
+
+                _ = mainContext.purgeUnobservedObjectPublisherSnapshots()
+                mainContext.refreshUnobservedObjects()
+            }
+            switch pressure {
+
+            case .warning:
+                return
+
+            case .critical:
+                let rootSavingContext = dataStack.rootSavingContext
+                rootSavingContext.perform {
+
+                    rootSavingContext.refreshUnobservedObjects()
+                }
+                dataStack.readerPool.invalidate()
+            }
+        }
+
+
+        // MARK: Private
+
+        private let lock = NSLock()
+        private var currentPolicy: DataStack.MemoryPolicy?
+        private var pendingContexts: Set<ObjectIdentifier> = []
+        private var pressureSource: DispatchSourceMemoryPressure?
+
+        private func observeSystemMemoryPressure(_ observes: Bool) {
+
+            guard observes != (self.pressureSource != nil) else {
+
+                return
+            }
+            guard observes else {
+
+                self.pressureSource?.cancel()
+                self.pressureSource = nil
+                return
+            }
+            let pressureSource = DispatchSource.makeMemoryPressureSource(
+                eventMask: [.warning, .critical],
+                queue: .main
+            )
+            pressureSource.setEventHandler { [weak self, weak pressureSource] in
+
+                guard let event = pressureSource?.data else {
+
+                    return
+                }
+                self?.purge(event.contains(.critical) ? .critical : .warning)
+            }
+            pressureSource.resume()
+            self.pressureSource = pressureSource
+        }
+    }
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    /**
+     Schedules a check of the registered object count against the `DataStack`'s `MemoryPolicy`. Only applies to the `DataStack`'s main context and root saving context.
+     */
+    @nonobjc
+    internal func setNeedsMemoryPolicyCheck() {
+
+        guard let parentStack = self.parentStack,
+            self === parentStack.mainContext || self === parentStack.rootSavingContext else {
+
+            return
+        }
+        parentStack.memoryPolicyMonitor.setNeedsCheck(self)
+    }
+
+    /**
+     Turns registered objects that have no unsaved changes and are not observed by an `ObjectPublisher`, `ListPublisher`, or `ListMonitor` back into faults. Must be called from the context's queue.
+     */
+    @nonobjc
+    @discardableResult
+    internal func refreshUnobservedObjects() -> Int {
+
+        let observedObjectIDs = self.observedObjectIDs()
+        var refreshedCount = 0
+        for object in self.registeredObjects {
+
+            guard !object.isFault,
+                !object.hasChanges,
+                !observedObjectIDs.contains(object.objectID) else {
+
+                continue
+            }
+            self.refresh(object, mergeChanges: false)
+            refreshedCount += 1
+        }
+        return refreshedCount
+    }
+}
@@ -0,0 +1,247 @@
+//
+//  Internals.ObjectPrefetcher.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+#if canImport(UIKit) || canImport(AppKit)
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - ObjectPrefetcher
+
+    /**
+     Warms objects for a `DiffableDataSource.BaseAdapter` before their cells are requested.
+     Object IDs are batched per entity into a single `SELF IN %@` fetch on a private-queue context attached directly to the `DataStack`'s coordinator. The fetched objects are retained so that the coordinator's row cache stays populated, which lets later fault fires from the main context resolve without a round trip to the store. The fetched values are then used to seed the main context's `ObjectPublisher`s so that their first `snapshot` access doesn't need to fire a fault at all.
+     At most `capacity` objects are kept warm at any time; older entries are released first.
+     */
+    internal final class ObjectPrefetcher<O: DynamicObject> {
+
+        // MARK: Internal
+
+        internal init(dataStack: DataStack) {
+
+            let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+            context.persistentStoreCoordinator = dataStack.coordinator
+            context.undoManager = nil
+            context.name = "com.coreStore.objectPrefetcher"
+
+            self.mainContext = dataStack.mainContext
+            self.prefetchContext = context
+
+            self.mainContext.objectsDidChangeObserver(for: self).addObserver(self) { [weak self] (updatedIDs, deletedIDs) in
+
+                // In-flight values may predate these changes, so don't seed publishers with them
+                self?.pendingIDs.subtract(updatedIDs)
+                self?.pendingIDs.subtract(deletedIDs)
+            }
+        }
+
+        deinit {
+
+            self.mainContext.objectsDidChangeObserver(for: self).removeObserver(self)
+
+            let prefetchContext = self.prefetchContext
+            let prefetchedObjects = self.prefetchedObjects
+            prefetchContext.perform {
+
+                prefetchedObjects.objectsByID.removeAll()
+                prefetchContext.reset()
+            }
+        }
+
+        internal var prefetchedObjectIDs: [NSManagedObjectID] {
+
+            return self.warmedOrder
+        }
+
+        internal func prefetch(_ objectIDs: [O.ObjectID], capacity: Int) {
+
+            Internals.assert(
+                Thread.isMainThread,
+                "Attempted to prefetch objects outside the main thread."
+            )
+            guard capacity > 0 else {
+
+                return
+            }
+            var objectIDsByEntity: [NSEntityDescription: [NSManagedObjectID]] = [:]
+            for objectID in objectIDs.suffix(capacity) {
+
+                guard !objectID.isTemporaryID,
+                    self.warmedPublishers[objectID] == nil,
+                    !self.pendingIDs.contains(objectID) else {
+
+                    continue
+                }
+                if let registeredObject = self.mainContext.registeredObject(for: objectID),
+                    !registeredObject.isFault {
+
+                    continue
+                }
+                self.pendingIDs.insert(objectID)
+                objectIDsByEntity[objectID.entity, default: []].append(objectID)
+            }
+            guard !objectIDsByEntity.isEmpty else {
+
+                return
+            }
+            let prefetchContext = self.prefetchContext
+            let prefetchedObjects = self.prefetchedObjects
+            prefetchContext.perform {
+
+                var prefetchedValues: [NSManagedObjectID: [String: Any]] = [:]
+                for (entity, objectIDs) in objectIDsByEntity {
+
+                    let fetchRequest = NSFetchRequest<NSManagedObject>()
+                    fetchRequest.entity = entity
+                    fetchRequest.predicate = NSPredicate(format: "SELF IN %@", objectIDs)
+                    fetchRequest.returnsObjectsAsFaults = false
+                    fetchRequest.includesPendingChanges = false
+                    fetchRequest.fetchBatchSize = 0
+                    do {
+
+                        for object in try prefetchContext.fetch(fetchRequest) {
+
+                            prefetchedObjects.objectsByID[object.objectID] = object
+                            prefetchedValues[object.objectID] = O.cs_snapshotDictionary(
+                                id: object.objectID,
+                                context: prefetchContext
+                            )
+                        }
+                    }
+                    catch {
+
+                        Internals.log(
+                            CoreStoreError(error),
+                            "Failed to prefetch \(objectIDs.count) \(Internals.typeName(O.self)) object(s)."
+                        )
+                    }
+                }
+                DispatchQueue.main.async { [weak self] in
+
+                    self?.seed(
+                        prefetchedValues,
+                        requestedIDs: objectIDsByEntity.values.joined(),
+                        capacity: capacity
+                    )
+                }
+            }
+        }
+
+        internal func cancelPrefetching(_ objectIDs: [O.ObjectID]) {
+
+            Internals.assert(
+                Thread.isMainThread,
+                "Attempted to cancel prefetching outside the main thread."
+            )
+            let objectIDs = Set(objectIDs)
+            self.pendingIDs.subtract(objectIDs)
+            self.release(objectIDs)
+        }
+
+
+        // MARK: Private
+
+        private let mainContext: NSManagedObjectContext
+        private let prefetchContext: NSManagedObjectContext
+
+        private var pendingIDs: Set<NSManagedObjectID> = []
+        private var warmedPublishers: [NSManagedObjectID: ObjectPublisher<O>] = [:]
+        private var warmedOrder: [NSManagedObjectID] = []
+
+        private let prefetchedObjects = PrefetchedObjects()
+
+        private func seed<S: Sequence>(_ prefetchedValues: [NSManagedObjectID: [String: Any]], requestedIDs: S, capacity: Int) where S.Element == NSManagedObjectID {
+
+            var skippedIDs: Set<NSManagedObjectID> = []
+            for objectID in requestedIDs {
+
+                guard self.pendingIDs.remove(objectID) != nil,
+                    let values = prefetchedValues[objectID] else {
+
+                    skippedIDs.insert(objectID)
+                    continue
+                }
+                if let registeredObject = self.mainContext.registeredObject(for: objectID),
+                    registeredObject.hasChanges {
+
+                    skippedIDs.insert(objectID)
+                    continue
+                }
+                let objectPublisher: ObjectPublisher<O> = self.mainContext.objectPublisher(objectID: objectID)
+                objectPublisher.prewarmSnapshot(values: values)
+
+                self.warmedPublishers[objectID] = objectPublisher
+                self.warmedOrder.append(objectID)
+            }
+            self.release(skippedIDs)
+            if self.warmedOrder.count > capacity {
+
+                let evictedIDs = self.warmedOrder.prefix(self.warmedOrder.count - capacity)
+                self.release(Set(evictedIDs))
+            }
+        }
+
+        private func release(_ objectIDs: Set<NSManagedObjectID>) {
+
+            guard !objectIDs.isEmpty else {
+
+                return
+            }
+            for objectID in objectIDs {
+
+                self.warmedPublishers[objectID] = nil
+            }
+            self.warmedOrder.removeAll(where: { objectIDs.contains($0) })
+            let prefetchedObjects = self.prefetchedObjects
+            self.prefetchContext.perform {
+
+                for objectID in objectIDs {
+
+                    prefetchedObjects.objectsByID[objectID] = nil
+                }
+            }
+        }
+
+
+        // MARK: - PrefetchedObjects
+
+        /**
+         The objects retained to keep the coordinator's row cache warm. Owned by the blocks enqueued on the `prefetchContext`, and only accessed from its queue.
+         */
+        private final class PrefetchedObjects {
+
+            // MARK: FilePrivate
+
+            fileprivate var objectsByID: [NSManagedObjectID: NSManagedObject] = [:]
+        }
+    }
+}
+
+#endif
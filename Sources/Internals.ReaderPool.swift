@@ -0,0 +1,349 @@
+//
+//  Internals.ReaderPool.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - ReaderPool
+
+    /**
+     A pool of read-only `NSPersistentStoreCoordinator`s, each with its own private-queue context, that open the same SQLite files as the `DataStack`'s coordinator. A single coordinator serializes every fetch, but in WAL mode SQLite can serve many readers in parallel with the writer, so background reads are spread across the pool instead. The `DataStack`'s own coordinator stays the only writer.
+     Readers are created lazily, up to `maximumReaderCount`, and are discarded whenever the `DataStack`'s stores change. Stacks with any non-SQLite store are not served by the pool since their data can't be opened from another coordinator.
+     */
+    internal final class ReaderPool {
+
+        // MARK: Internal
+
+        internal weak var parentStack: DataStack?
+
+        internal init(coordinator: NSPersistentStoreCoordinator, maximumReaderCount: Int) {
+
+            self.coordinator = coordinator
+            self.maximumCount = Swift.max(0, maximumReaderCount)
+        }
+
+        internal var maximumReaderCount: Int {
+
+            get {
+
+                self.condition.lock()
+                defer {
+
+                    self.condition.unlock()
+                }
+                return self.maximumCount
+            }
+            set {
+
+                self.condition.lock()
+                defer {
+
+                    self.condition.unlock()
+                }
+                self.maximumCount = Swift.max(0, newValue)
+                while self.idleReaders.count > 0 && self.readerCount > self.maximumCount {
+
+                    self.idleReaders.removeLast()
+                    self.readerCount -= 1
+                }
+                self.condition.broadcast()
+            }
+        }
+
+        internal var canRead: Bool {
+
+            guard self.maximumReaderCount > 0 else {
+
+                return false
+            }
+            let persistentStores = self.coordinator.persistentStores
+            return !persistentStores.isEmpty
+                && persistentStores.allSatisfy({ $0.type == NSSQLiteStoreType && $0.url != nil })
+        }
+
+        /**
+         Checks out a reader, blocking until one is available, and executes `body` on its context's queue. The context is reset afterwards, so `body` should only return values, `NSManagedObjectID`s, or snapshots. Returned `NSManagedObjectID`s belong to the reader's coordinator and should be passed through `importedObjectID(_:)` before use.
+         */
+        internal func read<T>(_ body: (NSManagedObjectContext) throws -> T) throws -> T {
+
+            let reader = try self.checkOut()
+            defer {
+
+                self.checkIn(reader)
+            }
+            let context = reader.context
+            var result: Result<T, Error>!
+            context.performAndWait {
+
+                result = Result(catching: { try body(context) })
+                context.reset()
+            }
+            return try result.get()
+        }
+
+        internal func invalidate() {
+
+            self.condition.lock()
+            defer {
+
+                self.condition.unlock()
+            }
+            self.generation += 1
+            self.readerCount -= self.idleReaders.count
+            self.idleReaders.removeAll()
+            self.condition.broadcast()
+        }
+
+        internal func importedObjectID(_ objectID: NSManagedObjectID) -> NSManagedObjectID? {
+
+            guard !objectID.isTemporaryID,
+                objectID.persistentStore?.persistentStoreCoordinator !== self.coordinator else {
+
+                return objectID
+            }
+            // Both coordinators opened the same files, so the store UUIDs in the URIs match
+            return self.coordinator.managedObjectID(forURIRepresentation: objectID.uriRepresentation())
+        }
+
+        internal func importedObjectIDs(_ objectIDs: [NSManagedObjectID]) -> [NSManagedObjectID] {
+
+            return objectIDs.compactMap(self.importedObjectID(_:))
+        }
+
+        internal func importedValue<T>(_ value: T?) -> T? {
+
+            switch value {
+
+            case let objectID as NSManagedObjectID:
+                return self.importedObjectID(objectID) as? T
+
+            case let objectIDs as [NSManagedObjectID]:
+                return self.importedObjectIDs(objectIDs) as? T
+
+            case let objectIDs as Set<NSManagedObjectID>:
+                return Set(self.importedObjectIDs(Array(objectIDs))) as? T
+
+            default:
+                return value
+            }
+        }
+
+        internal func importedAttributes(_ attributes: [[String: Any]]) -> [[String: Any]] {
+
+            return attributes.map { (dictionary) in
+
+                return dictionary.mapValues({ self.importedValue($0) ?? $0 })
+            }
+        }
+
+
+        // MARK: - Reader
+
+        internal final class Reader {
+
+            // MARK: Internal
+
+            internal let coordinator: NSPersistentStoreCoordinator
+            internal let context: NSManagedObjectContext
+            internal let generation: Int
+
+
+            // MARK: FilePrivate
+
+            fileprivate init(coordinator: NSPersistentStoreCoordinator, parentStack: DataStack?, generation: Int) {
+
+                let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+                context.persistentStoreCoordinator = coordinator
+                context.undoManager = nil
+                context.name = "com.coreStore.readerContext"
+                context.parentStack = parentStack
+
+                self.coordinator = coordinator
+                self.context = context
+                self.generation = generation
+            }
+        }
+
+
+        // MARK: Private
+
+        private let coordinator: NSPersistentStoreCoordinator
+        private let condition = NSCondition()
+
+        private var maximumCount: Int
+        private var readerCount: Int = 0
+        private var generation: Int = 0
+        private var idleReaders: [Reader] = []
+
+        private func checkOut() throws -> Reader {
+
+            self.condition.lock()
+            while self.idleReaders.isEmpty && self.readerCount >= Swift.max(1, self.maximumCount) {
+
+                self.condition.wait()
+            }
+            if let reader = self.idleReaders.popLast() {
+
+                self.condition.unlock()
+                return reader
+            }
+            self.readerCount += 1
+            let generation = self.generation
+            self.condition.unlock()
+
+            do {
+
+                return try self.makeReader(generation: generation)
+            }
+            catch {
+
+                self.condition.lock()
+                self.readerCount -= 1
+                self.condition.signal()
+                self.condition.unlock()
+                throw error
+            }
+        }
+
+        private func checkIn(_ reader: Reader) {
+
+            self.condition.lock()
+            defer {
+
+                self.condition.unlock()
+            }
+            if reader.generation == self.generation && self.readerCount <= self.maximumCount {
+
+                self.idleReaders.append(reader)
+            }
+            else {
+
+                self.readerCount -= 1
+            }
+            self.condition.signal()
+        }
+
+        private func makeReader(generation: Int) throws -> Reader {
+
+            let readerCoordinator = NSPersistentStoreCoordinator(
+                managedObjectModel: self.coordinator.managedObjectModel
+            )
+            let persistentStores = self.coordinator.persistentStores
+            for persistentStore in persistentStores {
+
+                guard persistentStore.type == NSSQLiteStoreType,
+                    let fileURL = persistentStore.url else {
+
+                    Internals.log(
+                        .warning,
+                        message: "Attempted to open a read-only reader for a \"\(persistentStore.type)\" store. Only SQLite stores can be shared with readers."
+                    )
+                    throw CoreStoreError.unknown
+                }
+                var options = persistentStore.options ?? [:]
+                options[NSReadOnlyPersistentStoreOption] = true
+                options[NSMigratePersistentStoresAutomaticallyOption] = nil
+                options[NSInferMappingModelAutomaticallyOption] = nil
+
+                let configurationName = persistentStore.configurationName
+                do {
+
+                    try readerCoordinator.addPersistentStore(
+                        ofType: NSSQLiteStoreType,
+                        configurationName: configurationName == DataStack.defaultConfigurationName
+                            ? nil
+                            : configurationName,
+                        at: fileURL,
+                        options: options
+                    )
+                }
+                catch {
+
+                    let storeError = CoreStoreError(error)
+                    Internals.log(
+                        storeError,
+                        "Failed to open a read-only reader for the store at \"\(fileURL)\"."
+                    )
+                    throw storeError
+                }
+            }
+            return Reader(
+                coordinator: readerCoordinator,
+                parentStack: self.parentStack,
+                generation: generation
+            )
+        }
+    }
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    /**
+     Returns the `NSManagedObjectID` in this context's coordinator for an `objectID` that may belong to another coordinator opened on the same files.
+     */
+    @nonobjc
+    internal func objectIDInCoordinator(_ objectID: NSManagedObjectID) -> NSManagedObjectID? {
+
+        guard let coordinator = self.persistentStoreCoordinator,
+            !objectID.isTemporaryID,
+            objectID.persistentStore?.persistentStoreCoordinator !== coordinator else {
+
+            return objectID
+        }
+        return coordinator.managedObjectID(forURIRepresentation: objectID.uriRepresentation())
+    }
+
+    /**
+     Returns the persistent stores in this context's coordinator that correspond to `persistentStores`, which may belong to another coordinator opened on the same files (such as a `Internals.ReaderPool` reader's).
+     */
+    @nonobjc
+    internal func persistentStoresInCoordinator(_ persistentStores: [NSPersistentStore]) -> [NSPersistentStore] {
+
+        guard let coordinator = self.persistentStoreCoordinator,
+            persistentStores.contains(where: { $0.persistentStoreCoordinator !== coordinator }) else {
+
+            return persistentStores
+        }
+        let coordinatorStores = coordinator.persistentStores
+        return persistentStores.compactMap { (persistentStore) in
+
+            return coordinatorStores.first {
+
+                $0.url == persistentStore.url
+                    && $0.configurationName == persistentStore.configurationName
+            }
+        }
+    }
+}
@@ -0,0 +1,225 @@
+//
+//  Internals.ShardRouter.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - ShardRouter
+
+    /**
+     The type-erased routing of a `ShardedSQLiteStore`, registered to the `DataStack` for the sharded entity. Shards are looked up by their file URLs in a coordinator, so the router works with any `SQLiteStore` instance that was attached for the same file.
+     */
+    internal final class ShardRouter {
+
+        // MARK: Internal
+
+        internal let entityIdentifier: Internals.EntityIdentifier
+        internal let shardKey: KeyPathString
+
+        internal init<O>(_ shardedStore: ShardedSQLiteStore<O>) {
+
+            self.entityIdentifier = Internals.EntityIdentifier(O.self)
+            self.shardKey = shardedStore.shardKey
+            self.fileURLs = shardedStore.storages.map({ $0.fileURL })
+            self.shardIndex = shardedStore.index(forShardKeyValue:)
+        }
+
+        internal func persistentStore(forShardKeyValue shardKeyValue: Any?, in coordinator: NSPersistentStoreCoordinator) -> NSPersistentStore? {
+
+            return coordinator.persistentStore(for: self.fileURLs[self.shardIndex(shardKeyValue)])
+        }
+
+        internal func persistentStores(in coordinator: NSPersistentStoreCoordinator) -> [NSPersistentStore] {
+
+            return self.fileURLs.compactMap(coordinator.persistentStore(for:))
+        }
+
+        /**
+         Returns the shard key values that `predicate` restricts the shard key to, or `nil` if the predicate may match objects in any shard.
+         */
+        internal func pinnedShardKeyValues(in predicate: NSPredicate) -> [Any?]? {
+
+            switch predicate {
+
+            case let predicate as NSCompoundPredicate:
+                let subpredicates = predicate.subpredicates.compactMap({ $0 as? NSPredicate })
+                switch predicate.compoundPredicateType {
+
+                case .and:
+                    return subpredicates.lazy.compactMap(self.pinnedShardKeyValues(in:)).first
+
+                case .or:
+                    var values: [Any?] = []
+                    for subpredicate in subpredicates {
+
+                        guard let subpredicateValues = self.pinnedShardKeyValues(in: subpredicate) else {
+
+                            return nil
+                        }
+                        values.append(contentsOf: subpredicateValues)
+                    }
+                    return subpredicates.isEmpty ? nil : values
+
+                default:
+                    return nil
+                }
+
+            case let predicate as NSComparisonPredicate:
+                guard predicate.comparisonPredicateModifier == .direct,
+                    predicate.options.isEmpty else {
+
+                    return nil
+                }
+                let (keyExpression, valueExpression) = predicate.leftExpression.expressionType == .keyPath
+                    ? (predicate.leftExpression, predicate.rightExpression)
+                    : (predicate.rightExpression, predicate.leftExpression)
+                guard keyExpression.expressionType == .keyPath,
+                    keyExpression.keyPath == self.shardKey else {
+
+                    return nil
+                }
+                switch (predicate.predicateOperatorType, valueExpression.expressionType) {
+
+                case (.equalTo, .constantValue):
+                    return [valueExpression.constantValue]
+
+                case (.in, .constantValue) where keyExpression === predicate.leftExpression:
+                    switch valueExpression.constantValue {
+
+                    case let values as NSArray:
+                        return values.map({ $0 })
+
+                    case let values as NSSet:
+                        return values.map({ $0 })
+
+                    default:
+                        return nil
+                    }
+
+                case (.in, .aggregate) where keyExpression === predicate.leftExpression:
+                    guard let expressions = valueExpression.collection as? [NSExpression],
+                        expressions.allSatisfy({ $0.expressionType == .constantValue }) else {
+
+                        return nil
+                    }
+                    return expressions.map({ $0.constantValue })
+
+                default:
+                    return nil
+                }
+
+            default:
+                return nil
+            }
+        }
+
+
+        // MARK: Private
+
+        private let fileURLs: [URL]
+        private let shardIndex: (_ shardKeyValue: Any?) -> Int
+    }
+}
+
+
+// MARK: - NSManagedObjectContext
+
+extension NSManagedObjectContext {
+
+    // MARK: Internal
+
+    /**
+     Assigns objects inserted into sharded entities to the shard for their shard key value. Must be called before the context obtains permanent IDs for its inserted objects, because a permanent ID fixes the store an object is saved to. Objects that already have permanent IDs keep their store.
+     */
+    @nonobjc
+    internal func assignInsertedObjectsToShards() {
+
+        guard let parentStack = self.parentStack,
+            !self.insertedObjects.isEmpty else {
+
+            return
+        }
+        let shardRouters = parentStack.shardRouters()
+        guard !shardRouters.isEmpty else {
+
+            return
+        }
+        for object in self.insertedObjects {
+
+            guard object.objectID.isTemporaryID,
+                let shardRouter = shardRouters[Internals.EntityIdentifier(object.entity)],
+                let persistentStore = shardRouter.persistentStore(
+                    forShardKeyValue: object.value(forKey: shardRouter.shardKey),
+                    in: parentStack.coordinator
+                ),
+                object.objectID.persistentStore !== persistentStore else {
+
+                continue
+            }
+            self.assign(object, to: persistentStore)
+        }
+    }
+
+    /**
+     Narrows a fetch request's affected stores to the shards that its predicate pins the shard key to.
+     */
+    @nonobjc
+    internal func applyShardPinning<T>(to fetchRequest: Internals.CoreStoreFetchRequest<T>) {
+
+        guard let parentStack = self.parentStack,
+            case let shardRouters = parentStack.shardRouters(),
+            !shardRouters.isEmpty,
+            let predicate = fetchRequest.predicate,
+            let entity = fetchRequest.entity,
+            let affectedStores = fetchRequest.affectedStores,
+            let shardRouter = shardRouters[Internals.EntityIdentifier(entity)],
+            let shardKeyValues = shardRouter.pinnedShardKeyValues(in: predicate) else {
+
+            return
+        }
+        let coordinator = parentStack.coordinator
+        let shardStores = self.persistentStoresInCoordinator(
+            shardRouter.persistentStores(in: coordinator)
+        )
+        let pinnedStores = self.persistentStoresInCoordinator(
+            shardKeyValues.compactMap({ shardRouter.persistentStore(forShardKeyValue: $0, in: coordinator) })
+        )
+        let narrowedStores = affectedStores.filter { (store) in
+
+            return !shardStores.contains(where: { $0 === store })
+                || pinnedStores.contains(where: { $0 === store })
+        }
+        // An empty list of affected stores means all stores, so keep the request as is
+        if !narrowedStores.isEmpty {
+
+            fetchRequest.affectedStores = narrowedStores
+        }
+    }
+}
@@ -36,7 +36,7 @@ extension KeyPath: AnyKeyPathStringConvertible, KeyPathStringConvertible where R
     public var cs_keyPathString: String {
 
 //        return NSExpression(forKeyPath: self).keyPath // in case _kvcKeyPathString becomes private API
-        return self._kvcKeyPathString!
+        return Internals.kvcKeyPathString(self)
     }
 
 
@@ -37,7 +37,7 @@ import Foundation
  */
 public func == <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: value)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -48,7 +48,7 @@ public func == <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ key
  */
 public func != <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: value)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -59,7 +59,7 @@ public func != <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ key
  */
 public func ~= <O: NSManagedObject, V: QueryableAttributeType & Equatable, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, V>) -> Where<O> where S.Iterator.Element == V {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -73,7 +73,7 @@ public func ~= <O: NSManagedObject, V: QueryableAttributeType & Equatable, S: Se
  */
 public func == <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ keyPath: KeyPath<O, Optional<V>>, _ value: V?) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: value)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -84,7 +84,7 @@ public func == <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ key
  */
 public func != <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ keyPath: KeyPath<O, Optional<V>>, _ value: V?) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: value)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -95,7 +95,7 @@ public func != <O: NSManagedObject, V: QueryableAttributeType & Equatable>(_ key
  */
 public func ~= <O: NSManagedObject, V: QueryableAttributeType & Equatable, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, Optional<V>>) -> Where<O> where S.Iterator.Element == V {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -109,7 +109,7 @@ public func ~= <O: NSManagedObject, V: QueryableAttributeType & Equatable, S: Se
  */
 public func < <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K < %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThan, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -120,7 +120,7 @@ public func < <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ key
  */
 public func > <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K > %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThan, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -131,7 +131,7 @@ public func > <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ key
  */
 public func <= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K <= %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThanOrEqualTo, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -142,7 +142,7 @@ public func <= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ ke
  */
 public func >= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ keyPath: KeyPath<O, V>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K >= %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
 }
 
 
@@ -158,11 +158,11 @@ public func < <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ key
     
     if let value = value {
         
-        return Where<O>("%K < %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThan, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K < nil", keyPath._kvcKeyPathString!)
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThan, nil)
     }
 }
 
@@ -176,11 +176,11 @@ public func > <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ key
     
     if let value = value {
         
-        return Where<O>("%K > %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThan, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K > nil", keyPath._kvcKeyPathString!)
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThan, nil)
     }
 }
 
@@ -194,11 +194,11 @@ public func <= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ ke
     
     if let value = value {
         
-        return Where<O>("%K <= %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K <= nil", keyPath._kvcKeyPathString!)
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .lessThanOrEqualTo, nil)
     }
 }
 
@@ -212,11 +212,11 @@ public func >= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ ke
     
     if let value = value {
         
-        return Where<O>("%K >= %@", keyPath._kvcKeyPathString!, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K >= nil", keyPath._kvcKeyPathString!)
+        return Where<O>(Internals.kvcKeyPathString(keyPath), .greaterThanOrEqualTo, nil)
     }
 }
 
@@ -231,7 +231,7 @@ public func >= <O: NSManagedObject, V: QueryableAttributeType & Comparable>(_ ke
  */
 public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ object: D) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -242,7 +242,7 @@ public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>
  */
 public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ object: D) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -253,7 +253,7 @@ public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>
  */
 public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, D>) -> Where<O> where S.Iterator.Element == D {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 /**
@@ -264,7 +264,7 @@ public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence:
  */
 public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ objectID: NSManagedObjectID) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: objectID)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: objectID)
 }
 
 /**
@@ -275,7 +275,7 @@ public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>
  */
 public func == <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ object: O) -> Where<O> where O.ObjectType: NSManagedObject {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object.cs_id())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object.cs_id())
 }
 
 /**
@@ -286,7 +286,7 @@ public func == <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<
  */
 public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ objectID: NSManagedObjectID) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: objectID)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: objectID)
 }
 
 /**
@@ -297,7 +297,7 @@ public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, D>
  */
 public func != <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<O, D>, _ object: O) -> Where<O> where O.ObjectType: NSManagedObject {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object.cs_id())
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object.cs_id())
 }
 
 /**
@@ -308,7 +308,7 @@ public func != <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<
  */
 public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, D>) -> Where<O> where S.Iterator.Element == NSManagedObjectID {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -322,7 +322,7 @@ public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence:
  */
 public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ object: D?) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -333,7 +333,7 @@ public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Op
  */
 public func == <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ object: O?) -> Where<O> where O.ObjectType: NSManagedObject {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object?.cs_toRaw())
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object?.cs_toRaw())
 }
 
 /**
@@ -344,7 +344,7 @@ public func == <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<
  */
 public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ object: D?) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -355,7 +355,7 @@ public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Op
  */
 public func != <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ object: O?) -> Where<O> where O.ObjectType: NSManagedObject {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: object?.cs_toRaw())
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: object?.cs_toRaw())
 }
 
 /**
@@ -366,7 +366,7 @@ public func != <O: ObjectRepresentation, D: NSManagedObject>(_ keyPath: KeyPath<
  */
 public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, Optional<D>>) -> Where<O> where S.Iterator.Element == D {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 /**
@@ -377,7 +377,7 @@ public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence:
  */
 public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ objectID: NSManagedObjectID) -> Where<O> {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isEqualTo: objectID)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: objectID)
 }
 
 /**
@@ -388,7 +388,7 @@ public func == <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Op
  */
 public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Optional<D>>, _ objectID: NSManagedObjectID) -> Where<O> {
     
-    return !Where<O>(keyPath._kvcKeyPathString!, isEqualTo: objectID)
+    return !Where<O>(Internals.kvcKeyPathString(keyPath), isEqualTo: objectID)
 }
 
 /**
@@ -399,7 +399,7 @@ public func != <O: NSManagedObject, D: NSManagedObject>(_ keyPath: KeyPath<O, Op
  */
 public func ~= <O: NSManagedObject, D: NSManagedObject, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, Optional<D>>) -> Where<O> where S.Iterator.Element == NSManagedObjectID {
     
-    return Where<O>(keyPath._kvcKeyPathString!, isMemberOf: sequence)
+    return Where<O>(Internals.kvcKeyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -435,7 +435,7 @@ public func != <O, V>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ valu
  */
 public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>) -> Where<O> where S.Iterator.Element == V {
 
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isMemberOf: sequence)
+    return Where<O>(Internals.keyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -449,7 +449,7 @@ public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, FieldCon
  */
 public func < <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> {
 
-    return Where<O>("%K < %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .lessThan, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -460,7 +460,7 @@ public func < <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<
  */
 public func < <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> where V.Wrapped: Comparable {
 
-    return Where<O>("%K < %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .lessThan, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -471,7 +471,7 @@ public func < <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.
  */
 public func > <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> {
 
-    return Where<O>("%K > %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThan, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -482,7 +482,7 @@ public func > <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<
  */
 public func > <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> where V.Wrapped: Comparable {
 
-    return Where<O>("%K > %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThan, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -493,7 +493,7 @@ public func > <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.
  */
 public func <= <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> {
 
-    return Where<O>("%K <= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .lessThanOrEqualTo, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -504,7 +504,7 @@ public func <= <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored
  */
 public func <= <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> where V.Wrapped: Comparable {
 
-    return Where<O>("%K <= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .lessThanOrEqualTo, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -515,7 +515,7 @@ public func <= <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>
  */
 public func >= <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> {
 
-    return Where<O>("%K >= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 /**
@@ -526,7 +526,7 @@ public func >= <O, V: Comparable>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored
  */
 public func >= <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, _ value: V) -> Where<O> where V.Wrapped: Comparable {
 
-    return Where<O>("%K >= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toFieldStoredNativeType() as! V.FieldStoredNativeType)
 }
 
 
@@ -540,7 +540,7 @@ public func >= <O, V: FieldOptionalType>(_ keyPath: KeyPath<O, FieldContainer<O>
  */
 public func == <O, D: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ object: D.DestinationObjectType?) -> Where<O> {
 
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -551,7 +551,7 @@ public func == <O, D: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldCon
  */
 public func == <O, D: FieldRelationshipToOneType, R: ObjectRepresentation>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ object: R?) -> Where<O> where D.DestinationObjectType == R.ObjectType {
 
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object?.objectID())
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: object?.objectID())
 }
 
 /**
@@ -562,7 +562,7 @@ public func == <O, D: FieldRelationshipToOneType, R: ObjectRepresentation>(_ key
  */
 public func != <O, D: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ object: D.DestinationObjectType?) -> Where<O> {
 
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -573,7 +573,7 @@ public func != <O, D: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldCon
  */
 public func != <O, D: FieldRelationshipToOneType, R: ObjectRepresentation>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ object: R?) -> Where<O> where D.DestinationObjectType == R.ObjectType {
 
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object?.objectID())
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: object?.objectID())
 }
 
 /**
@@ -584,7 +584,7 @@ public func != <O, D: FieldRelationshipToOneType, R: ObjectRepresentation>(_ key
  */
 public func ~= <O, D: FieldRelationshipToOneType, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, FieldContainer<O>.Relationship<D>>) -> Where<O> where S.Iterator.Element == D.DestinationObjectType {
 
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isMemberOf: sequence)
+    return Where<O>(Internals.keyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -598,7 +598,7 @@ public func ~= <O, D: FieldRelationshipToOneType, S: Sequence>(_ sequence: S, _
  */
 public func == <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
 
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -609,7 +609,7 @@ public func == <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ va
  */
 public func != <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
     
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -620,7 +620,7 @@ public func != <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ va
  */
 public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>) -> Where<O> where S.Iterator.Element == V {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isMemberOf: sequence)
+    return Where<O>(Internals.keyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -634,7 +634,7 @@ public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, ValueCon
  */
 public func == <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ value: V?) -> Where<O> {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -645,7 +645,7 @@ public func == <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ va
  */
 public func != <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ value: V?) -> Where<O> {
     
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: value)
 }
 
 /**
@@ -656,7 +656,7 @@ public func != <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ va
  */
 public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>) -> Where<O> where S.Iterator.Element == V {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isMemberOf: sequence)
+    return Where<O>(Internals.keyPathString(keyPath), isMemberOf: sequence)
 }
 
 
@@ -670,7 +670,7 @@ public func ~= <O, V, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, ValueCon
  */
 public func < <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K < %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.keyPathString(keyPath), .lessThan, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -681,7 +681,7 @@ public func < <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Require
  */
 public func > <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K > %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThan, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -692,7 +692,7 @@ public func > <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Require
  */
 public func <= <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K <= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.keyPathString(keyPath), .lessThanOrEqualTo, value.cs_toQueryableNativeType())
 }
 
 /**
@@ -703,7 +703,7 @@ public func <= <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Requir
  */
 public func >= <O, V: Comparable>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, _ value: V) -> Where<O> {
     
-    return Where<O>("%K >= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+    return Where<O>(Internals.keyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
 }
 
 
@@ -719,11 +719,11 @@ public func < <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ val
     
     if let value = value {
 
-        return Where<O>("%K < %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.keyPathString(keyPath), .lessThan, value.cs_toQueryableNativeType())
     }
     else {
 
-        return Where<O>("%K < nil", O.meta[keyPath: keyPath].keyPath)
+        return Where<O>(Internals.keyPathString(keyPath), .lessThan, nil)
     }
 }
 
@@ -737,11 +737,11 @@ public func > <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ val
     
     if let value = value {
         
-        return Where<O>("%K > %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.keyPathString(keyPath), .greaterThan, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K > nil", O.meta[keyPath: keyPath].keyPath)
+        return Where<O>(Internals.keyPathString(keyPath), .greaterThan, nil)
     }
 }
 
@@ -755,11 +755,11 @@ public func <= <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ va
     
     if let value = value {
         
-        return Where<O>("%K <= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.keyPathString(keyPath), .lessThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K <= nil", O.meta[keyPath: keyPath].keyPath)
+        return Where<O>(Internals.keyPathString(keyPath), .lessThanOrEqualTo, nil)
     }
 }
 
@@ -773,11 +773,11 @@ public func >= <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ va
     
     if let value = value {
         
-        return Where<O>("%K >= %@", O.meta[keyPath: keyPath].keyPath, value.cs_toQueryableNativeType())
+        return Where<O>(Internals.keyPathString(keyPath), .greaterThanOrEqualTo, value.cs_toQueryableNativeType())
     }
     else {
         
-        return Where<O>("%K >= nil", O.meta[keyPath: keyPath].keyPath)
+        return Where<O>(Internals.keyPathString(keyPath), .greaterThanOrEqualTo, nil)
     }
 }
 
@@ -792,7 +792,7 @@ public func >= <O, V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, _ va
  */
 public func == <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ object: D) -> Where<O> {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -803,7 +803,7 @@ public func == <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>,
  */
 public func == <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ object: D?) -> Where<O> {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -814,7 +814,7 @@ public func == <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>,
  */
 public func != <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ object: D) -> Where<O> {
     
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -825,7 +825,7 @@ public func != <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>,
  */
 public func != <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ object: D?) -> Where<O> {
     
-    return !Where<O>(O.meta[keyPath: keyPath].keyPath, isEqualTo: object)
+    return !Where<O>(Internals.keyPathString(keyPath), isEqualTo: object)
 }
 
 /**
@@ -836,5 +836,5 @@ public func != <O, D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>,
  */
 public func ~= <O, D, S: Sequence>(_ sequence: S, _ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>) -> Where<O> where S.Iterator.Element == D {
     
-    return Where<O>(O.meta[keyPath: keyPath].keyPath, isMemberOf: sequence)
+    return Where<O>(Internals.keyPathString(keyPath), isMemberOf: sequence)
 }
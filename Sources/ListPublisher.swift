@@ -314,6 +314,7 @@ public final class ListPublisher<O: DynamicObject>: Hashable {
     private var fetchedResultsControllerDelegate: Internals.FetchedDiffableDataSourceSnapshotDelegate
     private var observerForWillChangePersistentStore: Internals.NotificationObserver!
     private var observerForDidChangePersistentStore: Internals.NotificationObserver!
+    private let liveObjectToken = Internals.LiveObjectRegistry.track(.listPublisher)
 
     private lazy var observers: NSMapTable<AnyObject, Internals.Closure<ListPublisher<O>, Void>> = .weakToStrongObjects()
 
@@ -61,14 +61,16 @@ public struct ListReader<Object: DynamicObject, Content: View, Value>: View {
      ```
      
      - parameter listPublisher: The `ListPublisher` that the `ListReader` instance uses to create views dynamically
+     - parameter updateGranularity: Determines which `ListPublisher` changes re-evaluate the `content`. Defaults to `.list`. Pass `.rows` if each row observes its own `ObjectPublisher`. See `ListState.UpdateGranularity` for details.
      - parameter content: The view builder that receives an `ListSnapshot` instance and creates views dynamically.
      */
     public init(
         _ listPublisher: ListPublisher<Object>,
+        updateGranularity: ListState<Object>.UpdateGranularity = .list,
         @ViewBuilder content: @escaping (ListSnapshot<Object>) -> Content
     ) where Value == ListSnapshot<Object> {
         
-        self._list = .init(listPublisher)
+        self._list = .init(listPublisher, updateGranularity: updateGranularity)
         self.content = content
     }
     
@@ -88,15 +90,17 @@ public struct ListReader<Object: DynamicObject, Content: View, Value>: View {
      
      - parameter listPublisher: The `ListPublisher` that the `ListReader` instance uses to create views dynamically
      - parameter keyPath: A `KeyPath` for a property in the `ListSnapshot` whose value will be sent to the views
+     - parameter updateGranularity: Determines which `ListPublisher` changes re-evaluate the `content`. Defaults to `.list`. Pass `.rows` if the `keyPath` only depends on the list's structure, such as `\.count`. See `ListState.UpdateGranularity` for details.
      - parameter content: The view builder that receives the value from the property `KeyPath` and creates views dynamically.
      */
     public init(
         _ listPublisher: ListPublisher<Object>,
         keyPath: KeyPath<ListSnapshot<Object>, Value>,
+        updateGranularity: ListState<Object>.UpdateGranularity = .list,
         @ViewBuilder content: @escaping (Value) -> Content
     ) {
         
-        self._list = .init(listPublisher)
+        self._list = .init(listPublisher, updateGranularity: updateGranularity)
         self.content = {
             
             content($0[keyPath: keyPath])
@@ -103,9 +103,10 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
     public subscript(sectionIndex: Int, itemIndex: Int) -> ObjectPublisher<O> {
 
         let context = self.context!
-        let snapshot = self.diffableSnapshot
-        let sectionID = snapshot.sectionIdentifiers[sectionIndex]
-        let itemID = snapshot.itemIdentifiers(inSection: sectionID)[itemIndex]
+        guard let itemID = self.diffableSnapshot.itemIdentifier(atSectionIndex: sectionIndex, itemIndex: itemIndex) else {
+
+            Internals.abort("Index (\(sectionIndex), \(itemIndex)) is out of bounds")
+        }
         return context.objectPublisher(objectID: itemID)
     }
 
@@ -122,19 +123,10 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
 
             return nil
         }
-        let snapshot = self.diffableSnapshot
-        let sectionIDs = snapshot.sectionIdentifiers
-        guard sectionIDs.indices.contains(sectionIndex) else {
-
-            return nil
-        }
-        let sectionID = sectionIDs[sectionIndex]
-        let itemIDs = snapshot.itemIdentifiers(inSection: sectionID)
-        guard itemIDs.indices.contains(itemIndex) else {
+        guard let itemID = self.diffableSnapshot.itemIdentifier(atSectionIndex: sectionIndex, itemIndex: itemIndex) else {
 
             return nil
         }
-        let itemID = itemIDs[itemIndex]
         return context.objectPublisher(objectID: itemID)
     }
 
@@ -191,14 +183,7 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
      */
     public func hasItems(inSectionIndex sectionIndex: Int) -> Bool {
 
-        let snapshot = self.diffableSnapshot
-        let sectionIDs = snapshot.sectionIdentifiers
-        guard sectionIDs.indices.contains(sectionIndex) else {
-
-            return false
-        }
-        let sectionID = sectionIDs[sectionIndex]
-        return snapshot.numberOfItems(inSection: sectionID) > 0
+        return (self.diffableSnapshot.numberOfItems(atSectionIndex: sectionIndex) ?? 0) > 0
     }
 
     /**
@@ -210,7 +195,7 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
     public func hasItems(inSectionWithID sectionID: SectionID) -> Bool {
 
         let snapshot = self.diffableSnapshot
-        guard snapshot.sectionIdentifiers.contains(sectionID) else {
+        guard snapshot.indexOfSection(sectionID) != nil else {
 
             return false
         }
@@ -260,9 +245,11 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
      */
     public func numberOfItems(inSectionIndex sectionIndex: Int) -> Int {
 
-        let snapshot = self.diffableSnapshot
-        let sectionID = snapshot.sectionIdentifiers[sectionIndex]
-        return snapshot.numberOfItems(inSection: sectionID)
+        guard let numberOfItems = self.diffableSnapshot.numberOfItems(atSectionIndex: sectionIndex) else {
+
+            Internals.abort("Section index \(sectionIndex) is out of bounds")
+        }
+        return numberOfItems
     }
 
     /**
@@ -828,5 +815,6 @@ public struct ListSnapshot<O: DynamicObject>: RandomAccessCollection, Hashable {
     // MARK: Private
     
     private let id: UUID = .init()
+    private let liveObjectToken = Internals.LiveObjectRegistry.track(.listSnapshot)
 
 }
@@ -65,12 +65,17 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      ```
      
      - parameter listPublisher: The `ListPublisher` that the `ListState` will observe changes for
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init(
-        _ listPublisher: ListPublisher<Object>
+        _ listPublisher: ListPublisher<Object>,
+        updateGranularity: UpdateGranularity = .list
     ) {
         
-        self.observer = .init(listPublisher: listPublisher)
+        self.observer = .init(
+            listPublisher: listPublisher,
+            updateGranularity: updateGranularity
+        )
     }
     
     /**
@@ -98,13 +103,19 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      ```
      
      - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init<B: FetchChainableBuilderType>(
         _ clauseChain: B,
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) where B.ObjectType == Object {
         
-        self.init(dataStack.publishList(clauseChain))
+        self.init(
+            dataStack.publishList(clauseChain),
+            updateGranularity: updateGranularity
+        )
     }
     
     /**
@@ -139,13 +150,19 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      ```
      
      - parameter clauseChain: a `SectionMonitorBuilderType` built from a chain of clauses
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init<B: SectionMonitorBuilderType>(
         _ clauseChain: B,
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) where B.ObjectType == Object {
         
-        self.init(dataStack.publishList(clauseChain))
+        self.init(
+            dataStack.publishList(clauseChain),
+            updateGranularity: updateGranularity
+        )
     }
     
     /**
@@ -174,14 +191,17 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      
      - parameter from: a `From` clause indicating the entity type
      - parameter fetchClauses: a series of `FetchClause` instances for fetching the object list. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init(
         _ from: From<Object>,
         _ fetchClauses: FetchClause...,
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) {
         
-        self.init(from, fetchClauses, in: dataStack)
+        self.init(from, fetchClauses, in: dataStack, updateGranularity: updateGranularity)
     }
     
     /**
@@ -212,14 +232,20 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      
      - parameter from: a `From` clause indicating the entity type
      - parameter fetchClauses: a series of `FetchClause` instances for fetching the object list. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init(
         _ from: From<Object>,
         _ fetchClauses: [FetchClause],
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) {
         
-        self.init(dataStack.publishList(from, fetchClauses))
+        self.init(
+            dataStack.publishList(from, fetchClauses),
+            updateGranularity: updateGranularity
+        )
     }
     
     /**
@@ -256,15 +282,18 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      - parameter from: a `From` clause indicating the entity type
      - parameter sectionBy: a `SectionBy` clause indicating the keyPath for the attribute to use when sorting the list into sections.
      - parameter fetchClauses: a series of `FetchClause` instances for fetching the object list. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init(
         _ from: From<Object>,
         _ sectionBy: SectionBy<Object>,
         _ fetchClauses: FetchClause...,
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) {
         
-        self.init(from, sectionBy, fetchClauses, in: dataStack)
+        self.init(from, sectionBy, fetchClauses, in: dataStack, updateGranularity: updateGranularity)
     }
     
     /**
@@ -303,15 +332,21 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
      - parameter from: a `From` clause indicating the entity type
      - parameter sectionBy: a `SectionBy` clause indicating the keyPath for the attribute to use when sorting the list into sections.
      - parameter fetchClauses: a series of `FetchClause` instances for fetching the object list. Accepts `Where`, `OrderBy`, and `Tweak` clauses.
+     - parameter dataStack: the `DataStack` to fetch from
+     - parameter updateGranularity: Determines which `ListPublisher` changes invalidate views reading the `ListState`. Defaults to `.list`. See `ListState.UpdateGranularity` for details.
      */
     public init(
         _ from: From<Object>,
         _ sectionBy: SectionBy<Object>,
         _ fetchClauses: [FetchClause],
-        in dataStack: DataStack
+        in dataStack: DataStack,
+        updateGranularity: UpdateGranularity = .list
     ) {
         
-        self.init(dataStack.publishList(from, sectionBy, fetchClauses))
+        self.init(
+            dataStack.publishList(from, sectionBy, fetchClauses),
+            updateGranularity: updateGranularity
+        )
     }
     
     
@@ -336,6 +371,46 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
     }
     
     
+    // MARK: - UpdateGranularity
+    
+    /**
+     Determines which `ListPublisher` changes invalidate the views that read a `ListState`.
+     */
+    public enum UpdateGranularity {
+        
+        /**
+         Every new `ListSnapshot` invalidates the view, including changes that only update the properties of existing items. This is the default.
+         */
+        case list
+        
+        /**
+         Only changes to the list's structure invalidate the view: inserted, deleted, or moved items, and inserted, deleted, or moved sections. When a change only updates the properties of existing items, the `ListSnapshot` is replaced without invalidating the view, so SwiftUI keeps the identity of every row and skips re-evaluating the `ForEach` body.
+         
+         Rows must then observe their own objects, for example with `ObjectReader` or `@ObjectState`, so that only the rows whose objects changed are re-evaluated:
+         ```
+         @ListState(From<Person>(), in: Globals.dataStack, updateGranularity: .rows)
+         var people: ListSnapshot<Person>
+         
+         var body: some View {
+         
+            List {
+         
+                ForEach(objectIn: self.people) { person in
+
+                    ObjectReader(person) { person in
+
+                        ProfileView(person)
+                    }
+                }
+            }
+         }
+         ```
+         The updated items of the latest change are available from `ListSnapshot.updatedItemIdentifiers`.
+         */
+        case rows
+    }
+    
+    
     // MARK: Private
     
     @ObservedObject
@@ -344,14 +419,15 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
     
     // MARK: - Observer
     
-    private final class Observer: ObservableObject {
+    internal final class Observer: ObservableObject {
         
-        @Published
-        var items: ListSnapshot<Object>
+        let objectWillChange: ObservableObjectPublisher = .init()
+        
+        private(set) var items: ListSnapshot<Object>
         
         let listPublisher: ListPublisher<Object>
         
-        init(listPublisher: ListPublisher<Object>) {
+        init(listPublisher: ListPublisher<Object>, updateGranularity: UpdateGranularity) {
             
             self.listPublisher = listPublisher
             self.items = listPublisher.snapshot
@@ -362,7 +438,16 @@ public struct ListState<Object: DynamicObject>: DynamicProperty {
                     
                     return
                 }
-                self.items = listPublisher.snapshot
+                let newItems = listPublisher.snapshot
+                if case .rows = updateGranularity,
+                    newItems.diffableSnapshot.hasSameStructure(as: self.items.diffableSnapshot) {
+                    
+                    // Rows observe their own ObjectPublishers, so content-only changes don't need to invalidate the whole list
+                    self.items = newItems
+                    return
+                }
+                self.objectWillChange.send()
+                self.items = newItems
             }
         }
         
@@ -73,6 +73,7 @@ extension NSManagedObjectContext {
                 
                 do {
                     
+                    context.assignInsertedObjectsToShards()
                     try context.obtainPermanentIDs(for: Array(insertedObjects))
                 }
                 catch {
@@ -105,6 +106,68 @@ extension NSManagedObjectContext {
         }
     }
 
+    /**
+     The IDs of registered objects that must not be turned back into faults: objects with observed `ObjectPublisher`s, and the objects of `ListPublisher`s' and `ListMonitor`s' fetched results controllers.
+     */
+    @nonobjc
+    internal func observedObjectIDs() -> Set<NSManagedObjectID> {
+
+        var objectIDs = self.fetchedResultsControllerObjectIDs()
+        self.enumerateObjectPublishers { (objectID, objectPublisher) in
+
+            if objectPublisher.hasObservers {
+
+                objectIDs.insert(objectID)
+            }
+        }
+        return objectIDs
+    }
+
+    @nonobjc
+    internal func registerObservingFetchedResultsController(_ fetchedResultsController: Internals.CoreStoreFetchedResultsController) {
+
+        let fetchedResultsControllers: NSHashTable<Internals.CoreStoreFetchedResultsController> = self.userInfo(for: .observingFetchedResultsControllers) {
+
+            return .weakObjects()
+        }
+        fetchedResultsControllers.add(fetchedResultsController)
+    }
+
+    @nonobjc
+    internal func fetchedResultsControllerObjectIDs() -> Set<NSManagedObjectID> {
+
+        guard let fetchedResultsControllers = self.userInfo[UserInfoKeys.observingFetchedResultsControllers.keyString] as? NSHashTable<Internals.CoreStoreFetchedResultsController> else {
+
+            return []
+        }
+        var objectIDs: Set<NSManagedObjectID> = []
+        for fetchedResultsController in fetchedResultsControllers.allObjects {
+
+            // Batched results are only materialized on access, and re-fault on their own
+            guard fetchedResultsController.fetchRequest.fetchBatchSize == 0,
+                let fetchedObjects = fetchedResultsController.fetchedObjects else {
+
+                continue
+            }
+            objectIDs.formUnion(fetchedObjects.lazy.map({ $0.objectID }))
+        }
+        return objectIDs
+    }
+
+    @nonobjc
+    internal func purgeUnobservedObjectPublisherSnapshots() -> Int {
+
+        var purgedCount = 0
+        self.enumerateObjectPublishers { (_, objectPublisher) in
+
+            if objectPublisher.purgeSnapshotIfUnobserved() {
+
+                purgedCount += 1
+            }
+        }
+        return purgedCount
+    }
+
     @nonobjc
     internal func objectsDidChangeObserver<U: AnyObject>(for observer: U) -> Internals.SharedNotificationObserver<(updated: Set<NSManagedObjectID>, deleted: Set<NSManagedObjectID>)> {
 
@@ -175,6 +238,27 @@ extension NSManagedObjectContext {
         }
     }
 
+    private func enumerateObjectPublishers(_ body: (NSManagedObjectID, AnyObjectPublisher) -> Void) {
+
+        for (key, value) in self.userInfo {
+
+            guard let keyString = key as? String,
+                UserInfoKeys.isObjectPublishersCacheKey(keyString),
+                let cache = value as? NSMapTable<NSManagedObjectID, AnyObject>,
+                let enumerator = cache.keyEnumerator() else {
+
+                continue
+            }
+            for case let objectID as NSManagedObjectID in enumerator.allObjects {
+
+                if let objectPublisher = cache.object(forKey: objectID) as? AnyObjectPublisher {
+
+                    body(objectID, objectPublisher)
+                }
+            }
+        }
+    }
+
     private func userInfo<T>(for key: UserInfoKeys, initialize: @escaping () -> T) -> T {
 
         let keyString = key.keyString
@@ -203,6 +287,12 @@ extension NSManagedObjectContext {
 
         case objectPublishersCache(DynamicObject.Type)
         case objectsChangeObserver(AnyObject.Type)
+        case observingFetchedResultsControllers
+
+        static func isObjectPublishersCacheKey(_ keyString: String) -> Bool {
+
+            return keyString.hasPrefix("CoreStore.objectPublishersCache(")
+        }
 
         var keyString: String {
 
@@ -213,6 +303,9 @@ extension NSManagedObjectContext {
 
             case .objectsChangeObserver:
                 return "CoreStore.objectsChangeObserver"
+
+            case .observingFetchedResultsControllers:
+                return "CoreStore.observingFetchedResultsControllers"
             }
         }
     }
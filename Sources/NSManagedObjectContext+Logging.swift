@@ -42,6 +42,10 @@ extension NSManagedObjectContext {
 
             return Thread.isMainThread
         }
+        if let parentReader = self.parentReader {
+
+            return parentReader.isRunningInAllowedQueue()
+        }
         return nil
     }
 
@@ -52,7 +56,7 @@ extension NSManagedObjectContext {
 
             return true
         }
-        if self.isDataStackContext {
+        if self.isDataStackContext || self.parentReader != nil {
 
             return false
         }
@@ -228,13 +228,16 @@ extension NSManagedObjectContext: FetchableSource, QueryableSource {
     @nonobjc
     internal func fetchObjectIDs(_ fetchRequest: Internals.CoreStoreFetchRequest<NSManagedObjectID>) throws -> [NSManagedObjectID] {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [NSManagedObjectID]?
         var fetchError: Error?
         self.performAndWait {
             
             do {
                 
-                fetchResults = try self.fetch(fetchRequest.dynamicCast())
+                fetchResults = try self.fetchObjectIDsInMembershipChunks(fetchRequest)
+                    ?? self.fetch(fetchRequest.dynamicCast())
             }
             catch {
                 
@@ -345,13 +348,16 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func fetchOne<O: NSManagedObject>(_ fetchRequest: Internals.CoreStoreFetchRequest<O>) throws -> O? {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [O]?
         var fetchError: Error?
         self.performAndWait {
             
             do {
                 
-                fetchResults = try self.fetch(fetchRequest.staticCast())
+                fetchResults = try self.fetchInMembershipChunks(fetchRequest)
+                    ?? self.fetch(fetchRequest.staticCast())
             }
             catch {
                 
@@ -360,6 +366,7 @@ extension NSManagedObjectContext {
         }
         if let fetchResults = fetchResults {
 
+            self.setNeedsMemoryPolicyCheck()
             return fetchResults.first
         }
         let coreStoreError = CoreStoreError(fetchError)
@@ -373,13 +380,16 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func fetchAll<O: NSManagedObject>(_ fetchRequest: Internals.CoreStoreFetchRequest<O>) throws -> [O] {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [O]?
         var fetchError: Error?
         self.performAndWait {
             
             do {
                 
-                fetchResults = try self.fetch(fetchRequest.staticCast())
+                fetchResults = try self.fetchInMembershipChunks(fetchRequest)
+                    ?? self.fetch(fetchRequest.staticCast())
             }
             catch {
                 
@@ -388,6 +398,7 @@ extension NSManagedObjectContext {
         }
         if let fetchResults = fetchResults {
 
+            self.setNeedsMemoryPolicyCheck()
             return fetchResults
         }
         let coreStoreError = CoreStoreError(fetchError)
@@ -401,13 +412,16 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func fetchCount(_ fetchRequest: Internals.CoreStoreFetchRequest<NSNumber>) throws -> Int {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var count = 0
         var countError: Error?
         self.performAndWait {
             
             do {
                 
-                count = try self.count(for: fetchRequest.staticCast())
+                count = try self.countInMembershipChunks(fetchRequest)
+                    ?? self.count(for: fetchRequest.staticCast())
             }
             catch {
                 
@@ -429,13 +443,16 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func fetchObjectID(_ fetchRequest: Internals.CoreStoreFetchRequest<NSManagedObjectID>) throws -> NSManagedObjectID? {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [NSManagedObjectID]?
         var fetchError: Error?
         self.performAndWait {
             
             do {
                 
-                fetchResults = try self.fetch(fetchRequest.staticCast())
+                fetchResults = try self.fetchObjectIDsInMembershipChunks(fetchRequest)
+                    ?? self.fetch(fetchRequest.staticCast())
             }
             catch {
                 
@@ -460,6 +477,8 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func queryValue<O, U: QueryableAttributeType>(_ selectTerms: [SelectTerm<O>], fetchRequest: Internals.CoreStoreFetchRequest<NSDictionary>) throws -> U? {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [Any]?
         var fetchError: Error?
         self.performAndWait {
@@ -493,6 +512,8 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func queryValue<O>(_ selectTerms: [SelectTerm<O>], fetchRequest: Internals.CoreStoreFetchRequest<NSDictionary>) throws -> Any? {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [Any]?
         var fetchError: Error?
         self.performAndWait {
@@ -526,6 +547,8 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func queryAttributes(_ fetchRequest: Internals.CoreStoreFetchRequest<NSDictionary>) throws -> [[String: Any]] {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var fetchResults: [Any]?
         var fetchError: Error?
         self.performAndWait {
@@ -557,6 +580,8 @@ extension NSManagedObjectContext {
     @nonobjc
     internal func deleteAll<O: NSManagedObject>(_ fetchRequest: Internals.CoreStoreFetchRequest<O>) throws -> Int {
         
+        self.applyShardPinning(to: fetchRequest)
+        
         var numberOfDeletedObjects: Int?
         var fetchError: Error?
         self.performAndWait {
@@ -565,7 +590,8 @@ extension NSManagedObjectContext {
                 
                 do {
                     
-                    let fetchResults = try self.fetch(fetchRequest.staticCast())
+                    let fetchResults = try self.fetchInMembershipChunks(fetchRequest)
+                        ?? self.fetch(fetchRequest.staticCast())
                     for object in fetchResults {
                         
                         self.delete(object)
@@ -123,6 +123,7 @@ extension NSManagedObjectContext {
                         }
                     }
                     context.mergeChanges(fromContextDidSave: note)
+                    context.setNeedsMemoryPolicyCheck()
                 }
                 if rootContext.isSavingSynchronously == true {
                     
@@ -154,6 +154,7 @@ extension NSManagedObjectContext {
                 self.isSavingSynchronously = waitForMerge
                 try self.save()
                 self.isSavingSynchronously = nil
+                self.setNeedsMemoryPolicyCheck()
             }
             catch {
                 
@@ -196,6 +197,7 @@ extension NSManagedObjectContext {
                 self.isSavingSynchronously = false
                 try self.save()
                 self.isSavingSynchronously = nil
+                self.setNeedsMemoryPolicyCheck()
             }
             catch {
                 
@@ -207,6 +207,35 @@ public final class ObjectPublisher<O: DynamicObject>: ObjectRepresentation, Hash
         )
     }
 
+    internal var hasObservers: Bool {
+
+        return self.observers.count > 0
+    }
+
+    internal func purgeSnapshotIfUnobserved() -> Bool {
+
+        guard self.$lazySnapshot.isInitialized, !self.hasObservers else {
+
+            return false
+        }
+        let objectID = self.id
+        let context = self.context
+        let initializer = self.snapshotInitializer
+        self.$lazySnapshot.reset({ initializer(objectID, context) })
+        return true
+    }
+
+    internal func prewarmSnapshot(values: [String: Any]) {
+
+        guard !self.$lazySnapshot.isInitialized else {
+
+            return
+        }
+        self.prewarmedValues = values
+        _ = self.lazySnapshot
+        self.prewarmedValues = nil
+    }
+
     deinit {
 
         self.context.objectsDidChangeObserver(remove: self)
@@ -220,6 +249,7 @@ public final class ObjectPublisher<O: DynamicObject>: ObjectRepresentation, Hash
 
         self.id = objectID
         self.context = context
+        self.snapshotInitializer = initializer
         self.$lazySnapshot.initialize { [weak self] in
 
             guard let self = self else {
@@ -245,6 +275,11 @@ public final class ObjectPublisher<O: DynamicObject>: ObjectRepresentation, Hash
                     self.notifyObservers()
                 }
             }
+            if let values = self.prewarmedValues {
+
+                self.prewarmedValues = nil
+                return ObjectSnapshot<O>(objectID: objectID, context: context, values: values)
+            }
             return initializer(objectID, context)
         }
     }
@@ -254,9 +289,13 @@ public final class ObjectPublisher<O: DynamicObject>: ObjectRepresentation, Hash
     
     private let id: O.ObjectID
     private let context: NSManagedObjectContext
+    private let snapshotInitializer: (NSManagedObjectID, NSManagedObjectContext) -> ObjectSnapshot<O>?
+    private let liveObjectToken = Internals.LiveObjectRegistry.track(.objectPublisher)
 
     @Internals.LazyNonmutating(uninitialized: ())
     private var lazySnapshot: ObjectSnapshot<O>?
+
+    private var prewarmedValues: [String: Any]?
     
     private lazy var observers: NSMapTable<AnyObject, Internals.Closure<ObjectPublisher<O>, Void>> = .weakToStrongObjects()
 
@@ -275,6 +314,11 @@ public final class ObjectPublisher<O: DynamicObject>: ObjectRepresentation, Hash
 }
 
 
+// MARK: - ObjectPublisher: AnyObjectPublisher
+
+extension ObjectPublisher: AnyObjectPublisher {}
+
+
 // MARK: - ObjectPublisher where O: NSManagedObject
 
 extension ObjectPublisher where O: NSManagedObject {
@@ -451,3 +495,16 @@ extension ObjectPublisher where O: CoreStoreObject {
         return self.object?[keyPath: member]
     }
 }
+
+
+// MARK: - AnyObjectPublisher
+
+/**
+ The type-erased interface of `ObjectPublisher`s, used to inspect a context's publisher caches without knowing their object types.
+ */
+internal protocol AnyObjectPublisher: AnyObject {
+
+    var hasObservers: Bool { get }
+
+    func purgeSnapshotIfUnobserved() -> Bool
+}
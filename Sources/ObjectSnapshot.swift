@@ -127,6 +127,14 @@ public struct ObjectSnapshot<O: DynamicObject>: ObjectRepresentation, Hashable {
         self.values = values
         self.generation = .init()
     }
+
+    internal init(objectID: O.ObjectID, context: NSManagedObjectContext, values: [String: Any]) {
+
+        self.id = objectID
+        self.context = context
+        self.values = values
+        self.generation = .init()
+    }
     
     internal var cs_objectID: O.ObjectID {
         
@@ -149,6 +157,7 @@ public struct ObjectSnapshot<O: DynamicObject>: ObjectRepresentation, Hashable {
 
     private let id: O.ObjectID
     private let context: NSManagedObjectContext
+    private let liveObjectToken = Internals.LiveObjectRegistry.track(.objectSnapshot)
     
     private var generation: UUID
 
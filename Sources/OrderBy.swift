@@ -172,7 +172,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ keyPath: KeyPath<O, T>) -> SortKey where O: NSManagedObject {
             
-            return .ascending(keyPath._kvcKeyPathString!)
+            return .ascending(Internals.kvcKeyPathString(keyPath))
         }
         
         /**
@@ -180,7 +180,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ keyPath: KeyPath<O, T>) -> SortKey where O: NSManagedObject {
             
-            return .descending(keyPath._kvcKeyPathString!)
+            return .descending(Internals.kvcKeyPathString(keyPath))
         }
         
         
@@ -191,7 +191,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ attribute: KeyPath<O, FieldContainer<O>.Stored<T>>) -> SortKey {
 
-            return .ascending(O.meta[keyPath: attribute].keyPath)
+            return .ascending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -199,7 +199,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ attribute: KeyPath<O, ValueContainer<O>.Required<T>>) -> SortKey {
             
-            return .ascending(O.meta[keyPath: attribute].keyPath)
+            return .ascending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -207,7 +207,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ attribute: KeyPath<O, ValueContainer<O>.Optional<T>>) -> SortKey {
             
-            return .ascending(O.meta[keyPath: attribute].keyPath)
+            return .ascending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -215,7 +215,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ attribute: KeyPath<O, TransformableContainer<O>.Required<T>>) -> SortKey {
             
-            return .ascending(O.meta[keyPath: attribute].keyPath)
+            return .ascending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -223,7 +223,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func ascending<T>(_ attribute: KeyPath<O, TransformableContainer<O>.Optional<T>>) -> SortKey {
             
-            return .ascending(O.meta[keyPath: attribute].keyPath)
+            return .ascending(Internals.keyPathString(attribute))
         }
 
         /**
@@ -231,7 +231,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ attribute: KeyPath<O, FieldContainer<O>.Stored<T>>) -> SortKey {
 
-            return .descending(O.meta[keyPath: attribute].keyPath)
+            return .descending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -239,7 +239,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ attribute: KeyPath<O, ValueContainer<O>.Required<T>>) -> SortKey {
             
-            return .descending(O.meta[keyPath: attribute].keyPath)
+            return .descending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -247,7 +247,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ attribute: KeyPath<O, ValueContainer<O>.Optional<T>>) -> SortKey {
             
-            return .descending(O.meta[keyPath: attribute].keyPath)
+            return .descending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -255,7 +255,7 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ attribute: KeyPath<O, TransformableContainer<O>.Required<T>>) -> SortKey {
             
-            return .descending(O.meta[keyPath: attribute].keyPath)
+            return .descending(Internals.keyPathString(attribute))
         }
         
         /**
@@ -263,13 +263,13 @@ public struct OrderBy<O: DynamicObject>: OrderByClause, FetchClause, QueryClause
          */
         public static func descending<T>(_ attribute: KeyPath<O, TransformableContainer<O>.Optional<T>>) -> SortKey {
             
-            return .descending(O.meta[keyPath: attribute].keyPath)
+            return .descending(Internals.keyPathString(attribute))
         }
         
         
-        // MARK: Private
+        // MARK: Internal
         
-        fileprivate let descriptor: NSSortDescriptor
+        internal let descriptor: NSSortDescriptor
     }
     
     
@@ -0,0 +1,240 @@
+//
+//  PageCursor.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - PageCursor
+
+/**
+ An opaque position in a sorted list of objects, used for keyset pagination with `FetchChainBuilder.page(after:limit:uniqueKey:)`. Instead of skipping rows with a `fetchOffset`, which makes SQLite scan and discard every preceding row, the next page is fetched with a predicate that starts right after the values of the last object's sort keys.
+ ```
+ let feed = From<Post>().orderBy(.descending(\.$publishedDate))
+ var cursor: PageCursor<Post>?
+
+ let page = feed.page(after: cursor, limit: 50, uniqueKey: .ascending(\.$id))
+ let posts = try dataStack.fetchAll(page)
+ cursor = page.cursor(after: posts)
+ ```
+ Objects with the same sort key values are ordered by the `uniqueKey`, which `page(after:limit:uniqueKey:)` appends as the final sort key, so pages never repeat or skip objects even if the other sort keys are not unique.
+ - Important: The cursor remembers the sort key values at the time it was created and is only valid for fetches with the same `OrderBy` clause. Sort descriptors need to use the default `compare(_:)` comparison, because the page predicate compares values the way SQLite does.
+ */
+public struct PageCursor<O: DynamicObject>: Hashable {
+
+    // MARK: Internal
+
+    internal let sortDescriptors: [NSSortDescriptor]
+    internal let values: [NSObject]
+
+    internal init?<S: Sequence>(after objects: S, sortDescriptors: [NSSortDescriptor]) where S.Element == O {
+
+        guard let lastObject = Array(objects).last?.cs_toRaw() else {
+
+            return nil
+        }
+        self.sortDescriptors = sortDescriptors
+        self.values = Self.sortKeyValues(of: lastObject, for: sortDescriptors)
+    }
+
+    /**
+     Returns `sortDescriptors` with `uniqueKey` appended as the final sort key, so that objects with the same sort key values have a stable order. Nothing is appended if `uniqueKey` is already the last sort key.
+     */
+    internal static func sortDescriptors(_ sortDescriptors: [NSSortDescriptor], endingWith uniqueKey: NSSortDescriptor) -> [NSSortDescriptor] {
+
+        guard sortDescriptors.last?.key != uniqueKey.key else {
+
+            return sortDescriptors
+        }
+        return sortDescriptors + [uniqueKey]
+    }
+
+    /**
+     Returns the predicate that matches the objects after this cursor, in the order of its sort descriptors. For sort keys `k1, k2` with values `v1, v2`, this is `(k1 > v1) OR (k1 == v1 AND k2 > v2)`, with `>` flipped for descending keys and with `nil`s ordered first like SQLite does. The last sort key is unique, so no other object compares equal to the cursor.
+     */
+    internal func predicate() -> NSPredicate {
+
+        var equalities: [NSPredicate] = []
+        var alternatives: [NSPredicate] = []
+        for (sortDescriptor, value) in zip(self.sortDescriptors, self.values) {
+
+            guard let key = sortDescriptor.key else {
+
+                continue
+            }
+            alternatives.append(
+                NSCompoundPredicate(
+                    andPredicateWithSubpredicates: equalities + [
+                        Self.predicate(key, after: value, ascending: sortDescriptor.ascending)
+                    ]
+                )
+            )
+            equalities.append(
+                Internals.comparisonPredicate(key, .equalTo, value is NSNull ? nil : value)
+            )
+        }
+        return NSCompoundPredicate(orPredicateWithSubpredicates: alternatives)
+    }
+
+
+    // MARK: Private
+
+    private static func sortKeyValues(of object: NSManagedObject, for sortDescriptors: [NSSortDescriptor]) -> [NSObject] {
+
+        return sortDescriptors.map { (sortDescriptor) in
+
+            guard let key = sortDescriptor.key else {
+
+                return NSNull()
+            }
+            return object.value(forKeyPath: key) as? NSObject ?? NSNull()
+        }
+    }
+
+    private static func predicate(_ key: KeyPathString, after value: NSObject, ascending: Bool) -> NSPredicate {
+
+        switch (value, ascending) {
+
+        case (is NSNull, true):
+            return Internals.comparisonPredicate(key, .notEqualTo, nil)
+
+        case (is NSNull, false):
+            return NSPredicate(value: false)
+
+        case (_, true):
+            return Internals.comparisonPredicate(key, .greaterThan, value)
+
+        case (_, false):
+            return NSCompoundPredicate(
+                orPredicateWithSubpredicates: [
+                    Internals.comparisonPredicate(key, .lessThan, value),
+                    Internals.comparisonPredicate(key, .equalTo, nil)
+                ]
+            )
+        }
+    }
+}
+
+
+// MARK: - FetchChainBuilder
+
+extension FetchChainBuilder {
+
+    /**
+     Limits the `FetchChainBuilder` to a single page of results that starts right after `cursor`. Call this after the `Where` and `OrderBy` clauses; the page's predicate is combined with the `Where` clause with `AND`. The resulting `FetchChainBuilder` can be passed to the `fetchAll(...)` methods or to `publishList(...)`.
+     ```
+     let page = From<Post>()
+         .where(\.$isPublished == true)
+         .orderBy(.descending(\.$publishedDate))
+         .page(after: cursor, limit: 50, uniqueKey: .ascending(\.$id))
+     let posts = try dataStack.fetchAll(page)
+     cursor = page.cursor(after: posts)
+     ```
+     - parameter cursor: the `PageCursor` returned by `cursor(after:)` for the previous page, or `nil` for the first page
+     - parameter limit: the maximum number of objects in the page
+     - parameter uniqueKey: a sort key for a non-optional attribute whose values are unique among the fetched objects. It is appended to the `OrderBy` sort keys (unless it is already the last one) to order objects with equal sort key values.
+     - returns: a new `FetchChainBuilder` for the page
+     */
+    public func page(after cursor: PageCursor<O>?, limit: Int, uniqueKey: OrderBy<O>.SortKey) -> FetchChainBuilder<O> {
+
+        return self.appending(
+            Internals.PageClause(
+                cursor: cursor,
+                limit: Swift.max(1, limit),
+                uniqueKey: uniqueKey.descriptor
+            )
+        )
+    }
+
+    /**
+     Returns the `PageCursor` for the page after `objects`. Call this on the `FetchChainBuilder` returned by `page(after:limit:uniqueKey:)`.
+     - parameter objects: the objects fetched for the current page, in order
+     - returns: the `PageCursor` for the next page, or `nil` if `objects` is empty
+     */
+    public func cursor<S: Sequence>(after objects: S) -> PageCursor<O>? where S.Element == O {
+
+        let fetchRequest = NSFetchRequest<NSFetchRequestResult>()
+        self.fetchClauses.forEach { $0.applyToFetchRequest(fetchRequest) }
+
+        let sortDescriptors = fetchRequest.sortDescriptors ?? []
+        Internals.assert(
+            !sortDescriptors.isEmpty,
+            "Attempted to paginate a \(Internals.typeName(self)) without an \(Internals.typeName(OrderBy<O>.self)) clause."
+        )
+        return PageCursor(after: objects, sortDescriptors: sortDescriptors)
+    }
+
+    /**
+     Returns the `PageCursor` for the page after the objects in a `ListSnapshot`, such as one from a `ListPublisher` created with `publishList(...)` for this `FetchChainBuilder`.
+     - parameter snapshot: the `ListSnapshot` for the current page
+     - returns: the `PageCursor` for the next page, or `nil` if `snapshot` is empty
+     */
+    public func cursor(after snapshot: ListSnapshot<O>) -> PageCursor<O>? {
+
+        return self.cursor(after: snapshot.compactMap({ $0.object }))
+    }
+}
+
+
+// MARK: - Internals
+
+extension Internals {
+
+    // MARK: - PageClause
+
+    internal struct PageClause<O: DynamicObject>: FetchClause {
+
+        // MARK: Internal
+
+        internal let cursor: PageCursor<O>?
+        internal let limit: Int
+        internal let uniqueKey: NSSortDescriptor
+
+
+        // MARK: FetchClause
+
+        internal func applyToFetchRequest<ResultType>(_ fetchRequest: NSFetchRequest<ResultType>) {
+
+            fetchRequest.fetchLimit = self.limit
+            fetchRequest.sortDescriptors = PageCursor<O>.sortDescriptors(
+                fetchRequest.sortDescriptors ?? [],
+                endingWith: self.uniqueKey
+            )
+            guard let cursor = self.cursor else {
+
+                return
+            }
+            Internals.assert(
+                fetchRequest.sortDescriptors == cursor.sortDescriptors,
+                "The \(Internals.typeName(cursor)) was created for different sort descriptors than the \(Internals.typeName(fetchRequest))'s."
+            )
+            let pagePredicate = cursor.predicate()
+            fetchRequest.predicate = fetchRequest.predicate.map {
+
+                NSCompoundPredicate(andPredicateWithSubpredicates: [$0, pagePredicate])
+            } ?? pagePredicate
+        }
+    }
+}
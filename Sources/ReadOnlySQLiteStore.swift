@@ -0,0 +1,290 @@
+//
+//  ReadOnlySQLiteStore.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import CoreData
+
+
+// MARK: - ReadOnlySQLiteStore
+
+/**
+ A storage interface for a prebuilt SQLite file that is never written to, such as reference data shipped in the app bundle. The file is attached in place with `NSReadOnlyPersistentStoreOption`, so large datasets are available immediately without being copied or imported at launch, and their entities can be fetched and queried from the same `DataStack` as the user's own `SQLiteStore`s:
+ ```
+ let dataStack = DataStack(catalogSchema)
+ try dataStack.addStorageAndWait(
+     ReadOnlySQLiteStore(bundle: .main, fileName: "Catalog.sqlite", configuration: "Catalog")
+ )
+ try dataStack.addStorageAndWait(
+     SQLiteStore(fileName: "User.sqlite", configuration: "User")
+ )
+ ```
+ The file should be created with `ReadOnlySQLiteStore.generate(...)`, which leaves it in the journal mode and layout expected here. Since the file can't be migrated, it must be generated with the same model version as the `DataStack`'s current schema. Adding the storage to a `DataStack` with a different model version fails with an error instead.
+ */
+public final class ReadOnlySQLiteStore: LocalStorage {
+
+    /**
+     Initializes a `ReadOnlySQLiteStore` for the prebuilt SQLite file at the specified URL.
+
+     - parameter fileURL: the local file URL of the prebuilt SQLite file
+     - parameter configuration: an optional configuration name from the model file. If not specified, defaults to `nil`, the "Default" configuration. This should be the same configuration used to generate the file.
+     - parameter mmapSize: the maximum number of bytes of the file that SQLite may memory-map. Memory-mapped pages are read directly from the file system's cache instead of being copied into SQLite's page cache. Defaults to 256 MB.
+     */
+    public init(fileURL: URL, configuration: ModelConfiguration = nil, mmapSize: Int = ReadOnlySQLiteStore.defaultMmapSize) {
+
+        self.fileURL = fileURL
+        self.configuration = configuration
+        self.mmapSize = Swift.max(0, mmapSize)
+    }
+
+    /**
+     Initializes a `ReadOnlySQLiteStore` for a prebuilt SQLite file in a bundle.
+
+     - parameter bundle: the bundle containing the SQLite file. Defaults to the main bundle.
+     - parameter fileName: the file name of the SQLite file in the bundle's resources, including its extension
+     - parameter configuration: an optional configuration name from the model file. If not specified, defaults to `nil`, the "Default" configuration. This should be the same configuration used to generate the file.
+     - parameter mmapSize: the maximum number of bytes of the file that SQLite may memory-map. Memory-mapped pages are read directly from the file system's cache instead of being copied into SQLite's page cache. Defaults to 256 MB.
+     */
+    public convenience init(bundle: Bundle = Bundle.main, fileName: String, configuration: ModelConfiguration = nil, mmapSize: Int = ReadOnlySQLiteStore.defaultMmapSize) {
+
+        let resourceURL = bundle.resourceURL ?? bundle.bundleURL
+        self.init(
+            fileURL: resourceURL.appendingPathComponent(fileName, isDirectory: false),
+            configuration: configuration,
+            mmapSize: mmapSize
+        )
+    }
+
+    /**
+     The default maximum number of bytes of the file that SQLite may memory-map
+     */
+    public static let defaultMmapSize: Int = 256 * 1024 * 1024
+
+    /**
+     The maximum number of bytes of the file that SQLite may memory-map
+     */
+    public let mmapSize: Int
+
+
+    // MARK: StorageInterface
+
+    /**
+     The string identifier for the `NSPersistentStore`'s `type` property. For `ReadOnlySQLiteStore`s, this is always set to `NSSQLiteStoreType`.
+     */
+    public static let storeType = NSSQLiteStoreType
+
+    /**
+     The configuration name in the model file
+     */
+    public let configuration: ModelConfiguration
+
+    /**
+     The options dictionary for the `NSPersistentStore`. For `ReadOnlySQLiteStore`s, this opens the file as read-only with the rollback journal, which doesn't need to create "-wal" and "-shm" files next to the store file, and enables memory-mapped I/O up to `mmapSize`.
+     */
+    public var storeOptions: [AnyHashable: Any]? {
+
+        return [
+            NSReadOnlyPersistentStoreOption: true,
+            NSSQLitePragmasOption: [
+                "journal_mode": "DELETE",
+                "mmap_size": NSNumber(value: self.mmapSize)
+            ],
+            NSBinaryStoreInsecureDecodingCompatibilityOption: true
+        ]
+    }
+
+    /**
+     Do not call directly. Used by the `DataStack` internally.
+     */
+    public func cs_didAddToDataStack(_ dataStack: DataStack) {
+
+        self.dataStack = dataStack
+    }
+
+    /**
+     Do not call directly. Used by the `DataStack` internally.
+     */
+    public func cs_didRemoveFromDataStack(_ dataStack: DataStack) {
+
+        self.dataStack = nil
+    }
+
+
+    // MARK: LocalStorage
+
+    /**
+     The `NSURL` that points to the prebuilt SQLite file
+     */
+    public let fileURL: URL
+
+    /**
+     `ReadOnlySQLiteStore`s can't be migrated, so this is always empty.
+     */
+    public let migrationMappingProviders: [SchemaMappingProvider] = []
+
+    /**
+     `ReadOnlySQLiteStore`s can't be migrated or recreated, so this is always `.none`.
+     */
+    public let localStorageOptions: LocalStorageOptions = .none
+
+    /**
+     The options dictionary for the specified `LocalStorageOptions`. For `ReadOnlySQLiteStore`s, this is always the same as `storeOptions`.
+     */
+    public func dictionary(forOptions options: LocalStorageOptions) -> [AnyHashable: Any]? {
+
+        return self.storeOptions
+    }
+
+    /**
+     Called by the `DataStack` before migrating the storage. Since `ReadOnlySQLiteStore`s can't be migrated, this always throws an error.
+     */
+    public func cs_finalizeStorageAndWait(soureModelHint: NSManagedObjectModel) throws {
+
+        throw self.readOnlyError("Failed to migrate the \(Internals.typeName(self)) at \"\(self.fileURL)\". Regenerate the file with the current model version instead.")
+    }
+
+    /**
+     Called by the `DataStack` to delete the store file from disk. Since `ReadOnlySQLiteStore`s can't be written to, this always throws an error.
+     */
+    public func cs_eraseStorageAndWait(metadata: [String: Any], soureModelHint: NSManagedObjectModel?) throws {
+
+        throw self.readOnlyError("Failed to erase the \(Internals.typeName(self)) at \"\(self.fileURL)\" because it is read-only.")
+    }
+
+
+    // MARK: Private
+
+    private weak var dataStack: DataStack?
+
+    private func readOnlyError(_ message: String) -> CoreStoreError {
+
+        let error = CoreStoreError.internalError(
+            NSError: NSError(
+                domain: NSCocoaErrorDomain,
+                code: NSFileWriteNoPermissionError,
+                userInfo: [NSFilePathErrorKey: self.fileURL.path]
+            )
+        )
+        Internals.log(error, message)
+        return error
+    }
+}
+
+
+// MARK: - ReadOnlySQLiteStore
+
+extension ReadOnlySQLiteStore {
+
+    /**
+     Generates a SQLite file for use with `ReadOnlySQLiteStore`. Call this at build time, for example from a small command-line target run by a build phase, and bundle the resulting file with the app:
+     ```
+     try ReadOnlySQLiteStore.generate(
+         fileURL: outputURL,
+         schema: catalogSchema,
+         configuration: "Catalog",
+         importSource: { (transaction) in
+
+             _ = try transaction.importUniqueObjects(
+                 Into<CatalogItem>("Catalog"),
+                 sourceArray: try JSONSerialization.jsonObject(with: jsonData) as! [[String: Any]]
+             )
+         }
+     )
+     ```
+     The data is imported into a temporary file, which is then vacuumed, analyzed, and converted to the rollback journal so that it can be opened without writing to its directory. Any existing file at `fileURL` is replaced.
+
+     - parameter fileURL: the local file URL where the generated file will be written
+     - parameter schema: the schema to generate the file with. This should be the same as the current schema of the `DataStack` that will add the `ReadOnlySQLiteStore`.
+     - parameter configuration: an optional configuration name from the schema. If not specified, defaults to `nil`, the "Default" configuration. Only the entities in this configuration can be imported.
+     - parameter importSource: the closure where objects are created or imported into the file. The transaction is committed after the closure returns.
+     - throws: a `CoreStoreError` value indicating the failure. Custom errors thrown by the user will be wrapped in `CoreStoreError.userError(error: Error)`.
+     */
+    public static func generate(fileURL: URL, schema: DynamicSchema, configuration: ModelConfiguration = nil, importSource: (_ transaction: SynchronousDataTransaction) throws -> Void) throws {
+
+        let fileManager = FileManager.default
+        let temporaryDirectoryURL = fileManager.temporaryDirectory
+            .appendingPathComponent(Bundle.main.bundleIdentifier ?? "com.CoreStore.DataStack")
+            .appendingPathComponent(ProcessInfo().globallyUniqueString)
+        let temporaryFileURL = temporaryDirectoryURL.appendingPathComponent(
+            fileURL.lastPathComponent,
+            isDirectory: false
+        )
+        defer {
+
+            _ = try? fileManager.removeItem(at: temporaryDirectoryURL)
+        }
+        do {
+
+            let storage = SQLiteStore(
+                fileURL: temporaryFileURL,
+                configuration: configuration
+            )
+            do {
+
+                let dataStack = DataStack(schema)
+                try dataStack.addStorageAndWait(storage)
+                try dataStack.perform(synchronous: importSource)
+                dataStack.unsafeRemoveAllPersistentStoresAndWait()
+            }
+
+            _ = try withExtendedLifetime(NSPersistentStoreCoordinator(managedObjectModel: schema.rawModel())) { (coordinator: NSPersistentStoreCoordinator) in
+
+                var storeOptions = storage.storeOptions ?? [:]
+                storeOptions[NSSQLitePragmasOption] = ["journal_mode": "DELETE"]
+                storeOptions[NSSQLiteManualVacuumOption] = true
+                storeOptions[NSSQLiteAnalyzeOption] = true
+                let persistentStore = try coordinator.addPersistentStore(
+                    ofType: SQLiteStore.storeType,
+                    configurationName: configuration,
+                    at: temporaryFileURL,
+                    options: storeOptions
+                )
+                try coordinator.remove(persistentStore)
+            }
+            for suffix in ["-wal", "-shm"] {
+
+                _ = try? fileManager.removeItem(atPath: temporaryFileURL.path.appending(suffix))
+            }
+
+            try fileManager.createDirectory(
+                at: fileURL.deletingLastPathComponent(),
+                withIntermediateDirectories: true,
+                attributes: nil
+            )
+            if fileManager.fileExists(atPath: fileURL.path) {
+
+                try fileManager.removeItem(at: fileURL)
+            }
+            try fileManager.moveItem(at: temporaryFileURL, to: fileURL)
+        }
+        catch {
+
+            let storeError = CoreStoreError(error)
+            Internals.log(
+                storeError,
+                "Failed to generate the \(Internals.typeName(ReadOnlySQLiteStore.self)) file at \"\(fileURL)\"."
+            )
+            throw storeError
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  SQLiteStore.FullTextIndex.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - SQLiteStore
+
+extension SQLiteStore {
+
+    // MARK: - FullTextIndex
+
+    /**
+     Declares string attributes of an entity that the `DataStack` indexes for full-text search. Assign to `SQLiteStore.fullTextIndexes` before passing the `SQLiteStore` to `addStorage(...)`:
+     ```
+     let storage = SQLiteStore(fileName: "MyStore.sqlite")
+     storage.fullTextIndexes = [
+         .entity(From<Note>(), \.$title, \.$body)
+     ]
+     try dataStack.addStorageAndWait(storage)
+
+     let notes = try dataStack.fetchFullTextMatches(From<Note>(), matching: "grocery list")
+     ```
+     The index is an SQLite FTS5 table kept in a separate database next to the store's file, so that migrations and `DataStack` setup never need to know about it. It is built from the store's existing objects when the `SQLiteStore` is first added with the index, or whenever the indexed key paths change, and is updated after each save to the store.
+     */
+    public struct FullTextIndex {
+
+        /**
+         Indexes string attributes of an entity.
+
+         - parameter from: a `From` clause indicating the entity type
+         - parameter keyPaths: the key paths of the `String` attributes to index
+         */
+        public static func entity<O>(_ from: From<O>, _ keyPaths: KeyPathString...) -> FullTextIndex {
+
+            return self.entity(from, keyPaths)
+        }
+
+        /**
+         Indexes string attributes of an entity.
+
+         - parameter from: a `From` clause indicating the entity type
+         - parameter keyPaths: the key paths of the `String` attributes to index
+         */
+        public static func entity<O>(_ from: From<O>, _ keyPaths: [KeyPathString]) -> FullTextIndex {
+
+            Internals.assert(
+                !keyPaths.isEmpty,
+                "Attempted to declare a full-text index for \(Internals.typeName(O.self)) without specifying its key paths."
+            )
+            return FullTextIndex(
+                entityIdentifier: Internals.EntityIdentifier(O.self),
+                keyPaths: keyPaths
+            )
+        }
+
+        /**
+         Indexes `Field.Stored<String>` attributes of a `CoreStoreObject` entity.
+
+         - parameter from: a `From` clause indicating the entity type
+         - parameter keyPaths: the key paths of the attributes to index
+         */
+        public static func entity<O: CoreStoreObject>(_ from: From<O>, _ keyPaths: KeyPath<O, FieldContainer<O>.Stored<String>>...) -> FullTextIndex {
+
+            return self.entity(from, keyPaths.map({ Internals.keyPathString($0) }))
+        }
+
+        /**
+         Indexes `Field.Stored<String?>` attributes of a `CoreStoreObject` entity.
+
+         - parameter from: a `From` clause indicating the entity type
+         - parameter keyPaths: the key paths of the attributes to index
+         */
+        public static func entity<O: CoreStoreObject>(_ from: From<O>, _ keyPaths: KeyPath<O, FieldContainer<O>.Stored<String?>>...) -> FullTextIndex {
+
+            return self.entity(from, keyPaths.map({ Internals.keyPathString($0) }))
+        }
+
+
+        // MARK: Internal
+
+        internal let entityIdentifier: Internals.EntityIdentifier
+        internal let keyPaths: [KeyPathString]
+    }
+}
@@ -0,0 +1,593 @@
+//
+//  SQLiteStore.Prewarming.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+import os
+
+
+// MARK: - SQLiteStore
+
+extension SQLiteStore {
+
+    // MARK: - Prewarming
+
+    /**
+     Describes data that a `DataStack` reads in the background right after an `SQLiteStore` is added, so that the first fetches after launch don't wait on disk reads. Assign to `SQLiteStore.prewarming` before passing the `SQLiteStore` to `addStorage(...)`:
+     ```
+     let storage = SQLiteStore(fileName: "MyStore.sqlite")
+     storage.prewarming = .init(
+         byteBudget: 4 * 1024 * 1024,
+         targets: [
+             .index(From<Person>(), #keyPath(Person.lastName)),
+             .entity(From<Person>(), Where<Person>(\.isFavorite == true)),
+             .list(From<Person>().orderBy(.ascending(\.lastName)), pageSize: 30)
+         ],
+         completion: { (report) in
+
+             print(report)
+         }
+     )
+     try dataStack.addStorageAndWait(storage)
+     ```
+     `.entity(...)` and `.index(...)` targets are read sequentially on a background context attached to the `DataStack`'s coordinator, which pulls their pages into SQLite's page cache and the system's file cache. `.list(...)` targets are fetched last, on the main queue, into the `DataStack`'s `mainContext`, and are kept registered while the `SQLiteStore` is attached so that a `ListPublisher` created with the same query finds its first page already loaded.
+     Each phase is also marked with signposts under the "com.coreStore" subsystem's "Prewarming" category, so its effect on time-to-first-frame can be inspected in Instruments.
+     */
+    public struct Prewarming {
+
+        /**
+         The maximum estimated number of bytes to read for `.entity(...)` and `.index(...)` targets, or `nil` to read all targets completely. Targets are read in order, and reading stops once the budget is exhausted.
+         */
+        public var byteBudget: Int?
+
+        /**
+         The data to read, in order.
+         */
+        public var targets: [Target]
+
+        /**
+         The closure to execute on the main queue after prewarming completes
+         */
+        public var completion: ((Report) -> Void)?
+
+        /**
+         Initializes a `Prewarming` configuration.
+
+         - parameter byteBudget: the maximum estimated number of bytes to read for `.entity(...)` and `.index(...)` targets, or `nil` to read all targets completely.
+         - parameter targets: the data to read, in order
+         - parameter completion: the closure to execute on the main queue after prewarming completes
+         */
+        public init(byteBudget: Int? = nil, targets: [Target], completion: ((Report) -> Void)? = nil) {
+
+            self.byteBudget = byteBudget.map({ Swift.max(0, $0) })
+            self.targets = targets
+            self.completion = completion
+        }
+
+
+        // MARK: - Target
+
+        /**
+         Data to be read by a `Prewarming` step.
+         */
+        public struct Target {
+
+            /**
+             Reads the objects of an entity, including their attribute values.
+
+             - parameter from: a `From` clause indicating the entity type
+             - parameter fetchClauses: a series of `FetchClause` instances for filtering and ordering the objects to read
+             */
+            public static func entity<O>(_ from: From<O>, _ fetchClauses: FetchClause...) -> Target {
+
+                return self.entity(from, fetchClauses)
+            }
+
+            /**
+             Reads the objects of an entity, including their attribute values. Objects are read in batches that seek past the previous batch's last `OrderBy` key values, so pass an `OrderBy` clause on indexed attributes to let each batch start from the index. Without one, batches are read with a growing offset.
+
+             - parameter from: a `From` clause indicating the entity type
+             - parameter fetchClauses: a series of `FetchClause` instances for filtering and ordering the objects to read
+             */
+            public static func entity<O>(_ from: From<O>, _ fetchClauses: [FetchClause]) -> Target {
+
+                return Target(warmUp: { (context, byteBudget) in
+
+                    let fetchRequest = Internals.CoreStoreFetchRequest<NSManagedObject>()
+                    try from.applyToFetchRequest(fetchRequest, context: context)
+                    fetchRequest.fetchLimit = 0
+                    fetchRequest.resultType = .managedObjectResultType
+                    fetchClauses.forEach { $0.applyToFetchRequest(fetchRequest) }
+                    fetchRequest.returnsObjectsAsFaults = false
+                    fetchRequest.includesPendingChanges = false
+
+                    let fetchLimit = fetchRequest.fetchLimit
+                    let sortKeyPaths = (fetchRequest.sortDescriptors ?? []).compactMap({ $0.key })
+                    var pager = KeysetPager(sortDescriptors: fetchRequest.sortDescriptors ?? [], predicate: fetchRequest.predicate)
+                    var byteCount = 0
+                    var objectCount = 0
+                    while byteCount < byteBudget && (fetchLimit == 0 || objectCount < fetchLimit) {
+
+                        pager.apply(to: fetchRequest)
+                        fetchRequest.fetchLimit = fetchLimit > 0
+                            ? Swift.min(Target.batchSize, fetchLimit - objectCount)
+                            : Target.batchSize
+
+                        let objects = try context.fetchAll(fetchRequest)
+                        objectCount += objects.count
+                        byteCount += objects.reduce(into: 0) { $0 += Target.estimatedByteCount(of: $1) }
+                        let sortKeyValues = objects.map { (object) in
+
+                            sortKeyPaths.map({ object.value(forKeyPath: $0) ?? NSNull() })
+                        }
+                        context.reset()
+                        guard objects.count == fetchRequest.fetchLimit else {
+
+                            break
+                        }
+                        pager.advance(past: sortKeyValues)
+                    }
+                    return (objectCount, byteCount)
+                })
+            }
+
+            /**
+             Reads the values of indexed attributes in index order, without loading the objects themselves. Use this to warm up the indexes that hot queries sort or filter by.
+
+             - parameter from: a `From` clause indicating the entity type
+             - parameter keyPaths: the key paths of the index's attributes, in the same order as the index
+             */
+            public static func index<O>(_ from: From<O>, _ keyPaths: KeyPathString...) -> Target {
+
+                return self.index(from, keyPaths)
+            }
+
+            /**
+             Reads the values of indexed attributes in index order, without loading the objects themselves. Use this to warm up the indexes that hot queries sort or filter by.
+
+             - parameter from: a `From` clause indicating the entity type
+             - parameter keyPaths: the key paths of the index's attributes, in the same order as the index
+             */
+            public static func index<O>(_ from: From<O>, _ keyPaths: [KeyPathString]) -> Target {
+
+                Internals.assert(
+                    !keyPaths.isEmpty,
+                    "Attempted to prewarm an index of \(Internals.typeName(O.self)) without specifying its key paths."
+                )
+                return Target(warmUp: { (context, byteBudget) in
+
+                    let fetchRequest = Internals.CoreStoreFetchRequest<NSDictionary>()
+                    try from.applyToFetchRequest(fetchRequest, context: context)
+                    fetchRequest.resultType = .dictionaryResultType
+                    fetchRequest.propertiesToFetch = keyPaths
+                    fetchRequest.sortDescriptors = keyPaths.map({ NSSortDescriptor(key: $0, ascending: true) })
+                    fetchRequest.fetchLimit = Target.batchSize
+                    fetchRequest.includesPendingChanges = false
+
+                    var pager = KeysetPager(sortDescriptors: fetchRequest.sortDescriptors ?? [], predicate: nil)
+                    var byteCount = 0
+                    var objectCount = 0
+                    while byteCount < byteBudget {
+
+                        pager.apply(to: fetchRequest)
+                        let attributes = try context.queryAttributes(fetchRequest)
+                        objectCount += attributes.count
+                        byteCount += attributes.reduce(into: 0) { $0 += Target.estimatedByteCount(of: $1) }
+
+                        guard attributes.count == Target.batchSize else {
+
+                            break
+                        }
+                        pager.advance(past: attributes.map({ (attributes) in keyPaths.map({ attributes[$0] ?? NSNull() }) }))
+                    }
+                    return (objectCount, byteCount)
+                })
+            }
+
+
+            /**
+             Fetches the first page of a list query into the `DataStack`'s `mainContext`. The objects are kept registered while the `SQLiteStore` is attached, so a `ListPublisher` created with the same query can display its first page without reading from disk. These targets are not limited by the `byteBudget`.
+
+             - parameter clauseChain: a `FetchChainableBuilderType` built from a chain of clauses, typically the same one passed to `DataStack.publishList(...)`
+             - parameter pageSize: the number of objects to fetch
+             */
+            public static func list<B: FetchChainableBuilderType>(_ clauseChain: B, pageSize: Int) -> Target {
+
+                return Target(fetch: { (context) in
+
+                    let fetchRequest = Internals.CoreStoreFetchRequest<NSManagedObject>()
+                    try clauseChain.from.applyToFetchRequest(fetchRequest, context: context)
+                    fetchRequest.fetchLimit = 0
+                    fetchRequest.resultType = .managedObjectResultType
+                    clauseChain.fetchClauses.forEach { $0.applyToFetchRequest(fetchRequest) }
+
+                    fetchRequest.fetchLimit = fetchRequest.fetchLimit > 0
+                        ? Swift.min(pageSize, fetchRequest.fetchLimit)
+                        : Swift.max(1, pageSize)
+                    fetchRequest.returnsObjectsAsFaults = false
+
+                    let objects = try context.fetchAll(fetchRequest)
+                    return (objects, objects.reduce(into: 0) { $0 += Target.estimatedByteCount(of: $1) })
+                })
+            }
+
+
+            // MARK: Internal
+
+            internal let isMainContextTarget: Bool
+
+            internal func warmUp(in context: NSManagedObjectContext, byteBudget: Int) throws -> (objectCount: Int, byteCount: Int) {
+
+                var result: (objectCount: Int, byteCount: Int)?
+                var warmUpError: Error?
+                context.performAndWait {
+
+                    do {
+
+                        result = try self.warmUpObjects(context, byteBudget)
+                    }
+                    catch {
+
+                        warmUpError = error
+                    }
+                }
+                if let warmUpError = warmUpError {
+
+                    throw warmUpError
+                }
+                return result!
+            }
+
+            internal func fetchObjects(in context: NSManagedObjectContext) throws -> (objects: [NSManagedObject], byteCount: Int) {
+
+                return try self.fetchMainContextObjects(context)
+            }
+
+
+            // MARK: Private
+
+            private static let batchSize = 500
+
+            private let warmUpObjects: (_ context: NSManagedObjectContext, _ byteBudget: Int) throws -> (objectCount: Int, byteCount: Int)
+            private let fetchMainContextObjects: (_ context: NSManagedObjectContext) throws -> (objects: [NSManagedObject], byteCount: Int)
+
+            private init(warmUp: @escaping (_ context: NSManagedObjectContext, _ byteBudget: Int) throws -> (objectCount: Int, byteCount: Int)) {
+
+                self.isMainContextTarget = false
+                self.warmUpObjects = warmUp
+                self.fetchMainContextObjects = { _ in ([], 0) }
+            }
+
+            private init(fetch: @escaping (_ context: NSManagedObjectContext) throws -> (objects: [NSManagedObject], byteCount: Int)) {
+
+                self.isMainContextTarget = true
+                self.warmUpObjects = { _, _ in (0, 0) }
+                self.fetchMainContextObjects = fetch
+            }
+
+            private static func estimatedByteCount(of object: NSManagedObject) -> Int {
+
+                let keys = Array(object.entity.attributesByName.keys)
+                return self.estimatedByteCount(of: object.committedValues(forKeys: keys))
+            }
+
+            private static func estimatedByteCount(of values: [String: Any]) -> Int {
+
+                return values.values.reduce(into: 0) { (byteCount, value) in
+
+                    switch value {
+
+                    case let string as String:
+                        byteCount += string.utf8.count
+
+                    case let data as Data:
+                        byteCount += data.count
+
+                    case is NSNull:
+                        break
+
+                    default:
+                        byteCount += MemoryLayout<Int64>.size
+                    }
+                }
+            }
+
+
+            // MARK: - KeysetPager
+
+            /**
+             Pages through a sorted fetch by seeking past the sort key values of the last row read, instead of re-scanning the preceding rows with an OFFSET. Only the rows tied with the last row's values are skipped by offset.
+             */
+            private struct KeysetPager {
+
+                // MARK: FilePrivate
+
+                fileprivate init(sortDescriptors: [NSSortDescriptor], predicate: NSPredicate?) {
+
+                    self.sortDescriptors = sortDescriptors.filter({ $0.key != nil })
+                    self.predicate = predicate
+                }
+
+                fileprivate func apply<T>(to fetchRequest: Internals.CoreStoreFetchRequest<T>) {
+
+                    guard let lastValues = self.lastValues else {
+
+                        fetchRequest.predicate = self.predicate
+                        fetchRequest.fetchOffset = 0
+                        return
+                    }
+                    let seekPredicate = self.seekPredicate(atOrAfter: lastValues)
+                    fetchRequest.predicate = self.predicate.map({ NSCompoundPredicate(andPredicateWithSubpredicates: [$0, seekPredicate]) })
+                        ?? seekPredicate
+                    fetchRequest.fetchOffset = self.tiedCount
+                }
+
+                fileprivate mutating func advance(past sortKeyValues: [[Any]]) {
+
+                    guard let values = sortKeyValues.last else {
+
+                        return
+                    }
+                    let tiedCountInPage = sortKeyValues.reversed()
+                        .prefix(while: { $0.elementsEqual(values, by: KeysetPager.isEqual) })
+                        .count
+                    if let lastValues = self.lastValues, lastValues.elementsEqual(values, by: KeysetPager.isEqual) {
+
+                        self.tiedCount += tiedCountInPage
+                    }
+                    else {
+
+                        self.tiedCount = tiedCountInPage
+                    }
+                    self.lastValues = values
+                }
+
+
+                // MARK: Private
+
+                private let sortDescriptors: [NSSortDescriptor]
+                private let predicate: NSPredicate?
+                private var lastValues: [Any]?
+                private var tiedCount = 0
+
+                private static func isEqual(_ value: Any, _ otherValue: Any) -> Bool {
+
+                    return (value as? NSObject)?.isEqual(otherValue) ?? false
+                }
+
+                private func seekPredicate(atOrAfter values: [Any]) -> NSPredicate {
+
+                    // (k1 > v1) OR (k1 == v1 AND k2 > v2) OR ... OR (k1 == v1 AND ... AND kn == vn), with ">" flipped for descending keys and nils ordered first like SQLite does
+                    var subpredicates: [NSPredicate] = []
+                    var equalityPredicates: [NSPredicate] = []
+                    for (sortDescriptor, value) in zip(self.sortDescriptors, values) {
+
+                        let keyPath = sortDescriptor.key!
+                        let value: Any? = value is NSNull ? nil : value
+                        let afterPredicate: NSPredicate
+                        switch (value, sortDescriptor.ascending) {
+
+                        case (nil, true):
+                            afterPredicate = Internals.comparisonPredicate(keyPath, .notEqualTo, nil)
+
+                        case (nil, false):
+                            afterPredicate = NSPredicate(value: false)
+
+                        case (let value?, true):
+                            afterPredicate = Internals.comparisonPredicate(keyPath, .greaterThan, value)
+
+                        case (let value?, false):
+                            afterPredicate = NSCompoundPredicate(
+                                orPredicateWithSubpredicates: [
+                                    Internals.comparisonPredicate(keyPath, .lessThan, value),
+                                    Internals.comparisonPredicate(keyPath, .equalTo, nil)
+                                ]
+                            )
+                        }
+                        subpredicates.append(NSCompoundPredicate(andPredicateWithSubpredicates: equalityPredicates + [afterPredicate]))
+                        equalityPredicates.append(Internals.comparisonPredicate(keyPath, .equalTo, value))
+                    }
+                    subpredicates.append(NSCompoundPredicate(andPredicateWithSubpredicates: equalityPredicates))
+                    return NSCompoundPredicate(orPredicateWithSubpredicates: subpredicates)
+                }
+            }
+        }
+
+
+        // MARK: - Report
+
+        /**
+         A summary of a completed `Prewarming` step
+         */
+        public struct Report: CustomStringConvertible {
+
+            /**
+             The number of objects or index entries read by `.entity(...)` and `.index(...)` targets
+             */
+            public let backgroundObjectCount: Int
+
+            /**
+             The estimated number of bytes read by `.entity(...)` and `.index(...)` targets
+             */
+            public let backgroundByteCount: Int
+
+            /**
+             The time spent reading `.entity(...)` and `.index(...)` targets on the background queue
+             */
+            public let backgroundDuration: TimeInterval
+
+            /**
+             The number of objects registered in the `mainContext` by `.list(...)` targets
+             */
+            public let mainContextObjectCount: Int
+
+            /**
+             The time spent fetching `.list(...)` targets on the main queue. This is the cost that prewarming adds to the main queue, and is the number to compare against the time-to-first-frame it saves.
+             */
+            public let mainQueueDuration: TimeInterval
+
+            /**
+             `true` if reading stopped because the `byteBudget` was exhausted before all targets were read
+             */
+            public let isBudgetExhausted: Bool
+
+            /**
+             The errors thrown by failed targets. Failed targets are skipped without stopping the rest of the prewarming.
+             */
+            public let errors: [CoreStoreError]
+
+
+            // MARK: CustomStringConvertible
+
+            public var description: String {
+
+                return "Prewarmed \(self.backgroundObjectCount) rows (~\(self.backgroundByteCount) bytes) in \(Int(self.backgroundDuration * 1000))ms"
+                    + "\(self.isBudgetExhausted ? " (budget exhausted)" : ""),"
+                    + " \(self.mainContextObjectCount) main context objects in \(Int(self.mainQueueDuration * 1000))ms"
+                    + "\(self.errors.isEmpty ? "" : ", \(self.errors.count) failed targets")"
+            }
+        }
+
+
+        // MARK: Internal
+
+        internal func start(for storage: SQLiteStore, in dataStack: DataStack) {
+
+            let signpostName = storage.fileURL.lastPathComponent
+            DispatchQueue.global(qos: .utility).async { [weak dataStack] in
+
+                guard let dataStack = dataStack else {
+
+                    return
+                }
+                let context = NSManagedObjectContext(concurrencyType: .privateQueueConcurrencyType)
+                context.persistentStoreCoordinator = dataStack.coordinator
+                context.undoManager = nil
+                context.name = "com.coreStore.prewarmingContext"
+                context.parentStack = dataStack
+
+                var errors: [CoreStoreError] = []
+                var backgroundObjectCount = 0
+                var backgroundByteCount = 0
+                var isBudgetExhausted = false
+
+                Prewarming.signpost(.begin, "Background", signpostName)
+                let backgroundStart = Date()
+                for target in self.targets where !target.isMainContextTarget {
+
+                    let remainingBytes = (self.byteBudget ?? .max) - backgroundByteCount
+                    guard remainingBytes > 0 else {
+
+                        isBudgetExhausted = true
+                        break
+                    }
+                    do {
+
+                        let (objectCount, byteCount) = try autoreleasepool {
+
+                            try target.warmUp(in: context, byteBudget: remainingBytes)
+                        }
+                        backgroundObjectCount += objectCount
+                        backgroundByteCount += byteCount
+                    }
+                    catch {
+
+                        errors.append(CoreStoreError(error))
+                    }
+                }
+                let backgroundDuration = Date().timeIntervalSince(backgroundStart)
+                Prewarming.signpost(.end, "Background", signpostName)
+
+                DispatchQueue.main.async { [weak dataStack] in
+
+                    guard let dataStack = dataStack else {
+
+                        return
+                    }
+                    var mainContextObjects: [NSManagedObject] = []
+
+                    Prewarming.signpost(.begin, "MainContext", signpostName)
+                    let mainQueueStart = Date()
+                    for target in self.targets where target.isMainContextTarget {
+
+                        do {
+
+                            mainContextObjects.append(contentsOf: try target.fetchObjects(in: dataStack.mainContext).objects)
+                        }
+                        catch {
+
+                            errors.append(CoreStoreError(error))
+                        }
+                    }
+                    let mainQueueDuration = Date().timeIntervalSince(mainQueueStart)
+                    Prewarming.signpost(.end, "MainContext", signpostName)
+
+                    if dataStack.persistentStoreForStorage(storage) != nil {
+
+                        storage.prewarmedObjects = mainContextObjects
+                    }
+                    self.completion?(
+                        Report(
+                            backgroundObjectCount: backgroundObjectCount,
+                            backgroundByteCount: backgroundByteCount,
+                            backgroundDuration: backgroundDuration,
+                            mainContextObjectCount: mainContextObjects.count,
+                            mainQueueDuration: mainQueueDuration,
+                            isBudgetExhausted: isBudgetExhausted,
+                            errors: errors
+                        )
+                    )
+                }
+            }
+        }
+
+
+        // MARK: Private
+
+        private static let signpostLog = OSLog(subsystem: "com.coreStore", category: "Prewarming")
+
+        private enum SignpostType {
+
+            case begin
+            case end
+        }
+
+        private static func signpost(_ type: SignpostType, _ name: StaticString, _ fileName: String) {
+
+            guard #available(iOS 12.0, tvOS 12.0, watchOS 5.0, macOS 10.14, *) else {
+
+                return
+            }
+            switch type {
+
+            case .begin:
+                os_signpost(.begin, log: self.signpostLog, name: name, "%{public}@", fileName)
+
+            case .end:
+                os_signpost(.end, log: self.signpostLog, name: name, "%{public}@", fileName)
+            }
+        }
+    }
+}
@@ -149,11 +149,20 @@ public final class SQLiteStore: LocalStorage {
      ```
      [NSSQLitePragmasOption: ["journal_mode": "WAL"]]
      ```
+     with `NSPersistentHistoryTrackingKey` enabled if `tracksPersistentHistory` is `true`.
      */
-    public let storeOptions: [AnyHashable: Any]? = [
-        NSSQLitePragmasOption: ["journal_mode": "WAL"],
-        NSBinaryStoreInsecureDecodingCompatibilityOption: true
-    ]
+    public var storeOptions: [AnyHashable: Any]? {
+        
+        var storeOptions: [AnyHashable: Any] = [
+            NSSQLitePragmasOption: ["journal_mode": "WAL"],
+            NSBinaryStoreInsecureDecodingCompatibilityOption: true
+        ]
+        if self.tracksPersistentHistory {
+            
+            storeOptions[NSPersistentHistoryTrackingKey] = true
+        }
+        return storeOptions
+    }
     
     /**
      Do not call directly. Used by the `DataStack` internally.
@@ -161,6 +170,12 @@ public final class SQLiteStore: LocalStorage {
     public func cs_didAddToDataStack(_ dataStack: DataStack) {
         
         self.dataStack = dataStack
+        self.prewarming?.start(for: self, in: dataStack)
+        if !self.fullTextIndexes.isEmpty,
+            let persistentStore = dataStack.coordinator.persistentStores.first(where: { $0.storageInterface === self }) {
+            
+            dataStack.fullTextIndexer.attach(self, persistentStore: persistentStore, in: dataStack)
+        }
     }
     
     /**
@@ -169,6 +184,10 @@ public final class SQLiteStore: LocalStorage {
     public func cs_didRemoveFromDataStack(_ dataStack: DataStack) {
         
         self.dataStack = nil
+        DispatchQueue.main.async {
+            
+            self.prewarmedObjects = []
+        }
     }
     
     
@@ -189,6 +208,22 @@ public final class SQLiteStore: LocalStorage {
      */
     public var localStorageOptions: LocalStorageOptions
     
+    /**
+     Data that the `DataStack` reads in the background after this storage is added, so that the first fetches after launch don't wait on disk reads. Defaults to `nil`, which skips prewarming.
+     */
+    public var prewarming: Prewarming?
+    
+    /**
+     If `true`, the store records the history of committed changes, which the `DataStack` reads through `fetchChanges(after:limit:)`. Defaults to `false`. Set before passing the `SQLiteStore` to `addStorage(...)`.
+     - Important: Once a store was opened with history tracking, it should keep being opened with it. Core Data opens a tracked store as read-only if `tracksPersistentHistory` is later turned off.
+     */
+    public var tracksPersistentHistory: Bool = false
+    
+    /**
+     The string attributes that the `DataStack` indexes for full-text search with `fetchFullTextMatches(_:matching:limit:)`. Defaults to an empty array, which skips indexing. Set before passing the `SQLiteStore` to `addStorage(...)`.
+     */
+    public var fullTextIndexes: [FullTextIndex] = []
+    
     /**
      The options dictionary for the specified `LocalStorageOptions`
      */
@@ -237,7 +272,8 @@ public final class SQLiteStore: LocalStorage {
             let fileManager = FileManager.default
             let extraFiles: [String] = [
                 storeURL.path.appending("-wal"),
-                storeURL.path.appending("-shm")
+                storeURL.path.appending("-shm"),
+                storeURL.path.appending("-fts")
             ]
             do {
                 
@@ -343,6 +379,11 @@ public final class SQLiteStore: LocalStorage {
         .appendingPathExtension("sqlite")
     }
     
+    /**
+     The objects fetched into the `mainContext` by `Prewarming.Target.list(...)` targets, retained while this storage is attached. Only accessed from the main queue.
+     */
+    internal var prewarmedObjects: [NSManagedObject] = []
+    
     
     // MARK: Private
     
@@ -126,7 +126,7 @@ extension SectionBy where O: NSManagedObject {
     ) {
         
         self.init(
-            sectionKeyPath._kvcKeyPathString!,
+            Internals.kvcKeyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -141,7 +141,7 @@ extension SectionBy where O: NSManagedObject {
     ) {
         
         self.init(
-            sectionKeyPath._kvcKeyPathString!,
+            Internals.kvcKeyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -256,7 +256,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
         
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -274,7 +274,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
 
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -292,7 +292,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
 
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -310,7 +310,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
 
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -328,7 +328,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
         
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -346,7 +346,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
         
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -364,7 +364,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
         
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -391,7 +391,7 @@ extension SectionBy where O: CoreStoreObject {
     ) {
 
         self.init(
-            O.meta[keyPath: sectionKeyPath].keyPath,
+            Internals.keyPathString(sectionKeyPath),
             sectionIndexTransformer: sectionIndexTransformer
         )
     }
@@ -316,7 +316,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func attribute<V>(_ keyPath: KeyPath<O, V>) -> SelectTerm<O> {
         
-        return self.attribute(keyPath._kvcKeyPathString!)
+        return self.attribute(Internals.kvcKeyPathString(keyPath))
     }
     
     /**
@@ -327,7 +327,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func average<V>(_ keyPath: KeyPath<O, V>, as alias: KeyPathString? = nil) -> SelectTerm<O> {
         
-        return self.average(keyPath._kvcKeyPathString!, as: alias)
+        return self.average(Internals.kvcKeyPathString(keyPath), as: alias)
     }
     
     /**
@@ -338,7 +338,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func count<V>(_ keyPath: KeyPath<O, V>, as alias: KeyPathString? = nil) -> SelectTerm<O> {
         
-        return self.count(keyPath._kvcKeyPathString!, as: alias)
+        return self.count(Internals.kvcKeyPathString(keyPath), as: alias)
     }
     
     /**
@@ -349,7 +349,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func maximum<V>(_ keyPath: KeyPath<O, V>, as alias: KeyPathString? = nil) -> SelectTerm<O> {
         
-        return self.maximum(keyPath._kvcKeyPathString!, as: alias)
+        return self.maximum(Internals.kvcKeyPathString(keyPath), as: alias)
     }
     
     /**
@@ -360,7 +360,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func minimum<V>(_ keyPath: KeyPath<O, V>, as alias: KeyPathString? = nil) -> SelectTerm<O> {
         
-        return self.minimum(keyPath._kvcKeyPathString!, as: alias)
+        return self.minimum(Internals.kvcKeyPathString(keyPath), as: alias)
     }
     
     /**
@@ -371,7 +371,7 @@ extension SelectTerm where O: NSManagedObject {
      */
     public static func sum<V>(_ keyPath: KeyPath<O, V>, as alias: KeyPathString? = nil) -> SelectTerm<O> {
         
-        return self.sum(keyPath._kvcKeyPathString!, as: alias)
+        return self.sum(Internals.kvcKeyPathString(keyPath), as: alias)
     }
 }
 
@@ -387,7 +387,7 @@ extension SelectTerm where O: CoreStoreObject {
      */
     public static func attribute<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O, K>) -> SelectTerm<O> where K.ObjectType == O {
 
-        return self.attribute(O.meta[keyPath: keyPath].cs_keyPathString)
+        return self.attribute(Internals.keyPathString(keyPath))
     }
     
     /**
@@ -398,7 +398,7 @@ extension SelectTerm where O: CoreStoreObject {
      */
     public static func average<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O, K>, as alias: KeyPathString? = nil) -> SelectTerm<O> where K.ObjectType == O{
         
-        return self.average(O.meta[keyPath: keyPath].cs_keyPathString, as: alias)
+        return self.average(Internals.keyPathString(keyPath), as: alias)
     }
     
     /**
@@ -410,7 +410,7 @@ extension SelectTerm where O: CoreStoreObject {
     public static func count<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O,
         K>, as alias: KeyPathString? = nil) -> SelectTerm<O> where K.ObjectType == O {
         
-        return self.count(O.meta[keyPath: keyPath].cs_keyPathString, as: alias)
+        return self.count(Internals.keyPathString(keyPath), as: alias)
     }
     
     /**
@@ -422,7 +422,7 @@ extension SelectTerm where O: CoreStoreObject {
     public static func maximum<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O,
         K>, as alias: KeyPathString? = nil) -> SelectTerm<O> where K.ObjectType == O {
         
-        return self.maximum(O.meta[keyPath: keyPath].cs_keyPathString, as: alias)
+        return self.maximum(Internals.keyPathString(keyPath), as: alias)
     }
     
     /**
@@ -433,7 +433,7 @@ extension SelectTerm where O: CoreStoreObject {
      */
     public static func minimum<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O, K>, as alias: KeyPathString? = nil) -> SelectTerm<O> where K.ObjectType == O {
         
-        return self.minimum(O.meta[keyPath: keyPath].cs_keyPathString, as: alias)
+        return self.minimum(Internals.keyPathString(keyPath), as: alias)
     }
     
     /**
@@ -444,7 +444,7 @@ extension SelectTerm where O: CoreStoreObject {
      */
     public static func sum<K: AttributeKeyPathStringConvertible>(_ keyPath: KeyPath<O, K>, as alias: KeyPathString? = nil) -> SelectTerm<O> where K.ObjectType == O {
         
-        return self.sum(O.meta[keyPath: keyPath].cs_keyPathString, as: alias)
+        return self.sum(Internals.keyPathString(keyPath), as: alias)
     }
 }
 
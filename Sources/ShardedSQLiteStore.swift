@@ -0,0 +1,197 @@
+//
+//  ShardedSQLiteStore.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - ShardedSQLiteStore
+
+/**
+ Partitions the objects of a single entity across multiple `SQLiteStore` files by the value of a shard key, so that very large tables can be vacuumed, backed up, and re-indexed one file at a time. All shards use the same model configuration, and are added to the `DataStack` together:
+ ```
+ let messages = ShardedSQLiteStore<Message>(
+     shardKey: #keyPath(Message.conversationID),
+     configuration: "Messages",
+     shardCount: 8,
+     fileURL: { SQLiteStore.defaultRootDirectory.appendingPathComponent("Messages-\($0).sqlite") }
+ )
+ try dataStack.addStorageAndWait(messages)
+ ```
+ Once added:
+ - Objects created with `Into<O>` are moved to their shard when the transaction is committed, based on their shard key value at that time. The shard key should not be changed after the object is saved.
+ - Fetches and queries with `From<O>` read from all shards, and Core Data merges the results by their `OrderBy` sort descriptors. If the `Where` clause pins the shard key with `==` or `IN` (directly or within an `AND`), only the matching shards are read.
+ - Important: Objects in different shards can't have relationships with each other, and aggregate queries such as `.count(...)` or `.sum(...)` are computed per shard. The configuration should contain only the sharded entity.
+ */
+public final class ShardedSQLiteStore<O: DynamicObject> {
+
+    /**
+     Initializes a `ShardedSQLiteStore` from existing `SQLiteStore`s.
+
+     - parameter shardKey: the key path of the attribute that determines an object's shard
+     - parameter storages: the shards, which should all have the same `configuration`. The order of shards should not change between launches, since it determines where existing objects are looked up.
+     - parameter shardIndex: an optional closure that returns the index of the shard in `storages` for a shard key value. If not specified, shards are assigned with `ShardedSQLiteStore.defaultShardIndex(for:shardCount:)`.
+     */
+    public init(shardKey: KeyPathString, storages: [SQLiteStore], shardIndex: ((_ shardKeyValue: Any?) -> Int)? = nil) {
+
+        Internals.assert(
+            !storages.isEmpty,
+            "Attempted to create a \(Internals.typeName(self)) without any \(Internals.typeName(SQLiteStore.self))s."
+        )
+        Internals.assert(
+            Set(storages.map({ $0.configuration ?? DataStack.defaultConfigurationName })).count == 1,
+            "All shards of a \(Internals.typeName(self)) should have the same configuration."
+        )
+        Internals.assert(
+            Set(storages.map({ $0.fileURL })).count == storages.count,
+            "All shards of a \(Internals.typeName(self)) should have different file URLs."
+        )
+        self.shardKey = shardKey
+        self.storages = storages
+
+        let shardCount = storages.count
+        self.shardIndex = shardIndex ?? { ShardedSQLiteStore.defaultShardIndex(for: $0, shardCount: shardCount) }
+    }
+
+    /**
+     Initializes a `ShardedSQLiteStore` with the specified number of `SQLiteStore` shards.
+
+     - parameter shardKey: the key path of the attribute that determines an object's shard
+     - parameter configuration: an optional configuration name from the model file. If not specified, defaults to `nil`, the "Default" configuration.
+     - parameter shardCount: the number of shards. This should not change between launches, since it determines where existing objects are looked up.
+     - parameter fileURL: a closure that returns the local file URL for the shard at an index
+     - parameter localStorageOptions: the `LocalStorageOptions` for all shards. Defaults to `.none`.
+     - parameter shardIndex: an optional closure that returns the index of the shard for a shard key value. If not specified, shards are assigned with `ShardedSQLiteStore.defaultShardIndex(for:shardCount:)`.
+     */
+    public convenience init(shardKey: KeyPathString, configuration: ModelConfiguration = nil, shardCount: Int, fileURL: (_ shardIndex: Int) -> URL, localStorageOptions: LocalStorageOptions = nil, shardIndex: ((_ shardKeyValue: Any?) -> Int)? = nil) {
+
+        self.init(
+            shardKey: shardKey,
+            storages: (0 ..< Swift.max(1, shardCount)).map {
+
+                SQLiteStore(
+                    fileURL: fileURL($0),
+                    configuration: configuration,
+                    localStorageOptions: localStorageOptions
+                )
+            },
+            shardIndex: shardIndex
+        )
+    }
+
+    /**
+     The key path of the attribute that determines an object's shard
+     */
+    public let shardKey: KeyPathString
+
+    /**
+     The `SQLiteStore` shards
+     */
+    public let storages: [SQLiteStore]
+
+    /**
+     The configuration name in the model file shared by all shards
+     */
+    public var configuration: ModelConfiguration {
+
+        return self.storages[0].configuration
+    }
+
+    /**
+     Returns the shard for a shard key value.
+
+     - parameter shardKeyValue: the value of the shard key
+     - returns: the `SQLiteStore` shard where objects with the shard key value are stored
+     */
+    public func storage(forShardKeyValue shardKeyValue: Any?) -> SQLiteStore {
+
+        return self.storages[self.index(forShardKeyValue: shardKeyValue)]
+    }
+
+    /**
+     The default shard assignment. Integer values are assigned by their remainder, and other values by a hash of their contents that is stable across launches.
+
+     - parameter shardKeyValue: the value of the shard key
+     - parameter shardCount: the number of shards
+     - returns: the index of the shard for the shard key value
+     */
+    public static func defaultShardIndex(for shardKeyValue: Any?, shardCount: Int) -> Int {
+
+        func fnv1a<S: Sequence>(_ bytes: S) -> UInt64 where S.Element == UInt8 {
+
+            return bytes.reduce(14695981039346656037 as UInt64) { ($0 ^ UInt64($1)) &* 1099511628211 }
+        }
+        let hash: UInt64
+        switch shardKeyValue {
+
+        case nil, is NSNull:
+            hash = 0
+
+        case let number as NSNumber where !CFNumberIsFloatType(number):
+            hash = UInt64(bitPattern: number.int64Value)
+
+        case let number as NSNumber:
+            hash = number.doubleValue.bitPattern
+
+        case let string as String:
+            hash = fnv1a(string.utf8)
+
+        case let uuid as UUID:
+            hash = fnv1a(uuid.uuidString.utf8)
+
+        case let data as Data:
+            hash = fnv1a(data)
+
+        case let date as Date:
+            hash = date.timeIntervalSinceReferenceDate.bitPattern
+
+        case let url as URL:
+            hash = fnv1a(url.absoluteString.utf8)
+
+        case let value?:
+            hash = fnv1a(String(describing: value).utf8)
+        }
+        return Int(hash % UInt64(Swift.max(1, shardCount)))
+    }
+
+
+    // MARK: Internal
+
+    internal func index(forShardKeyValue shardKeyValue: Any?) -> Int {
+
+        let shardCount = self.storages.count
+        let index = self.shardIndex(shardKeyValue)
+        Internals.assert(
+            (0 ..< shardCount).contains(index),
+            "The shard index \(index) for the shard key value \"\(shardKeyValue ?? "nil")\" is out of bounds."
+        )
+        return ((index % shardCount) + shardCount) % shardCount
+    }
+
+
+    // MARK: Private
+
+    private let shardIndex: (_ shardKeyValue: Any?) -> Int
+}
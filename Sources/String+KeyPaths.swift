@@ -50,7 +50,7 @@ extension KeyPathString {
      */
     public init<O: CoreStoreObject, K: KeyPathStringConvertible>(keyPath: KeyPath<O, K>) {
 
-        self = O.meta[keyPath: keyPath].cs_keyPathString
+        self = Internals.keyPathString(keyPath)
     }
 
     /**
@@ -0,0 +1,169 @@
+//
+//  Where.Compiled.swift
+//  CoreStore
+//
+//  Copyright © 2021 John Rommel Estropia
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+import Foundation
+import CoreData
+
+
+// MARK: - Where
+
+extension Where {
+
+    /**
+     Compiles the `Where` clause for repeated in-memory evaluation, such as filtering objects that are already loaded:
+     ```
+     let isAdult = Where<Person>(\.$age >= 18).compiled()
+     let insertedAdults = transaction.insertedObjects(Person.self).filter(isAdult)
+     ```
+     Comparisons of key paths (including `~` chains through to-one relationships) against constant values with `==`, `!=`, `<`, `<=`, `>`, `>=`, and `~=`, combined with `&&`, `||`, and `!`, are evaluated natively. Other predicates, such as string operators with options or `ANY`/`ALL` collection expressions, fall back to `NSPredicate.evaluate(with:)` for their part of the clause, so results are always the same as the original predicate.
+     - returns: a `Where.Compiled` value that evaluates the clause
+     */
+    public func compiled() -> Compiled {
+
+        return Compiled(self)
+    }
+
+
+    // MARK: - Compiled
+
+    /**
+     A `Where` clause compiled for in-memory evaluation. Created with `Where.compiled()`.
+     */
+    public struct Compiled {
+
+        /**
+         The predicate of the compiled `Where` clause
+         */
+        public let predicate: NSPredicate
+
+        /**
+         Evaluates the clause against an object.
+
+         - parameter object: the object to evaluate
+         - returns: `true` if the object satisfies the clause
+         */
+        public func evaluate(_ object: O) -> Bool {
+
+            return self.compiledPredicate.evaluate(with: object.cs_toRaw())
+        }
+
+        /**
+         Evaluates the clause against an object's snapshot. Key paths through relationships are not supported for snapshots, and evaluate the same as `NSPredicate.evaluate(with:)` on the snapshot's `dictionaryForValues()`.
+
+         - parameter snapshot: the snapshot to evaluate
+         - returns: `true` if the snapshot satisfies the clause
+         */
+        public func evaluate(_ snapshot: ObjectSnapshot<O>) -> Bool {
+
+            return self.compiledPredicate.evaluate(with: snapshot.dictionaryForValues() as NSDictionary)
+        }
+
+        /**
+         Evaluates the clause against an object.
+
+         - parameter object: the object to evaluate
+         - returns: `true` if the object satisfies the clause
+         */
+        public func callAsFunction(_ object: O) -> Bool {
+
+            return self.evaluate(object)
+        }
+
+
+        // MARK: Internal
+
+        internal var isNative: Bool {
+
+            return self.compiledPredicate.isNative
+        }
+
+        internal init(_ clause: Where<O>) {
+
+            self.predicate = clause.predicate
+            self.compiledPredicate = Internals.CompiledPredicate(clause.predicate)
+        }
+
+
+        // MARK: Private
+
+        private let compiledPredicate: Internals.CompiledPredicate
+    }
+}
+
+
+// MARK: - Sequence where Element: DynamicObject
+
+extension Sequence where Element: DynamicObject {
+
+    /**
+     Returns the objects that satisfy a `Where` clause. The clause is compiled once with `Where.compiled()` for the whole sequence.
+
+     - parameter clause: the `Where` clause to evaluate
+     - returns: the objects that satisfy `clause`, in order
+     */
+    public func filter(_ clause: Where<Element>) -> [Element] {
+
+        return self.filter(clause.compiled())
+    }
+
+    /**
+     Returns the objects that satisfy a compiled `Where` clause.
+
+     - parameter clause: the compiled `Where` clause to evaluate
+     - returns: the objects that satisfy `clause`, in order
+     */
+    public func filter(_ clause: Where<Element>.Compiled) -> [Element] {
+
+        return self.filter({ clause.evaluate($0) })
+    }
+}
+
+
+// MARK: - Sequence
+
+extension Sequence {
+
+    /**
+     Returns the snapshots that satisfy a compiled `Where` clause.
+
+     - parameter clause: the compiled `Where` clause to evaluate
+     - returns: the snapshots that satisfy `clause`, in order
+     */
+    public func filter<O>(_ clause: Where<O>.Compiled) -> [Element] where Element == ObjectSnapshot<O> {
+
+        return self.filter({ clause.evaluate($0) })
+    }
+
+    /**
+     Returns the `ObjectPublisher`s whose objects satisfy a compiled `Where` clause, such as the items of a `ListSnapshot`. Publishers whose objects were deleted are excluded.
+
+     - parameter clause: the compiled `Where` clause to evaluate
+     - returns: the `ObjectPublisher`s whose objects satisfy `clause`, in order
+     */
+    public func filter<O>(_ clause: Where<O>.Compiled) -> [Element] where Element == ObjectPublisher<O> {
+
+        return self.filter({ $0.object.map(clause.evaluate(_:)) ?? false })
+    }
+}
@@ -141,7 +141,12 @@ extension Where {
  */
 public func ~<O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCKeyPathValue>(_ lhs: KeyPath<O, D>, _ rhs: KeyPath<D, V>) -> Where<O>.Expression<Where<O>.SingleTarget, V> {
 
-    return .init(lhs.cs_keyPathString, rhs.cs_keyPathString)
+    return .init(
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return lhs.cs_keyPathString + "." + rhs.cs_keyPathString
+        }
+    )
 }
 
 /**
@@ -152,7 +157,12 @@ public func ~<O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCKeyPat
  */
 public func ~ <O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCKeyPathValue>(_ lhs: KeyPath<O, D?>, _ rhs: KeyPath<D, V>) -> Where<O>.Expression<Where<O>.SingleTarget, V> {
 
-    return .init(lhs.cs_keyPathString, rhs.cs_keyPathString)
+    return .init(
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return lhs.cs_keyPathString + "." + rhs.cs_keyPathString
+        }
+    )
 }
 
 /**
@@ -163,7 +173,12 @@ public func ~ <O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCKeyPa
  */
 public func ~ <O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCToManyRelationshipKeyPathValue>(_ lhs: KeyPath<O, D>, _ rhs: KeyPath<D, V>) -> Where<O>.Expression<Where<O>.CollectionTarget, V> {
 
-    return .init(lhs.cs_keyPathString, rhs.cs_keyPathString)
+    return .init(
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return lhs.cs_keyPathString + "." + rhs.cs_keyPathString
+        }
+    )
 }
 
 /**
@@ -174,7 +189,12 @@ public func ~ <O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCToMan
  */
 public func ~ <O: NSManagedObject, D: NSManagedObject, V: AllowedObjectiveCToManyRelationshipKeyPathValue>(_ lhs: KeyPath<O, D?>, _ rhs: KeyPath<D, V>) -> Where<O>.Expression<Where<O>.CollectionTarget, V> {
 
-    return .init(lhs.cs_keyPathString, rhs.cs_keyPathString)
+    return .init(
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return lhs.cs_keyPathString + "." + rhs.cs_keyPathString
+        }
+    )
 }
 
 /**
@@ -244,8 +264,10 @@ public func ~ <O: NSManagedObject, D: NSManagedObject, T, C: AllowedObjectiveCTo
 public func ~ <O: CoreStoreObject, D: FieldRelationshipToOneType, K: KeyPathStringConvertible>(_ lhs: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ rhs: KeyPath<D.DestinationObjectType, K>) -> Where<O>.Expression<Where<O>.SingleTarget, K.DestinationValueType> where K.ObjectType == D.DestinationObjectType {
 
     return .init(
-        O.meta[keyPath: lhs].cs_keyPathString,
-        D.DestinationObjectType.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return Internals.keyPathString(lhs) + "." + Internals.keyPathString(rhs)
+        }
     )
 }
 
@@ -258,8 +280,10 @@ public func ~ <O: CoreStoreObject, D: FieldRelationshipToOneType, K: KeyPathStri
 public func ~ <O: CoreStoreObject, D: CoreStoreObject, K: KeyPathStringConvertible>(_ lhs: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ rhs: KeyPath<D, K>) -> Where<O>.Expression<Where<O>.SingleTarget, K.DestinationValueType> where K.ObjectType == D {
 
     return .init(
-        O.meta[keyPath: lhs].cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return Internals.keyPathString(lhs) + "." + Internals.keyPathString(rhs)
+        }
     )
 }
 
@@ -273,7 +297,7 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, K: KeyPathStringConver
 
     return .init(
         lhs.cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(rhs)
     )
 }
 
@@ -287,7 +311,7 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, K: KeyPathStringConver
 
     return .init(
         lhs.cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(rhs)
     )
 }
 
@@ -300,8 +324,10 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, K: KeyPathStringConver
 public func ~ <O: CoreStoreObject, D: FieldRelationshipToOneType, K: ToManyRelationshipKeyPathStringConvertible>(_ lhs: KeyPath<O, FieldContainer<O>.Relationship<D>>, _ rhs: KeyPath<D.DestinationObjectType, K>) -> Where<O>.Expression<Where<O>.CollectionTarget, K.DestinationValueType> where K.ObjectType == D.DestinationObjectType {
 
     return .init(
-        O.meta[keyPath: lhs].cs_keyPathString,
-        D.DestinationObjectType.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return Internals.keyPathString(lhs) + "." + Internals.keyPathString(rhs)
+        }
     )
 }
 
@@ -314,8 +340,10 @@ public func ~ <O: CoreStoreObject, D: FieldRelationshipToOneType, K: ToManyRelat
 public func ~ <O: CoreStoreObject, D: CoreStoreObject, K: ToManyRelationshipKeyPathStringConvertible>(_ lhs: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, _ rhs: KeyPath<D, K>) -> Where<O>.Expression<Where<O>.CollectionTarget, K.DestinationValueType> where K.ObjectType == D {
 
     return .init(
-        O.meta[keyPath: lhs].cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(chaining: lhs, rhs) {
+
+            return Internals.keyPathString(lhs) + "." + Internals.keyPathString(rhs)
+        }
     )
 }
 
@@ -329,7 +357,7 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, K: ToManyRelationshipK
 
     return .init(
         lhs.cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(rhs)
     )
 }
 
@@ -343,7 +371,7 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, K: ToManyRelationshipK
 
     return .init(
         lhs.cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(rhs)
     )
 }
 
@@ -357,7 +385,7 @@ public func ~ <O: CoreStoreObject, D: CoreStoreObject, T, KC: ToManyRelationship
 
     return .init(
         lhs.cs_keyPathString,
-        D.meta[keyPath: rhs].cs_keyPathString
+        Internals.keyPathString(rhs)
     )
 }
 
@@ -408,7 +436,7 @@ public func ~= <O, T, V: QueryableAttributeType, S: Sequence>(_ sequence: S, _ e
  */
 public func < <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V>, _ rhs: V) -> Where<O> {
 
-    return  Where<O>(expression: lhs, function: "<", operand: rhs)
+    return  Where<O>(expression: lhs, operatorType: .lessThan, operand: rhs)
 }
 
 /**
@@ -419,7 +447,7 @@ public func < <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Exp
  */
 public func <= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V>, _ rhs: V) -> Where<O> {
 
-    return  Where<O>(expression: lhs, function: "<=", operand: rhs)
+    return  Where<O>(expression: lhs, operatorType: .lessThanOrEqualTo, operand: rhs)
 }
 
 /**
@@ -430,7 +458,7 @@ public func <= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Ex
  */
 public func > <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V>, _ rhs: V) -> Where<O> {
 
-    return  Where<O>(expression: lhs, function: ">", operand: rhs)
+    return  Where<O>(expression: lhs, operatorType: .greaterThan, operand: rhs)
 }
 
 /**
@@ -441,7 +469,7 @@ public func > <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Exp
  */
 public func >= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V>, _ rhs: V) -> Where<O> {
 
-    return  Where<O>(expression: lhs, function: ">=", operand: rhs)
+    return  Where<O>(expression: lhs, operatorType: .greaterThanOrEqualTo, operand: rhs)
 }
 
 
@@ -513,7 +541,7 @@ public func ~= <O, T, V: QueryableAttributeType, S: Sequence>(_ sequence: S, _ e
  */
 public func < <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V?>, _ rhs: V) -> Where<O> {
 
-    return Where<O>(expression: lhs, function: "<", operand: rhs)
+    return Where<O>(expression: lhs, operatorType: .lessThan, operand: rhs)
 }
 
 /**
@@ -524,7 +552,7 @@ public func < <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Exp
  */
 public func <= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V?>, _ rhs: V?) -> Where<O> {
 
-    return Where<O>(expression: lhs, function: "<=", operand: rhs)
+    return Where<O>(expression: lhs, operatorType: .lessThanOrEqualTo, operand: rhs)
 }
 
 /**
@@ -535,7 +563,7 @@ public func <= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Ex
  */
 public func > <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V?>, _ rhs: V) -> Where<O> {
 
-    return Where<O>(expression: lhs, function: ">", operand: rhs)
+    return Where<O>(expression: lhs, operatorType: .greaterThan, operand: rhs)
 }
 
 /**
@@ -546,7 +574,7 @@ public func > <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Exp
  */
 public func >= <O, T, V: QueryableAttributeType & Comparable>(_ lhs: Where<O>.Expression<T, V?>, _ rhs: V?) -> Where<O> {
 
-    return Where<O>(expression: lhs, function: ">=", operand: rhs)
+    return Where<O>(expression: lhs, operatorType: .greaterThanOrEqualTo, operand: rhs)
 }
 
 
@@ -634,7 +662,7 @@ extension KeyPath where Root: CoreStoreObject, Value: ToManyRelationshipKeyPathS
      */
     public func count() -> Where<Root>.Expression<Where<Root>.CollectionTarget, Int> {
 
-        return .init(Root.meta[keyPath: self].cs_keyPathString, "@count")
+        return .init(Internals.keyPathString(self), "@count")
     }
 }
 
@@ -695,37 +723,37 @@ extension Where {
 
     // MARK: FilePrivate
 
-    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V>, function: String, operand: V) {
+    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V>, operatorType: NSComparisonPredicate.Operator, operand: V) {
 
-        self.init("\(expression.cs_keyPathString) \(function) %@", operand.cs_toQueryableNativeType())
+        self.init(expression.cs_keyPathString, operatorType, operand.cs_toQueryableNativeType())
     }
 
-    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V?>, function: String, operand: V) {
+    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V?>, operatorType: NSComparisonPredicate.Operator, operand: V) {
 
-        self.init("\(expression.cs_keyPathString) \(function) %@", operand.cs_toQueryableNativeType())
+        self.init(expression.cs_keyPathString, operatorType, operand.cs_toQueryableNativeType())
     }
 
-    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V>, function: String, operand: V?) {
+    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V>, operatorType: NSComparisonPredicate.Operator, operand: V?) {
 
         if let operand = operand {
 
-            self.init("\(expression.cs_keyPathString) \(function) %@", operand.cs_toQueryableNativeType())
+            self.init(expression.cs_keyPathString, operatorType, operand.cs_toQueryableNativeType())
         }
         else {
 
-            self.init("\(expression.cs_keyPathString) \(function) nil")
+            self.init(expression.cs_keyPathString, operatorType, nil)
         }
     }
 
-    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V?>, function: String, operand: V?) {
+    fileprivate init<T, V: QueryableAttributeType & Comparable>(expression: Where<O>.Expression<T, V?>, operatorType: NSComparisonPredicate.Operator, operand: V?) {
 
         if let operand = operand {
 
-            self.init("\(expression.cs_keyPathString) \(function) %@", operand.cs_toQueryableNativeType())
+            self.init(expression.cs_keyPathString, operatorType, operand.cs_toQueryableNativeType())
         }
         else {
 
-            self.init("\(expression.cs_keyPathString) \(function) nil")
+            self.init(expression.cs_keyPathString, operatorType, nil)
         }
     }
 }
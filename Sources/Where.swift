@@ -172,7 +172,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
      */
     public init(_ keyPath: KeyPathString, isEqualTo null: Void?) {
         
-        self.init(NSPredicate(format: "\(keyPath) == nil"))
+        self.init(keyPath, .equalTo, nil)
     }
 
     /**
@@ -187,10 +187,10 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
 
         case nil,
              is NSNull:
-            self.init(NSPredicate(format: "\(keyPath) == nil"))
+            self.init(keyPath, .equalTo, nil)
 
         case let value:
-            self.init(NSPredicate(format: "\(keyPath) == %@", argumentArray: [value.cs_toFieldStoredNativeType() as Any]))
+            self.init(keyPath, .equalTo, value.cs_toFieldStoredNativeType() as Any)
         }
     }
 
@@ -207,10 +207,10 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
 
         case nil,
              is NSNull:
-            self.init(NSPredicate(format: "\(keyPath) == nil"))
+            self.init(keyPath, .equalTo, nil)
 
         case let value?:
-            self.init(NSPredicate(format: "\(keyPath) == %@", argumentArray: [value.cs_toQueryableNativeType()]))
+            self.init(keyPath, .equalTo, value.cs_toQueryableNativeType())
         }
     }
     
@@ -225,10 +225,10 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
         switch object {
             
         case nil:
-            self.init(NSPredicate(format: "\(keyPath) == nil"))
+            self.init(keyPath, .equalTo, nil)
             
         case let object?:
-            self.init(NSPredicate(format: "\(keyPath) == %@", argumentArray: [object.cs_id()]))
+            self.init(keyPath, .equalTo, object.cs_id())
         }
     }
     
@@ -240,7 +240,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
      */
     public init(_ keyPath: KeyPathString, isEqualTo objectID: NSManagedObjectID) {
         
-        self.init(NSPredicate(format: "\(keyPath) == %@", argumentArray: [objectID]))
+        self.init(keyPath, .equalTo, objectID)
     }
 
     /**
@@ -251,7 +251,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
      */
     public init<S: Sequence>(_ keyPath: KeyPathString, isMemberOf list: S) where S.Iterator.Element: FieldStorableType {
 
-        self.init(NSPredicate(format: "\(keyPath) IN %@", list.map({ $0.cs_toFieldStoredNativeType() }) as NSArray))
+        self.init(keyPath, .in, list.map({ $0.cs_toFieldStoredNativeType() }) as NSArray)
     }
     
     /**
@@ -263,7 +263,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
     @_disfavoredOverload
     public init<S: Sequence>(_ keyPath: KeyPathString, isMemberOf list: S) where S.Iterator.Element: QueryableAttributeType {
         
-        self.init(NSPredicate(format: "\(keyPath) IN %@", list.map({ $0.cs_toQueryableNativeType() }) as NSArray))
+        self.init(keyPath, .in, list.map({ $0.cs_toQueryableNativeType() }) as NSArray)
     }
     
     /**
@@ -274,7 +274,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
      */
     public init<S: Sequence>(_ keyPath: KeyPathString, isMemberOf list: S) where S.Iterator.Element: DynamicObject {
         
-        self.init(NSPredicate(format: "\(keyPath) IN %@", list.map({ $0.cs_id() }) as NSArray))
+        self.init(keyPath, .in, list.map({ $0.cs_id() }) as NSArray)
     }
     
     /**
@@ -285,7 +285,7 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
      */
     public init<S: Sequence>(_ keyPath: KeyPathString, isMemberOf list: S) where S.Iterator.Element: NSManagedObjectID {
         
-        self.init(NSPredicate(format: "\(keyPath) IN %@", list.map({ $0 }) as NSArray))
+        self.init(keyPath, .in, list.map({ $0 }) as NSArray)
     }
     
     
@@ -334,8 +334,16 @@ public struct Where<O: DynamicObject>: WhereClauseType, FetchClause, QueryClause
 
         hasher.combine(self.predicate)
     }
-    
-    
+
+
+    // MARK: Internal
+
+    internal init(_ keyPath: KeyPathString, _ operatorType: NSComparisonPredicate.Operator, _ value: Any?) {
+
+        self.init(Internals.comparisonPredicate(keyPath, operatorType, value))
+    }
+
+
     // MARK: Deprecated
 
     @available(*, deprecated, renamed: "O")
@@ -355,7 +363,7 @@ extension Where where O: NSManagedObject {
      */
     public init<V: QueryableAttributeType>(_ keyPath: KeyPath<O, V>, isEqualTo null: Void?) {
         
-        self.init(keyPath._kvcKeyPathString!, isEqualTo: null)
+        self.init(Internals.kvcKeyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -366,7 +374,7 @@ extension Where where O: NSManagedObject {
      */
     public init<D: DynamicObject>(_ keyPath: KeyPath<O, D>, isEqualTo null: Void?) {
         
-        self.init(keyPath._kvcKeyPathString!, isEqualTo: null)
+        self.init(Internals.kvcKeyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -377,7 +385,7 @@ extension Where where O: NSManagedObject {
      */
     public init<V: QueryableAttributeType>(_ keyPath: KeyPath<O, V>, isEqualTo value: V?) {
         
-        self.init(keyPath._kvcKeyPathString!, isEqualTo: value)
+        self.init(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -388,7 +396,7 @@ extension Where where O: NSManagedObject {
      */
     public init<D: DynamicObject>(_ keyPath: KeyPath<O, D>, isEqualTo value: D?) {
         
-        self.init(keyPath._kvcKeyPathString!, isEqualTo: value)
+        self.init(Internals.kvcKeyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -399,7 +407,7 @@ extension Where where O: NSManagedObject {
      */
     public init<D: DynamicObject>(_ keyPath: KeyPath<O, D>, isEqualTo objectID: NSManagedObjectID) {
         
-        self.init(keyPath._kvcKeyPathString!, isEqualTo: objectID)
+        self.init(Internals.kvcKeyPathString(keyPath), isEqualTo: objectID)
     }
     
     /**
@@ -410,7 +418,7 @@ extension Where where O: NSManagedObject {
      */
     public init<V: QueryableAttributeType, S: Sequence>(_ keyPath: KeyPath<O, V>, isMemberOf list: S) where S.Iterator.Element == V {
         
-        self.init(keyPath._kvcKeyPathString!, isMemberOf: list)
+        self.init(Internals.kvcKeyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -421,7 +429,7 @@ extension Where where O: NSManagedObject {
      */
     public init<D: DynamicObject, S: Sequence>(_ keyPath: KeyPath<O, D>, isMemberOf list: S) where S.Iterator.Element == D {
         
-        self.init(keyPath._kvcKeyPathString!, isMemberOf: list)
+        self.init(Internals.kvcKeyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -432,7 +440,7 @@ extension Where where O: NSManagedObject {
      */
     public init<D: DynamicObject, S: Sequence>(_ keyPath: KeyPath<D, O>, isMemberOf list: S) where S.Iterator.Element: NSManagedObjectID {
         
-        self.init(keyPath._kvcKeyPathString!, isMemberOf: list)
+        self.init(Internals.kvcKeyPathString(keyPath), isMemberOf: list)
     }
 }
 
@@ -449,7 +457,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, isEqualTo value: V) {
 
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: value)
     }
 
     /**
@@ -460,7 +468,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<V>>, isEqualTo value: V.DestinationObjectType?) {
 
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -471,7 +479,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, isEqualTo null: Void?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: null)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -482,7 +490,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V: FieldRelationshipToOneType>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<V>>, isEqualTo null: Void?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: null)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -493,7 +501,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V, S: Sequence>(_ keyPath: KeyPath<O, FieldContainer<O>.Stored<V>>, isMemberOf list: S) where S.Iterator.Element == V {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -504,7 +512,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V: FieldRelationshipToOneType, S: Sequence>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<V>>, isMemberOf list: S) where S.Iterator.Element == V.DestinationObjectType {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -515,7 +523,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V: FieldRelationshipToOneType, S: Sequence>(_ keyPath: KeyPath<O, FieldContainer<O>.Relationship<V>>, isMemberOf list: S) where S.Iterator.Element: NSManagedObjectID {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -526,7 +534,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, isEqualTo value: V?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -537,7 +545,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, isEqualTo value: V?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -548,7 +556,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, isEqualTo null: Void?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: null)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -559,7 +567,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, isEqualTo null: Void?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: null)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: null)
     }
     
     /**
@@ -570,7 +578,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, isEqualTo value: D?) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: value)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: value)
     }
     
     /**
@@ -581,7 +589,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<D>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, isEqualTo objectID: NSManagedObjectID) {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isEqualTo: objectID)
+        self.init(Internals.keyPathString(keyPath), isEqualTo: objectID)
     }
     
     /**
@@ -592,7 +600,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V, S: Sequence>(_ keyPath: KeyPath<O, ValueContainer<O>.Required<V>>, isMemberOf list: S) where S.Iterator.Element == V {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -603,7 +611,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<V, S: Sequence>(_ keyPath: KeyPath<O, ValueContainer<O>.Optional<V>>, isMemberOf list: S) where S.Iterator.Element == V {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -614,7 +622,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<D, S: Sequence>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, isMemberOf list: S) where S.Iterator.Element == D {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**
@@ -625,7 +633,7 @@ extension Where where O: CoreStoreObject {
      */
     public init<D, S: Sequence>(_ keyPath: KeyPath<O, RelationshipContainer<O>.ToOne<D>>, isMemberOf list: S) where S.Iterator.Element: NSManagedObjectID {
         
-        self.init(O.meta[keyPath: keyPath].keyPath, isMemberOf: list)
+        self.init(Internals.keyPathString(keyPath), isMemberOf: list)
     }
     
     /**